@@ -0,0 +1,165 @@
+##############################################################################
+# PURPOSE:
+#    (This is a Python input file class to set up TrickHLA object templates
+#     for the Space Reference FOM PhysicalEntity, DynamicalEntity and
+#     ReferenceFrame objects. An object is instantiated from a template for
+#     each discovered object instance that does not match a configured
+#     object, up to the template pool size.)
+#
+# REFERENCE:
+#    (Trick documentation.)
+#
+# ASSUMPTIONS AND LIMITATIONS:
+#    ((Assumes that trick is available globally.)
+#     (Must be initialized before the SpaceFOMFederateConfig is initialized,
+#      since the federate configuration allocates room in the manager objects
+#      array for the template pools.))
+#
+# PROGRAMMERS:
+#    (((TrickHLA Team) (NASA/ER6) (Oct 2026) (--) (Initial version.)))
+##############################################################################
+import trick
+from ..TrickHLA.TrickHLAAttributeConfig import *
+
+# The FOM attribute name, the Trick variable relative to the packing instance
+# and the RTI encoding for each of the PhysicalEntity attributes.
+physical_entity_template_attributes = [
+   ( 'name',                    'pe_packing_data.name',         trick.TrickHLA.ENCODING_UNICODE_STRING ),
+   ( 'type',                    'pe_packing_data.type',         trick.TrickHLA.ENCODING_UNICODE_STRING ),
+   ( 'status',                  'pe_packing_data.status',       trick.TrickHLA.ENCODING_UNICODE_STRING ),
+   ( 'parent_reference_frame',  'pe_packing_data.parent_frame', trick.TrickHLA.ENCODING_UNICODE_STRING ),
+   ( 'state',                   'stc_encoder.buffer',           trick.TrickHLA.ENCODING_NONE ),
+   ( 'acceleration',            'pe_packing_data.accel',        trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'rotational_acceleration', 'pe_packing_data.ang_accel',    trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'center_of_mass',          'pe_packing_data.cm',           trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'body_wrt_structural',     'quat_encoder.buffer',          trick.TrickHLA.ENCODING_NONE ) ]
+
+# The DynamicalEntity attributes extend the PhysicalEntity attributes.
+dynamical_entity_template_attributes = physical_entity_template_attributes + [
+   ( 'force',        'de_packing_data.force',        trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'torque',       'de_packing_data.torque',       trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'mass',         'de_packing_data.mass',         trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'mass_rate',    'de_packing_data.mass_rate',    trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'inertia',      'de_packing_data.inertia',      trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'inertia_rate', 'de_packing_data.inertia_rate', trick.TrickHLA.ENCODING_LITTLE_ENDIAN ) ]
+
+# The ReferenceFrame attributes.
+ref_frame_template_attributes = [
+   ( 'name',        'packing_data.name',        trick.TrickHLA.ENCODING_UNICODE_STRING ),
+   ( 'parent_name', 'packing_data.parent_name', trick.TrickHLA.ENCODING_UNICODE_STRING ),
+   ( 'state',       'stc_encoder.buffer',       trick.TrickHLA.ENCODING_NONE ) ]
+
+
+class SpaceFOMObjectTemplates(object):
+
+   # TrickHLA manager the object templates are configured in.
+   manager = None
+
+   # List of ( name, FOM name, attributes, pool size, packing prototype,
+   # lag compensation prototype, lag compensation type ) template settings.
+   templates = None
+
+   def __init__( self, thla_manager ):
+
+      self.manager   = thla_manager
+      self.templates = []
+
+      return
+
+
+   def add_physical_entity_template( self,
+                                     template_name,
+                                     pool_size,
+                                     entity_prototype,
+                                     lag_comp_prototype = None,
+                                     lag_comp_type      = trick.TrickHLA.LAG_COMPENSATION_NONE ):
+
+      # The entity_prototype is a SpaceFOM::PhysicalEntity and the optional
+      # lag_comp_prototype a SpaceFOM::PhysicalEntityLagComp or
+      # SpaceFOM::PhysicalEntityLagCompInterp.
+      self.templates.append( ( template_name,
+                               'PhysicalEntity',
+                               physical_entity_template_attributes,
+                               pool_size,
+                               entity_prototype,
+                               lag_comp_prototype,
+                               lag_comp_type ) )
+      return
+
+
+   def add_dynamical_entity_template( self,
+                                      template_name,
+                                      pool_size,
+                                      entity_prototype,
+                                      lag_comp_prototype = None,
+                                      lag_comp_type      = trick.TrickHLA.LAG_COMPENSATION_NONE ):
+
+      # The entity_prototype is a SpaceFOM::DynamicalEntity and the optional
+      # lag_comp_prototype a SpaceFOM::DynamicalEntityLagComp.
+      self.templates.append( ( template_name,
+                               'PhysicalEntity.DynamicalEntity',
+                               dynamical_entity_template_attributes,
+                               pool_size,
+                               entity_prototype,
+                               lag_comp_prototype,
+                               lag_comp_type ) )
+      return
+
+
+   def add_ref_frame_template( self,
+                               template_name,
+                               pool_size,
+                               frame_prototype,
+                               lag_comp_prototype = None,
+                               lag_comp_type      = trick.TrickHLA.LAG_COMPENSATION_NONE ):
+
+      # The frame_prototype is a SpaceFOM::RefFrameState and the optional
+      # lag_comp_prototype a SpaceFOM::RefFrameLagComp.
+      self.templates.append( ( template_name,
+                               'ReferenceFrame',
+                               ref_frame_template_attributes,
+                               pool_size,
+                               frame_prototype,
+                               lag_comp_prototype,
+                               lag_comp_type ) )
+      return
+
+
+   def initialize( self ):
+
+      if len( self.templates ) == 0:
+         return
+
+      self.manager.obj_template_count = len( self.templates )
+      self.manager.obj_templates = trick.TMM_declare_var_1d( 'TrickHLA::ObjectTemplate',
+                                                             self.manager.obj_template_count )
+
+      for t_indx in range( 0, self.manager.obj_template_count ):
+         ( name, FOM_name, attributes, pool_size,
+           packing, lag_comp, lag_comp_type ) = self.templates[t_indx]
+
+         template = self.manager.obj_templates[t_indx]
+         template.name          = str( name )
+         template.FOM_name      = str( FOM_name )
+         template.pool_size     = pool_size
+         template.packing       = packing
+         template.lag_comp      = lag_comp
+         template.lag_comp_type = lag_comp_type
+
+         # The template attribute trick_names are relative to the packing
+         # instance, and the instances are always remotely owned.
+         template.attr_count = len( attributes )
+         template.attributes = trick.TMM_declare_var_1d( 'TrickHLA::Attribute',
+                                                         template.attr_count )
+         for a_indx in range( 0, template.attr_count ):
+            FOM_name, trick_name, rti_encoding = attributes[a_indx]
+            attribute = TrickHLAAttributeConfig( FOM_name,
+                                                 trick_name,
+                                                 False,
+                                                 True,
+                                                 False,
+                                                 trick.TrickHLA.CONFIG_CYCLIC,
+                                                 rti_encoding )
+            attribute.initialize( template.attributes[a_indx] )
+
+      return
@@ -23,6 +23,9 @@ class TrickHLAAttributeConfig( object ):
    locally_owned = True
    config        = trick.TrickHLA.CONFIG_CYCLIC
    rti_encoding  = trick.TrickHLA.ENCODING_UNICODE_STRING
+   send_priority = trick.TrickHLA.SEND_PRIORITY_OBJECT
+   shared_memory = False
+   shared_memory_FOM_name = None
    
 
    def __init__( self,
@@ -32,7 +35,10 @@ class TrickHLAAttributeConfig( object ):
       subscribe     = True,
       locally_owned = True,
       config        = trick.TrickHLA.CONFIG_CYCLIC,
-      rti_encoding  = trick.TrickHLA.ENCODING_UNICODE_STRING ):
+      rti_encoding  = trick.TrickHLA.ENCODING_UNICODE_STRING,
+      send_priority = trick.TrickHLA.SEND_PRIORITY_OBJECT,
+      shared_memory = False,
+      shared_memory_FOM_name = None ):
 
       self.FOM_name      = FOM_name
       self.trick_name    = trick_name
@@ -41,6 +47,9 @@ class TrickHLAAttributeConfig( object ):
       self.locally_owned = locally_owned
       self.config        = config
       self.rti_encoding  = rti_encoding
+      self.send_priority = send_priority
+      self.shared_memory = shared_memory
+      self.shared_memory_FOM_name = shared_memory_FOM_name
 
       return
 
@@ -54,6 +63,10 @@ class TrickHLAAttributeConfig( object ):
       attribute.locally_owned = self.locally_owned
       attribute.config        = self.config
       attribute.rti_encoding  = self.rti_encoding
+      attribute.send_priority = self.send_priority
+      attribute.shared_memory = self.shared_memory
+      if self.shared_memory_FOM_name is not None:
+         attribute.shared_memory_FOM_name = self.shared_memory_FOM_name
 
       return
 
@@ -110,11 +110,14 @@ class TrickHLAFederateConfig( object ):
          # initialize them. This will allow users to add or delete objects
          # without having to manage array size.
 
-         # Allocate the federate's federation object list.
+         # Allocate the federate's federation object list, with room for the
+         # objects instantiated from any object templates, which must be
+         # configured in the manager before this point.
          self.manager.obj_count = len(self.fed_objects)
-         if self.manager.obj_count:
-            self.manager.objects = trick.alloc_type( self.manager.obj_count,
-                                                     'TrickHLA::Object'      )
+         obj_pool_size = self.manager.get_object_template_pool_size()
+         if self.manager.obj_count + obj_pool_size:
+            self.manager.objects = trick.alloc_type( self.manager.obj_count + obj_pool_size,
+                                                     'TrickHLA::Object'                     )
 
          # Loop through the federation objects and initialize them.
          for indx in range( 0, self.manager.obj_count ):
@@ -0,0 +1,132 @@
+##############################################################################
+# PURPOSE:
+#    (This is a python input file class to set up the general parameters that
+#     describe a TrickHLA federate performance metrics object.)
+#
+# REFERENCE:
+#    (Trick 17 documentation.)
+#
+# ASSUMPTIONS AND LIMITATIONS:
+#    ((Inherits from the base TrickHLAObjectConfig class)
+#     (Assumes that trick is available globally.)
+#     (Requires the FOMs/TrickHLA/TrickHLAFederateMetrics.xml FOM module.))
+#
+# PROGRAMMERS:
+#    (((TrickHLA Team) (NASA/ER6) (Oct 2026) (--) (Initial version.)))
+##############################################################################
+import trick
+from .TrickHLAObjectConfig import *
+from .TrickHLAAttributeConfig import *
+
+# The FOM name of the federate metrics object class.
+federate_metrics_FOM_name = 'TrickHLAFederateMetrics'
+
+# The FOM attribute name, TrickHLA::FederateMetrics variable and RTI encoding
+# for each of the federate metrics object attributes.
+federate_metrics_attributes = [
+   ( 'federate_name',           'federate_name',           trick.TrickHLA.ENCODING_UNICODE_STRING ),
+   ( 'granted_time',            'granted_time',            trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'frame_time',              'frame_time',              trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'frame_time_max',          'frame_time_max',          trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'tag_wait_time',           'tag_wait_time',           trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'pack_time',               'pack_time',               trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'unpack_time',             'unpack_time',             trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'send_rate',               'send_rate',               trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'receive_rate',            'receive_rate',            trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'reflection_queue_depth',  'reflection_queue_depth',  trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'interaction_queue_depth', 'interaction_queue_depth', trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'total_overrun_count',     'total_overrun_count',     trick.TrickHLA.ENCODING_LITTLE_ENDIAN ),
+   ( 'mode_transition_error',   'mode_transition_error',   trick.TrickHLA.ENCODING_LITTLE_ENDIAN ) ]
+
+
+class TrickHLAFederateMetricsObject(TrickHLAObjectConfig):
+
+   trick_metrics_sim_obj_name = None
+
+   def __init__( self,
+                 create_metrics_object,
+                 metrics_instance_name,
+                 metrics_S_define_instance,
+                 metrics_S_define_instance_name,
+                 metrics_thla_manager_object = None ):
+
+      # Save the metrics name to use for trick_data_name generation.
+      self.trick_metrics_sim_obj_name = str( metrics_S_define_instance_name )
+
+      # Call the base class constructor.
+      TrickHLAObjectConfig.__init__( self,
+                                     create_metrics_object,
+                                     metrics_instance_name,
+                                     federate_metrics_FOM_name,
+                                     None,
+                                     trick.TrickHLA.LAG_COMPENSATION_NONE,
+                                     None,
+                                     None,
+                                     None,
+                                     metrics_S_define_instance,
+                                     metrics_thla_manager_object )
+
+      # Build the object attribute list.
+      self.add_attributes()
+
+      return
+
+
+   def initialize( self, thla_object ):
+
+      # Call the base class initialization utility function.
+      TrickHLAObjectConfig.initialize( self, thla_object )
+
+      return
+
+
+   def add_attributes( self ):
+
+      for FOM_name, trick_name, rti_encoding in federate_metrics_attributes :
+         trick_data_name = self.trick_metrics_sim_obj_name + '.' + trick_name
+         attribute = TrickHLAAttributeConfig( FOM_name,
+                                              trick_data_name,
+                                              self.hla_create,
+                                              not self.hla_create,
+                                              self.hla_create,
+                                              trick.TrickHLA.CONFIG_CYCLIC,
+                                              rti_encoding )
+         self.add_attribute( attribute )
+
+      return
+
+
+def configure_federate_metrics_template( thla_manager,
+                                         template_name,
+                                         pool_size,
+                                         metrics_prototype ):
+
+   # Configure a single object template so the manager instantiates an object
+   # for the metrics of each discovered federate, up to the pool size. This
+   # must be called before the TrickHLAFederateConfig allocates the objects.
+   thla_manager.obj_template_count = 1
+   thla_manager.obj_templates = trick.TMM_declare_var_1d( 'TrickHLA::ObjectTemplate', 1 )
+
+   template = thla_manager.obj_templates[0]
+   template.name          = str( template_name )
+   template.FOM_name      = federate_metrics_FOM_name
+   template.pool_size     = pool_size
+   template.packing       = metrics_prototype
+   template.lag_comp_type = trick.TrickHLA.LAG_COMPENSATION_NONE
+
+   # The template attribute trick_names are relative to the packing instance.
+   template.attr_count = len( federate_metrics_attributes )
+   template.attributes = trick.TMM_declare_var_1d( 'TrickHLA::Attribute',
+                                                   template.attr_count )
+   for indx in range( 0, template.attr_count ):
+      FOM_name, trick_name, rti_encoding = federate_metrics_attributes[indx]
+      attribute = TrickHLAAttributeConfig( FOM_name,
+                                           trick_name,
+                                           False,
+                                           True,
+                                           False,
+                                           trick.TrickHLA.CONFIG_CYCLIC,
+                                           rti_encoding )
+      attribute.initialize( template.attributes[indx] )
+
+   return
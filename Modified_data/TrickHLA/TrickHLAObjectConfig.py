@@ -31,6 +31,9 @@ class TrickHLAObjectConfig( object ):
    hla_deleted_instance     = None
    hla_thread_IDs           = None
    hla_blocking_cyclic_read = False
+   hla_reflection_conflation      = trick.TrickHLA.REFLECTION_CONFLATION_NONE
+   hla_reflection_queue_max_depth = 0
+   hla_send_priority        = trick.TrickHLA.SEND_PRIORITY_NORMAL
 
    # List of TrickHLA object attributes.
    attributes = None
@@ -123,6 +126,9 @@ class TrickHLAObjectConfig( object ):
       self.set_create( self.hla_create )
       self.set_thread_IDs( self.hla_thread_IDs )
       self.set_blocking_cyclic_read( self.hla_blocking_cyclic_read )
+      self.set_reflection_conflation( self.hla_reflection_conflation,
+                                      self.hla_reflection_queue_max_depth )
+      self.set_send_priority( self.hla_send_priority )
 
       if self.hla_lag_comp_instance != None :
          self.set_lag_comp_instance( self.hla_lag_comp_instance )
@@ -276,3 +282,31 @@ class TrickHLAObjectConfig( object ):
    def get_blocking_cyclic_read( self ):
 
       return self.hla_blocking_cyclic_read
+
+
+   def set_reflection_conflation( self, conflation, max_depth = 0 ):
+
+      self.hla_reflection_conflation      = conflation
+      self.hla_reflection_queue_max_depth = max_depth
+      if self.hla_manager_object != None :
+         self.hla_manager_object.reflection_conflation      = self.hla_reflection_conflation
+         self.hla_manager_object.reflection_queue_max_depth = self.hla_reflection_queue_max_depth
+
+      return
+
+   def get_reflection_conflation( self ):
+
+      return self.hla_reflection_conflation
+
+
+   def set_send_priority( self, send_priority ):
+
+      self.hla_send_priority = send_priority
+      if self.hla_manager_object != None :
+         self.hla_manager_object.send_priority = self.hla_send_priority
+
+      return
+
+   def get_send_priority( self ):
+
+      return self.hla_send_priority
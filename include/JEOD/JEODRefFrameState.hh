@@ -40,12 +40,17 @@ NASA, Johnson Space Center\n
 #ifndef SPACEFOM_JEOD_REF_FRAME_STATE_HH
 #define SPACEFOM_JEOD_REF_FRAME_STATE_HH
 
+// System include files.
+#include <cstdint>
+
 // JEOD include files.
 #include "environment/time/include/time_tt.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
 #include "utils/ref_frames/include/ref_frame_state.hh"
 
 // SpaceFOM include files.
 #include "SpaceFOM/RefFrameBase.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
 
 namespace SpaceFOM
 {
@@ -109,10 +114,58 @@ class JEODRefFrameState : public SpaceFOM::RefFrameBase
     *  pe_packing_data object into the working data object(s). */
    virtual void unpack_into_working_data();
 
+   // From the TrickHLA::Packing class.
+   /*! @brief Called to pack the data before the data is sent to the RTI.
+    *  @details When send_changes_only is set, the state is only packed when
+    *  the JEOD state changed and the receiver extrapolation of the last sent
+    *  state is out of tolerance. Otherwise the last sent state is kept in the
+    *  packing data so that the conditional does not send it again. */
+   virtual void pack();
+
+   /*! @brief Compute the JEOD target frame state with respect to the parent
+    *  frame and set the time tag.
+    *  @param target_frame JEOD reference frame mirrored by this frame.
+    *  @param parent_frame JEOD reference frame mirrored by the parent frame. */
+   void update_from_jeod( jeod::RefFrame *target_frame,
+                          jeod::RefFrame *parent_frame );
+
+   /*! @brief Increment the state version if the JEOD reference frame state
+    *  changed since the last check.
+    *  @return True if the state changed. */
+   bool const update_state_version();
+
+   /*! @brief Get the version of the JEOD reference frame state.
+    *  @return State version, which increments each time the state changes. */
+   int64_t get_state_version() const
+   {
+      return state_version;
+   }
+
+   /*! @brief Determine if the state needs to be sent, either because it was
+    *  never sent, the maximum send interval elapsed, or the extrapolation of
+    *  the last sent state is out of tolerance.
+    *  @return True if the state should be packed and sent. */
+   bool const is_send_due();
+
+  public:
+   bool   send_changes_only;  ///< @trick_units{--} Only pack and send the state when it changed beyond the tolerances, default is false.
+   double position_tolerance; ///< @trick_units{m} Extrapolated position error that triggers a send.
+   double attitude_tolerance; ///< @trick_units{rad} Extrapolated attitude error that triggers a send.
+   double max_send_interval;  ///< @trick_units{s} Maximum scenario time between sends, zero for no limit.
+
+   int64_t skipped_pack_count; ///< @trick_units{count} Number of times the state pack was skipped.
+
   protected:
    jeod::TimeTT        *time_tt;         ///< trick_units{--}  JEOD TT time standard.
    jeod::RefFrameState *ref_frame_state; ///< @trick_units{--} JEOD reference frame state.
 
+   int64_t state_version; ///< @trick_units{--} Version of the JEOD reference frame state.
+   int64_t sent_version;  ///< @trick_units{--} State version that was last sent.
+   bool    state_sent;    ///< @trick_units{--} True once the state has been sent.
+
+   SpaceTimeCoordinateData observed_state; ///< @trick_io{**} JEOD state at the last version check.
+   SpaceTimeCoordinateData sent_state;     ///< @trick_io{**} Packed state that was last sent.
+
   private:
    // This object is not copyable
    /*! @brief Copy constructor for JEODRefFrameState class.
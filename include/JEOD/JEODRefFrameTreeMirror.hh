@@ -0,0 +1,137 @@
+/*!
+@file JEOD/JEODRefFrameTreeMirror.hh
+@ingroup JEOD
+@brief This class mirrors a JEOD reference frame tree into a set of SpaceFOM
+Reference Frames.
+
+The SpaceFOM reference frame parents are derived from the JEOD reference
+frame hierarchy, where the parent of a mirrored frame is its nearest JEOD
+ancestor that is also mirrored. The mirror computes the frame states each
+cycle and turns on change tracking so that only frames whose state changed
+beyond the configured tolerances are packed and sent.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../source/JEOD/JEODRefFrameState.cpp}
+@trick_link_dependency{../../source/JEOD/JEODRefFrameTreeMirror.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_JEOD_REF_FRAME_TREE_MIRROR_HH
+#define SPACEFOM_JEOD_REF_FRAME_TREE_MIRROR_HH
+
+// System include files.
+#include <string>
+#include <vector>
+
+// JEOD include files.
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+
+// SpaceFOM include files.
+#include "JEOD/JEODRefFrameState.hh"
+
+namespace SpaceFOM
+{
+
+class JEODRefFrameTreeMirror
+{
+
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__JEODRefFrameTreeMirror();
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the SpaceFOM JEODRefFrameTreeMirror class. */
+   JEODRefFrameTreeMirror();
+   /*! @brief Destructor for the SpaceFOM JEODRefFrameTreeMirror class. */
+   virtual ~JEODRefFrameTreeMirror();
+
+   /*! @brief Add a SpaceFOM reference frame that mirrors a JEOD reference frame.
+    *  @param frame_ptr       Pointer to the SpaceFOM reference frame.
+    *  @param jeod_frame_name Name of the JEOD reference frame to mirror.
+    *  @return True if the frame was added, false otherwise. */
+   bool add_frame( JEODRefFrameState *frame_ptr,
+                   char const        *jeod_frame_name );
+
+   /*! @brief Find the JEOD reference frames, subscribe to them, and set the
+    *  SpaceFOM parent frames from the JEOD reference frame hierarchy.
+    *  @details This must run after the JEOD dynamics manager is initialized
+    *  and before the SpaceFOM reference frame tree is built.
+    *  @param dyn_manager JEOD dynamics manager used to find the frames. */
+   void build( jeod::DynManager &dyn_manager );
+
+   /*! @brief Update the states of all the mirrored reference frames. */
+   void update();
+
+   /*! @brief Get the number of mirrored reference frames.
+    *  @return Number of mirrored reference frames. */
+   unsigned int get_frame_count() const
+   {
+      return frames.size();
+   }
+
+   /*! @brief Get the SpaceFOM root reference frame of the mirrored tree.
+    *  @return Root reference frame, or NULL if the tree is not built. */
+   JEODRefFrameState *get_root_frame()
+   {
+      return root_frame;
+   }
+
+  public:
+   bool debug; ///< @trick_units{--} Debug output flag.
+
+   bool   send_changes_only;  ///< @trick_units{--} Only pack and send frames whose state changed beyond the tolerances, default is true.
+   double position_tolerance; ///< @trick_units{m} Extrapolated position error that triggers a send.
+   double attitude_tolerance; ///< @trick_units{rad} Extrapolated attitude error that triggers a send.
+   double max_send_interval;  ///< @trick_units{s} Maximum scenario time between sends, zero for no limit.
+
+  protected:
+   bool built; ///< @trick_units{--} True once the tree has been built.
+
+   JEODRefFrameState *root_frame; ///< @trick_units{--} Root reference frame of the mirrored tree.
+
+   std::vector< JEODRefFrameState * > frames;           ///< @trick_io{**} Mirrored SpaceFOM reference frames.
+   std::vector< std::string >         jeod_frame_names; ///< @trick_io{**} Names of the mirrored JEOD reference frames.
+   std::vector< jeod::RefFrame * >    jeod_frames;      ///< @trick_io{**} Mirrored JEOD reference frames.
+   std::vector< jeod::RefFrame * >    jeod_parents;     ///< @trick_io{**} JEOD reference frames mirrored by the parent frames.
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for JEODRefFrameTreeMirror class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   JEODRefFrameTreeMirror( JEODRefFrameTreeMirror const &rhs );
+   /*! @brief Assignment operator for JEODRefFrameTreeMirror class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   JEODRefFrameTreeMirror &operator=( JEODRefFrameTreeMirror const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_JEOD_REF_FRAME_TREE_MIRROR_HH: Do NOT put anything after this line!
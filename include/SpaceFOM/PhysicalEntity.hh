@@ -78,6 +78,12 @@ class PhysicalEntity : virtual public SpaceFOM::PhysicalEntityBase
    /*! @brief Initialize the packing object. */
    virtual void initialize();
 
+   /*! @brief Create a new PhysicalEntity packing object for an object instantiated
+    *  from a TrickHLA::ObjectTemplate.
+    *  @return New packing instance, or NULL on an allocation error.
+    *  @param instance_name Trick variable name for the new instance. */
+   virtual TrickHLA::Packing *create_template_instance( char const *instance_name );
+
    /*! @brief Packs the packing data object from the working data object(s),
     *  @details Called from the pack() function to pack the data from the working
     *  data objects(s) into the pe_packing_data object.  */
@@ -69,6 +69,15 @@ class PhysicalEntityLagComp : public PhysicalEntityLagCompInteg
    /*! @brief Entity instance initialization routine. */
    virtual void initialize();
 
+   /*! @brief Create a new PhysicalEntityLagComp for an object instantiated from a
+    *  TrickHLA::ObjectTemplate.
+    *  @return New lag compensation instance, or NULL on an error.
+    *  @param instance_name Trick variable name for the new instance.
+    *  @param inst_packing  PhysicalEntity packing instance to compensate. */
+   virtual TrickHLA::LagCompensation *create_template_instance(
+      char const        *instance_name,
+      TrickHLA::Packing *inst_packing );
+
   protected:
    double *integ_states[13]; ///< @trick_units{--} @trick_io{**} Integration states.
 
@@ -0,0 +1,171 @@
+/*!
+@file SpaceFOM/PhysicalEntityLagCompInterp.hh
+@ingroup SpaceFOM
+@brief Definition of the TrickHLA SpaceFOM physical entity latency/lag
+compensation class that interpolates a history of received states.
+
+This is a receive side lag compensation for federates, such as visualization
+and sensor federates, that run at a different rate than the publisher. The
+last received time-tagged states are kept in a ring and the state at any
+requested time is interpolated between the two bracketing states, linearly
+for the position, velocity and angular velocity vectors and with a spherical
+linear interpolation (slerp) for the attitude quaternion.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../source/SpaceFOM/PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{../../source/SpaceFOM/PhysicalEntityLagCompInterp.cpp}
+@trick_link_dependency{../../source/SpaceFOM/QuaternionData.cpp}
+@trick_link_dependency{../../source/SpaceFOM/SpaceTimeCoordinateData.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_INTERP_HH
+#define SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_INTERP_HH
+
+// System include files.
+
+// Trick includes.
+
+// TrickHLA include files.
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalEntityLagCompBase.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+namespace SpaceFOM
+{
+
+class PhysicalEntityLagCompInterp : public PhysicalEntityLagCompBase
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__PhysicalEntityLagCompInterp();
+
+  public:
+   int    history_size; ///< @trick_units{count} Number of received states kept in the history ring (default: 8).
+   double interp_delay; ///< @trick_units{s} Delay of the sample time behind the scenario time so the sample is bracketed by received states, where a negative value uses one data cycle of the object measured between the two newest received states (default: -1.0).
+
+  public:
+   // Public constructors and destructors.
+   explicit PhysicalEntityLagCompInterp( PhysicalEntityBase &entity_ref ); // Initialization constructor.
+   virtual ~PhysicalEntityLagCompInterp();                                 // Destructor.
+
+   /*! @brief Entity instance initialization routine. */
+   virtual void initialize();
+
+   /*! @brief Create a new PhysicalEntityLagCompInterp for an object instantiated from a
+    *  TrickHLA::ObjectTemplate.
+    *  @return New lag compensation instance, or NULL on an error.
+    *  @param instance_name Trick variable name for the new instance.
+    *  @param inst_packing  PhysicalEntity packing instance to compensate. */
+   virtual TrickHLA::LagCompensation *create_template_instance(
+      char const        *instance_name,
+      TrickHLA::Packing *inst_packing );
+
+   /*! @brief Sending side latency compensation callback interface from the
+    *  TrickHLALagCompensation class. */
+   virtual void send_lag_compensation();
+
+   /*! @brief Bypass the send side lag compensation, which still tracks the
+    *  ownership of the state attribute. */
+   virtual void bypass_send_lag_compensation();
+
+   /*! @brief Receive side latency compensation callback interface from the
+    *  TrickHLALagCompensation class. */
+   virtual void receive_lag_compensation();
+
+   /*! @brief Sample the state at a time by interpolating the two bracketing
+    *  received states. A time outside of the history is held at the oldest
+    *  or newest received state.
+    *  @return True if the time is bracketed by the history, false otherwise.
+    *  @param time  Time to sample the state at.
+    *  @param state Sampled state. */
+   bool sample_state( double const             time,
+                      SpaceTimeCoordinateData &state ) const;
+
+   /*! @brief Clear the history of received states. */
+   void clear_history();
+
+   /*! @brief Get the number of received states in the history.
+    *  @return Number of received states in the history. */
+   int get_history_count() const
+   {
+      return history_count;
+   }
+
+   /*! @brief Get the delay of the sample time behind the scenario time.
+    *  @return The interp_delay, or one data cycle of the object when the
+    *  interp_delay is negative. */
+   double get_interp_delay() const;
+
+  protected:
+   SpaceTimeCoordinateData *history; ///< @trick_units{--} Ring of received time-tagged states.
+
+   int history_count;  ///< @trick_units{count} Number of received states in the history ring.
+   int history_newest; ///< @trick_units{--} Index of the newest received state in the history ring.
+
+   bool state_locally_owned; ///< @trick_units{--} Was the state attribute locally owned when last checked?
+
+   /*! @brief Clear the history when the ownership of the state attribute
+    *  changed, since the received states are then stale. */
+   void check_state_ownership();
+
+   /*! @brief Add a received state to the history ring, replacing the oldest
+    *  state when the ring is full.
+    *  @param state Received time-tagged state. */
+   void add_to_history( SpaceTimeCoordinateData const &state );
+
+   /*! @brief Get a state in the history ring in time order.
+    *  @return The state at the position from the oldest state.
+    *  @param k Position from the oldest state, from 0 to history_count - 1. */
+   SpaceTimeCoordinateData const &history_at( int const k ) const
+   {
+      return history[( history_newest + 1 + history_size - history_count + k ) % history_size];
+   }
+
+   /*! @brief Compensate the state data from the data time to the current scenario time.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step. */
+   virtual int compensate(
+      const double t_begin,
+      const double t_end );
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for PhysicalEntityLagCompInterp class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   PhysicalEntityLagCompInterp( PhysicalEntityLagCompInterp const &rhs );
+   /*! @brief Assignment operator for PhysicalEntityLagCompInterp class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   PhysicalEntityLagCompInterp &operator=( PhysicalEntityLagCompInterp const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_INTERP_HH: Do NOT put anything after this line!
@@ -163,6 +163,16 @@ class QuaternionData
       double                left[3],
       QuaternionData const &right );
 
+   /*! @brief Spherical linear interpolation (slerp) between two attitude
+    *  quaternions, taking the shortest path between the attitudes.
+    *  @param q_begin  Attitude quaternion at fraction 0.
+    *  @param q_end    Attitude quaternion at fraction 1.
+    *  @param fraction Interpolation fraction from 0 to 1. */
+   void slerp(
+      QuaternionData const &q_begin,
+      QuaternionData const &q_end,
+      double const          fraction );
+
    /*! @brief Compute the first time derivative of the attitude quaternion.
     *  @param quat  Attitude quaternion.
     *  @param omega Angular velocity vector. */
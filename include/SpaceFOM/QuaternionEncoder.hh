@@ -26,6 +26,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Encode with the generated SpaceFOM codec.}
 @revs_end
 
 */
@@ -39,18 +40,6 @@ NASA, Johnson Space Center\n
 // SpaceFOM include files.
 #include "SpaceFOM/QuaternionData.hh"
 
-// C++11 deprecated dynamic exception specifications for a function so we need
-// to silence the warnings coming from the IEEE 1516 declared functions.
-// This should work for both GCC and Clang.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdeprecated"
-// HLA include files.
-#include RTI1516_HEADER
-#include "RTI/encoding/BasicDataElements.h"
-#include "RTI/encoding/HLAfixedArray.h"
-#include "RTI/encoding/HLAfixedRecord.h"
-#pragma GCC diagnostic pop
-
 // Put this class in the SpaceFOM namespace.
 namespace SpaceFOM
 {
@@ -87,12 +76,6 @@ class QuaternionEncoder : public TrickHLA::OpaqueBuffer
   protected:
    QuaternionData &data; ///< @trick_units{--} Quaternion transmission data.
 
-   // Data encoding helpers.
-   rti1516e::HLAfloat64LE   scalar_encoder; ///< @trick_io{**} Quaternion scalar encoder
-   rti1516e::HLAfloat64LE   vector[3];      ///< @trick_io{**} HLAfloat64LE quaternion vector
-   rti1516e::HLAfixedArray  vector_encoder; ///< @trick_io{**} Quaternion vector encoder
-   rti1516e::HLAfixedRecord encoder;        ///< @trick_io{**} Attitude quaternion encoder
-
   private:
    // This object is not copyable
    /*! @brief Copy constructor for QuaternionEncoder class.
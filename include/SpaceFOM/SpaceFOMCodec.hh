@@ -0,0 +1,406 @@
+/*!
+@file SpaceFOM/SpaceFOMCodec.hh
+@ingroup SpaceFOM
+@brief HLA data types and encode/decode functions generated from the
+FOM datatypes in:
+  FOMs/SpaceFOM/SISO_SpaceFOM_datatypes.xml
+
+This file was generated by scripts/generate_fom_codec.py, do not edit it.
+The fixed size datatypes are encoded with constant offsets and no memory
+allocation, the variable arrays use std::string, std::wstring or std::vector.
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+*/
+
+#ifndef SPACEFOM_SPACEFOMCODEC_HH
+#define SPACEFOM_SPACEFOMCODEC_HH
+
+// System include files.
+#include <cstdint>
+#include <cstring>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#ifndef TRICKHLA_FOM_CODEC_BASICS
+#define TRICKHLA_FOM_CODEC_BASICS
+
+namespace TrickHLA
+{
+namespace FOMCodec
+{
+
+// The bytes are assembled with shifts so the byte order is fixed at compile
+// time and there is no run time byte swapping decision.
+
+constexpr size_t pad_to( size_t const pos, size_t const boundary )
+{
+   return ( ( pos + boundary - 1 ) / boundary ) * boundary;
+}
+
+inline void zero_pad( unsigned char *buffer, size_t &pos, size_t const boundary )
+{
+   size_t const end = pad_to( pos, boundary );
+   while ( pos < end ) {
+      buffer[pos++] = 0;
+   }
+}
+
+inline void put_octet( unsigned char *p, unsigned char const v )
+{
+   p[0] = v;
+}
+
+inline unsigned char get_octet( unsigned char const *p )
+{
+   return p[0];
+}
+
+inline void put_uint16_be( unsigned char *p, uint16_t const v )
+{
+   p[0] = (unsigned char)( v >> 8 );
+   p[1] = (unsigned char)v;
+}
+
+inline void put_uint16_le( unsigned char *p, uint16_t const v )
+{
+   p[0] = (unsigned char)v;
+   p[1] = (unsigned char)( v >> 8 );
+}
+
+inline uint16_t get_uint16_be( unsigned char const *p )
+{
+   return (uint16_t)( ( (uint16_t)p[0] << 8 ) | (uint16_t)p[1] );
+}
+
+inline uint16_t get_uint16_le( unsigned char const *p )
+{
+   return (uint16_t)( ( (uint16_t)p[1] << 8 ) | (uint16_t)p[0] );
+}
+
+inline void put_uint32_be( unsigned char *p, uint32_t const v )
+{
+   put_uint16_be( p, (uint16_t)( v >> 16 ) );
+   put_uint16_be( p + 2, (uint16_t)v );
+}
+
+inline void put_uint32_le( unsigned char *p, uint32_t const v )
+{
+   put_uint16_le( p, (uint16_t)v );
+   put_uint16_le( p + 2, (uint16_t)( v >> 16 ) );
+}
+
+inline uint32_t get_uint32_be( unsigned char const *p )
+{
+   return ( (uint32_t)get_uint16_be( p ) << 16 ) | (uint32_t)get_uint16_be( p + 2 );
+}
+
+inline uint32_t get_uint32_le( unsigned char const *p )
+{
+   return ( (uint32_t)get_uint16_le( p + 2 ) << 16 ) | (uint32_t)get_uint16_le( p );
+}
+
+inline void put_uint64_be( unsigned char *p, uint64_t const v )
+{
+   put_uint32_be( p, (uint32_t)( v >> 32 ) );
+   put_uint32_be( p + 4, (uint32_t)v );
+}
+
+inline void put_uint64_le( unsigned char *p, uint64_t const v )
+{
+   put_uint32_le( p, (uint32_t)v );
+   put_uint32_le( p + 4, (uint32_t)( v >> 32 ) );
+}
+
+inline uint64_t get_uint64_be( unsigned char const *p )
+{
+   return ( (uint64_t)get_uint32_be( p ) << 32 ) | (uint64_t)get_uint32_be( p + 4 );
+}
+
+inline uint64_t get_uint64_le( unsigned char const *p )
+{
+   return ( (uint64_t)get_uint32_le( p + 4 ) << 32 ) | (uint64_t)get_uint32_le( p );
+}
+
+inline void put_int16_be( unsigned char *p, int16_t const v )
+{
+   put_uint16_be( p, (uint16_t)v );
+}
+
+inline void put_int16_le( unsigned char *p, int16_t const v )
+{
+   put_uint16_le( p, (uint16_t)v );
+}
+
+inline int16_t get_int16_be( unsigned char const *p )
+{
+   return (int16_t)get_uint16_be( p );
+}
+
+inline int16_t get_int16_le( unsigned char const *p )
+{
+   return (int16_t)get_uint16_le( p );
+}
+
+inline void put_int32_be( unsigned char *p, int32_t const v )
+{
+   put_uint32_be( p, (uint32_t)v );
+}
+
+inline void put_int32_le( unsigned char *p, int32_t const v )
+{
+   put_uint32_le( p, (uint32_t)v );
+}
+
+inline int32_t get_int32_be( unsigned char const *p )
+{
+   return (int32_t)get_uint32_be( p );
+}
+
+inline int32_t get_int32_le( unsigned char const *p )
+{
+   return (int32_t)get_uint32_le( p );
+}
+
+inline void put_int64_be( unsigned char *p, int64_t const v )
+{
+   put_uint64_be( p, (uint64_t)v );
+}
+
+inline void put_int64_le( unsigned char *p, int64_t const v )
+{
+   put_uint64_le( p, (uint64_t)v );
+}
+
+inline int64_t get_int64_be( unsigned char const *p )
+{
+   return (int64_t)get_uint64_be( p );
+}
+
+inline int64_t get_int64_le( unsigned char const *p )
+{
+   return (int64_t)get_uint64_le( p );
+}
+
+inline void put_float32_be( unsigned char *p, float const v )
+{
+   uint32_t u;
+   memcpy( &u, &v, sizeof( u ) );
+   put_uint32_be( p, u );
+}
+
+inline void put_float32_le( unsigned char *p, float const v )
+{
+   uint32_t u;
+   memcpy( &u, &v, sizeof( u ) );
+   put_uint32_le( p, u );
+}
+
+inline float get_float32_be( unsigned char const *p )
+{
+   uint32_t const u = get_uint32_be( p );
+   float          v;
+   memcpy( &v, &u, sizeof( v ) );
+   return v;
+}
+
+inline float get_float32_le( unsigned char const *p )
+{
+   uint32_t const u = get_uint32_le( p );
+   float          v;
+   memcpy( &v, &u, sizeof( v ) );
+   return v;
+}
+
+inline void put_float64_be( unsigned char *p, double const v )
+{
+   uint64_t u;
+   memcpy( &u, &v, sizeof( u ) );
+   put_uint64_be( p, u );
+}
+
+inline void put_float64_le( unsigned char *p, double const v )
+{
+   uint64_t u;
+   memcpy( &u, &v, sizeof( u ) );
+   put_uint64_le( p, u );
+}
+
+inline double get_float64_be( unsigned char const *p )
+{
+   uint64_t const u = get_uint64_be( p );
+   double         v;
+   memcpy( &v, &u, sizeof( v ) );
+   return v;
+}
+
+inline double get_float64_le( unsigned char const *p )
+{
+   uint64_t const u = get_uint64_le( p );
+   double         v;
+   memcpy( &v, &u, sizeof( v ) );
+   return v;
+}
+
+} // namespace FOMCodec
+} // namespace TrickHLA
+
+#endif // TRICKHLA_FOM_CODEC_BASICS
+
+namespace SpaceFOMCodec
+{
+
+// Scalar
+/*! @brief FOM simple datatype 'Scalar'. A unitless scalar value. */
+typedef double Scalar;
+
+constexpr size_t Scalar_ENCODED_SIZE   = 8; ///< Encoded size of Scalar in bytes.
+constexpr size_t Scalar_OCTET_BOUNDARY = 8; ///< Octet boundary of Scalar.
+
+/*! @brief Encode Scalar at an aligned pointer, with room for Scalar_ENCODED_SIZE bytes. */
+inline void put_Scalar( unsigned char *p, Scalar const &value )
+{
+   TrickHLA::FOMCodec::put_float64_le( p, value );
+}
+
+/*! @brief Decode Scalar at an aligned pointer, with Scalar_ENCODED_SIZE bytes available. */
+inline void get_Scalar( unsigned char const *p, Scalar &value )
+{
+   value = TrickHLA::FOMCodec::get_float64_le( p );
+}
+
+/*! @brief Get the buffer position after Scalar is encoded at pos. */
+constexpr size_t encoded_size_Scalar( Scalar const &, size_t const pos = 0 )
+{
+   return TrickHLA::FOMCodec::pad_to( pos, Scalar_OCTET_BOUNDARY ) + Scalar_ENCODED_SIZE;
+}
+
+/*! @brief Encode Scalar at pos, which is advanced past the encoded value. */
+inline void encode_Scalar( unsigned char *buffer, size_t &pos, Scalar const &value )
+{
+   TrickHLA::FOMCodec::zero_pad( buffer, pos, 8 );
+   put_Scalar( buffer + pos, value );
+   pos += 8;
+}
+
+/*! @brief Decode Scalar at pos, which is advanced past the decoded value.
+ *  @return False if the buffer is too small. */
+inline bool decode_Scalar( unsigned char const *buffer, size_t const size, size_t &pos, Scalar &value )
+{
+   size_t const start = TrickHLA::FOMCodec::pad_to( pos, 8 );
+   if ( ( start + 8 ) > size ) {
+      return false;
+   }
+   get_Scalar( buffer + start, value );
+   pos = start + 8;
+   return true;
+}
+
+// Vector
+/*! @brief FOM fixed array datatype 'Vector'. A unitless 3-vector. */
+typedef Scalar Vector[3];
+
+constexpr size_t Vector_ENCODED_SIZE   = 24; ///< Encoded size of Vector in bytes.
+constexpr size_t Vector_OCTET_BOUNDARY = 8; ///< Octet boundary of Vector.
+
+/*! @brief Encode Vector at an aligned pointer, with room for Vector_ENCODED_SIZE bytes. */
+inline void put_Vector( unsigned char *p, Vector const &value )
+{
+   for ( size_t i = 0; i < 3; ++i ) {
+      TrickHLA::FOMCodec::put_float64_le( p + ( i * 8 ), value[i] );
+   }
+}
+
+/*! @brief Decode Vector at an aligned pointer, with Vector_ENCODED_SIZE bytes available. */
+inline void get_Vector( unsigned char const *p, Vector &value )
+{
+   for ( size_t i = 0; i < 3; ++i ) {
+      value[i] = TrickHLA::FOMCodec::get_float64_le( p + ( i * 8 ) );
+   }
+}
+
+/*! @brief Get the buffer position after Vector is encoded at pos. */
+constexpr size_t encoded_size_Vector( Vector const &, size_t const pos = 0 )
+{
+   return TrickHLA::FOMCodec::pad_to( pos, Vector_OCTET_BOUNDARY ) + Vector_ENCODED_SIZE;
+}
+
+/*! @brief Encode Vector at pos, which is advanced past the encoded value. */
+inline void encode_Vector( unsigned char *buffer, size_t &pos, Vector const &value )
+{
+   TrickHLA::FOMCodec::zero_pad( buffer, pos, 8 );
+   put_Vector( buffer + pos, value );
+   pos += 24;
+}
+
+/*! @brief Decode Vector at pos, which is advanced past the decoded value.
+ *  @return False if the buffer is too small. */
+inline bool decode_Vector( unsigned char const *buffer, size_t const size, size_t &pos, Vector &value )
+{
+   size_t const start = TrickHLA::FOMCodec::pad_to( pos, 8 );
+   if ( ( start + 24 ) > size ) {
+      return false;
+   }
+   get_Vector( buffer + start, value );
+   pos = start + 24;
+   return true;
+}
+
+// AttitudeQuaternion
+/*! @brief FOM fixed record datatype 'AttitudeQuaternion'. This is a quaternion quantifying the orientation of a 'subject' reference frame with respect to some other 'referent' frame. */
+typedef struct {
+   Scalar scalar; ///< @trick_units{--} scalar
+   Vector vector; ///< @trick_units{--} vector
+} AttitudeQuaternion;
+
+constexpr size_t AttitudeQuaternion_ENCODED_SIZE   = 32; ///< Encoded size of AttitudeQuaternion in bytes.
+constexpr size_t AttitudeQuaternion_OCTET_BOUNDARY = 8; ///< Octet boundary of AttitudeQuaternion.
+constexpr size_t AttitudeQuaternion_scalar_OFFSET = 0; ///< Offset of the scalar field in bytes.
+constexpr size_t AttitudeQuaternion_vector_OFFSET = 8; ///< Offset of the vector field in bytes.
+
+/*! @brief Encode AttitudeQuaternion at an aligned pointer, with room for AttitudeQuaternion_ENCODED_SIZE bytes. */
+inline void put_AttitudeQuaternion( unsigned char *p, AttitudeQuaternion const &value )
+{
+   TrickHLA::FOMCodec::put_float64_le( p + AttitudeQuaternion_scalar_OFFSET, value.scalar );
+   put_Vector( p + AttitudeQuaternion_vector_OFFSET, value.vector );
+}
+
+/*! @brief Decode AttitudeQuaternion at an aligned pointer, with AttitudeQuaternion_ENCODED_SIZE bytes available. */
+inline void get_AttitudeQuaternion( unsigned char const *p, AttitudeQuaternion &value )
+{
+   value.scalar = TrickHLA::FOMCodec::get_float64_le( p + AttitudeQuaternion_scalar_OFFSET );
+   get_Vector( p + AttitudeQuaternion_vector_OFFSET, value.vector );
+}
+
+/*! @brief Get the buffer position after AttitudeQuaternion is encoded at pos. */
+constexpr size_t encoded_size_AttitudeQuaternion( AttitudeQuaternion const &, size_t const pos = 0 )
+{
+   return TrickHLA::FOMCodec::pad_to( pos, AttitudeQuaternion_OCTET_BOUNDARY ) + AttitudeQuaternion_ENCODED_SIZE;
+}
+
+/*! @brief Encode AttitudeQuaternion at pos, which is advanced past the encoded value. */
+inline void encode_AttitudeQuaternion( unsigned char *buffer, size_t &pos, AttitudeQuaternion const &value )
+{
+   TrickHLA::FOMCodec::zero_pad( buffer, pos, 8 );
+   put_AttitudeQuaternion( buffer + pos, value );
+   pos += 32;
+}
+
+/*! @brief Decode AttitudeQuaternion at pos, which is advanced past the decoded value.
+ *  @return False if the buffer is too small. */
+inline bool decode_AttitudeQuaternion( unsigned char const *buffer, size_t const size, size_t &pos, AttitudeQuaternion &value )
+{
+   size_t const start = TrickHLA::FOMCodec::pad_to( pos, 8 );
+   if ( ( start + 32 ) > size ) {
+      return false;
+   }
+   get_AttitudeQuaternion( buffer + start, value );
+   pos = start + 32;
+   return true;
+}
+
+} // namespace SpaceFOMCodec
+
+#endif // SPACEFOM_SPACEFOMCODEC_HH: Do NOT put anything after this line!
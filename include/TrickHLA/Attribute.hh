@@ -22,6 +22,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{../../source/TrickHLA/Attribute.cpp}
 @trick_link_dependency{../../source/TrickHLA/Conditional.cpp}
+@trick_link_dependency{../../source/TrickHLA/SharedMemoryChannel.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 @trick_link_dependency{../../source/TrickHLA/Utilities.cpp}
 
@@ -48,6 +49,7 @@ NASA, Johnson Space Center\n
 // TrickHLA include files.
 #include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/Conditional.hh"
+#include "TrickHLA/SharedMemoryChannel.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
@@ -64,6 +66,11 @@ NASA, Johnson Space Center\n
 namespace TrickHLA
 {
 
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class MemoryUsage;
+
 class Attribute
 {
    // Let the Trick input processor access protected and private data.
@@ -96,6 +103,16 @@ class Attribute
 
    double cycle_time; ///< @trick_units{s} Send the cyclic attribute at the specified rate.
 
+   SendPriorityEnum send_priority; ///< @trick_units{--} Priority used to degrade the send rate when over the send/receive budget (default: SEND_PRIORITY_OBJECT).
+
+   // The shared-memory side channel only holds the last two values written.
+   // A subscriber that falls further behind, such as one that queues
+   // Timestamp Order updates, loses the overwritten values. Each lost value
+   // is reported and the subscriber then falls back to the FOM encoded value.
+   bool   shared_memory;          ///< @trick_units{--}    True to also send the values to federates on the same host through shared memory (default: false).
+   char  *shared_memory_FOM_name; ///< @trick_units{--}    FOM name of the HLAopaqueData attribute of the same class that carries the shared-memory descriptor, required if shared_memory is true.
+   size_t shared_memory_capacity; ///< @trick_units{count} Initial capacity in bytes of each of the two shared-memory buffers, zero to size them from the first value (default: 0).
+
    //--------------------------------------------------------------------------
 
    //--------------------------------------------------------------------------
@@ -119,6 +136,11 @@ class Attribute
                     int const   object_index,
                     int const   attribute_index );
 
+   /*! @brief Set the usage the attribute buffer is accounted to, moving any
+    * buffer already allocated over to it.
+    *  @param owner Memory usage of the parent object. */
+   void set_memory_owner( MemoryUsage *owner );
+
    /*! @brief Get the reflection rate configuration type.
     *  @return The reflection rate configuration type enumeration value. */
    DataUpdateEnum const get_configuration() const
@@ -148,6 +170,11 @@ class Attribute
     *  @return The attribute value that contains the buffer of the encoded attribute. */
    RTI1516_NAMESPACE::VariableLengthData get_attribute_value();
 
+   /*! @brief Point the attribute value at the buffer of the encoded attribute
+    * without copying it, so the buffer must not change until the value is sent.
+    *  @param value The attribute value to point at the encoded attribute. */
+   void get_attribute_value_pointer( RTI1516_NAMESPACE::VariableLengthData &value );
+
    /*! @brief Extract the data out of the HLA Attribute Value.
     *  @param attr_value The variable length data buffer containing the attribute value.
     *  @return True if successfully extracted data, false otherwise. */
@@ -312,20 +339,155 @@ class Attribute
     *  @return True if the data cycle is ready for a send, false otherwise.*/
    bool is_data_cycle_ready() const
    {
-      return ( ( cycle_ratio <= 1 ) || ( cycle_cnt <= 0 ) );
+      return ( ( get_effective_cycle_ratio() <= 1 ) || ( cycle_cnt <= 0 ) );
    }
 
    /*! @brief Determine is the data cycle is ready for sending data.
     *  @return True if the data cycle is ready for a send, false otherwise.*/
    bool const check_data_cycle_ready() // RETURN: -- True if the data cycle is ready for a send, false otherwise.
    {
-      if ( ( cycle_ratio <= 1 ) || ( ( ++cycle_cnt ) >= cycle_ratio ) ) {
+      int const ratio = get_effective_cycle_ratio();
+      if ( ( ratio <= 1 ) || ( ( ++cycle_cnt ) >= ratio ) ) {
          cycle_cnt = 0;
          return true;
       }
+      if ( ( cycle_ratio <= 1 ) || ( ( cycle_cnt % cycle_ratio ) == 0 ) ) {
+         // Would have been sent if the send rate was not degraded.
+         ++dropped_send_count;
+      }
       return false;
    }
 
+   /*! @brief Advance the sub-rate cycle counter for data cycles in which the
+    * check for a ready data cycle was not performed.
+    *  @param skipped_cycles Number of data cycles that were skipped. */
+   void skip_data_cycles( int const skipped_cycles )
+   {
+      if ( ( get_effective_cycle_ratio() > 1 ) && ( skipped_cycles > 0 ) ) {
+         if ( cycle_ratio_scale > 1 ) {
+            // Count the skipped cycles the data would have been sent on if
+            // the send rate was not degraded.
+            int const ratio = ( cycle_ratio > 1 ) ? cycle_ratio : 1;
+            dropped_send_count += ( ( cycle_cnt + skipped_cycles ) / ratio ) - ( cycle_cnt / ratio );
+         }
+         cycle_cnt += skipped_cycles;
+      }
+   }
+
+   /*! @brief Get the number of data cycle checks until the data cycle is
+    * ready for sending data.
+    *  @return Number of data cycles until the next ready data cycle. */
+   int get_data_cycles_until_ready() const
+   {
+      int const ratio = get_effective_cycle_ratio();
+      return ( ( ratio <= 1 ) || ( cycle_cnt >= ratio ) ) ? 1 : ( ratio - cycle_cnt );
+   }
+
+   /*! @brief Get the cycle ratio with any send rate degradation applied.
+    *  @return Effective ratio of the attribute cycle-time to the core job cycle time. */
+   int get_effective_cycle_ratio() const
+   {
+      return ( ( cycle_ratio > 1 ) ? cycle_ratio : 1 ) * cycle_ratio_scale;
+   }
+
+   /*! @brief Set the factor the cycle ratio is stretched by to degrade the
+    * send rate, where a scale of 1 is the configured send rate.
+    *  @param scale Cycle ratio scale factor. */
+   void set_cycle_ratio_scale( int const scale )
+   {
+      this->cycle_ratio_scale = ( scale > 1 ) ? scale : 1;
+   }
+
+   /*! @brief Get the factor the cycle ratio is stretched by to degrade the send rate.
+    *  @return Cycle ratio scale factor, 1 if the send rate is not degraded. */
+   int get_cycle_ratio_scale() const
+   {
+      return cycle_ratio_scale;
+   }
+
+   /*! @brief Get the number of sends dropped because the send rate was degraded.
+    *  @return Number of dropped sends. */
+   unsigned long long get_dropped_send_count() const
+   {
+      return dropped_send_count;
+   }
+
+   /*! @brief Determine if the attribute is configured for the shared-memory
+    *  side channel.
+    *  @return True if the shared-memory side channel is configured. */
+   bool const is_shared_memory() const
+   {
+      return shared_memory;
+   }
+
+   /*! @brief Determine if the values are received through shared memory.
+    *  @return True if the shared-memory side channel is configured and this
+    *  subscriber has not fallen back to the FOM encoded value. */
+   bool const is_shared_memory_enabled() const
+   {
+      return ( shared_memory && !shared_memory_inline );
+   }
+
+   /*! @brief Get the FOM name of the attribute carrying the shared-memory
+    *  descriptor.
+    *  @return The descriptor attribute FOM name. */
+   char const *get_shared_memory_FOM_name() const
+   {
+      return shared_memory_FOM_name;
+   }
+
+   /*! @brief Get the RTI handle of the attribute carrying the shared-memory
+    *  descriptor.
+    *  @return The descriptor AttributeHandle. */
+   RTI1516_NAMESPACE::AttributeHandle get_shared_memory_attribute_handle() const
+   {
+      return this->shm_attr_handle;
+   }
+
+   /*! @brief Set the RTI handle of the attribute carrying the shared-memory
+    *  descriptor.
+    *  @param id The descriptor AttributeHandle. */
+   void set_shared_memory_attribute_handle( RTI1516_NAMESPACE::AttributeHandle id )
+   {
+      this->shm_attr_handle = id;
+   }
+
+   /*! @brief Write the value into the shared-memory side channel.
+    *  @return A copy of the descriptor to send in the descriptor attribute. */
+   RTI1516_NAMESPACE::VariableLengthData get_shared_memory_value();
+
+   /*! @brief Write the value into the shared-memory side channel and point
+    *  the given value at the descriptor without copying it.
+    *  @param value The attribute value to point at the descriptor. */
+   void get_shared_memory_value_pointer( RTI1516_NAMESPACE::VariableLengthData &value );
+
+   /*! @brief Extract the value a received shared-memory descriptor refers to.
+    *  @return True if the value was read and extracted, false otherwise.
+    *  @param attr_value The received descriptor attribute value. */
+   bool extract_shared_memory_data( RTI1516_NAMESPACE::VariableLengthData const *attr_value );
+
+   /*! @brief Determine if this subscriber needs to subscribe to the FOM
+    *  encoded value because it can not read the shared-memory side channel.
+    *  @return True if the fallback subscription is pending. */
+   bool const is_shared_memory_inline_pending() const
+   {
+      return shared_memory_inline_pending;
+   }
+
+   /*! @brief Clear the pending fallback subscription to the FOM encoded value. */
+   void clear_shared_memory_inline_pending()
+   {
+      this->shared_memory_inline_pending = false;
+   }
+
+   /*! @brief Get the number of received shared-memory values that were
+    *  overwritten before they could be read.
+    *  @return Number of stale shared-memory values. */
+   unsigned long long get_shared_memory_stale_count() const
+   {
+      return shared_memory_stale_count;
+   }
+
    /*! @brief Set the preferred transportation order.
     *  @param order The transportation type enumeration value. */
    void set_preferred_order( TransportationEnum const order )
@@ -437,6 +599,20 @@ class Attribute
     *  @param capacity Desired capacity of the buffer in bytes. */
    void ensure_buffer_capacity( size_t capacity );
 
+   /*! @brief Write the encoded value into the shared-memory side channel,
+    *  creating a larger segment if the value does not fit. */
+   void write_shared_memory();
+
+   /*! @brief Read the value a received shared-memory descriptor refers to.
+    *  @return True if the value was read, false otherwise.
+    *  @param attr_value The received attribute value holding the descriptor.
+    *  @param value      The attribute value set to the data read. */
+   bool const read_shared_memory( RTI1516_NAMESPACE::VariableLengthData const *attr_value,
+                                  RTI1516_NAMESPACE::VariableLengthData       &value );
+
+   /*! @brief Fall back to subscribing to the FOM encoded value. */
+   void fall_back_from_shared_memory();
+
    /*! @brief Determines if the HLA object attribute type is supported given
     *         the RTI encoding.
     *  @return True if supported, false otherwise. */
@@ -488,6 +664,7 @@ class Attribute
 
    unsigned char *buffer;          ///< @trick_units{--} Byte buffer for the attribute value bytes.
    size_t         buffer_capacity; ///< @trick_units{count} The capacity of the buffer.
+   MemoryUsage   *memory_owner;    ///< @trick_io{**} Memory usage of the parent object the buffer is accounted to.
 
    bool size_is_static; ///< @trick_units{--} Flag to indicate the size of this attribute is static.
 
@@ -505,6 +682,20 @@ class Attribute
    int cycle_ratio; ///< @trick_units{--} Ratio of the attribute cycle-time to the send_cyclic_and_requested_data job cycle time.
    int cycle_cnt;   ///< @trick_units{count} Internal cycle counter used to determine when cyclic data will be sent.
 
+   int                cycle_ratio_scale;  ///< @trick_units{--}    Factor the cycle ratio is stretched by to degrade the send rate.
+   unsigned long long dropped_send_count; ///< @trick_units{count} Number of sends dropped because the send rate was degraded.
+
+   SharedMemoryChannel shm_writer;        ///< @trick_io{**} Shared-memory side channel the published values are written to.
+   SharedMemoryChannel shm_reader;        ///< @trick_io{**} Shared-memory side channel of the publisher the values are read from.
+   std::string         shm_segment_name;  ///< @trick_io{**} Base name of the shared-memory segments this attribute creates.
+   unsigned int        shm_segment_count; ///< @trick_io{**} Number of shared-memory segments this attribute created.
+
+   RTI1516_NAMESPACE::AttributeHandle shm_attr_handle; ///< @trick_io{**} The RTI handle of the attribute carrying the shared-memory descriptor.
+
+   bool               shared_memory_inline;         ///< @trick_units{--}    True once this subscriber fell back to the FOM encoded value.
+   bool               shared_memory_inline_pending; ///< @trick_units{--}    True if this subscriber needs to subscribe to the FOM encoded value.
+   unsigned long long shared_memory_stale_count;    ///< @trick_units{count} Number of shared-memory values overwritten before they were read.
+
    REF2 *ref2; ///< @trick_io{**} The ref_attributes of the given trick_name.
 
    RTI1516_NAMESPACE::AttributeHandle attr_handle; ///< @trick_io{**} The RTI attribute handle.
@@ -0,0 +1,214 @@
+/*!
+@file TrickHLA/BulkConfigLoader.hh
+@ingroup TrickHLA
+@brief This class populates the TrickHLA Manager objects and interactions
+from a JSON manifest instead of setting every field through the Trick input
+processor.
+
+The manifest is a JSON file with optional "attribute_sets", "objects" and
+"interactions" members. An object entry with a "count" is repeated that many
+times, replacing "{i}" in its strings with the repeat index, and its
+"attributes" can name an attribute set so that thousands of objects share one
+attribute definition. The packing, lag compensation, conditional, ownership,
+object deleted and interaction handler instances are referenced by the names
+they were registered with, for example:
+
+@verbatim
+{
+  "attribute_sets": {
+    "sine": [
+      { "FOM_name": "Time", "trick_name": "S{i}.packing.time",
+        "config": "CONFIG_CYCLIC", "rti_encoding": "ENCODING_LITTLE_ENDIAN" }
+    ]
+  },
+  "objects": [
+    { "name": "Sine{i}", "FOM_name": "Test", "count": 1000, "create": true,
+      "packing": "S{i}", "lag_comp": "S{i}", "attributes": "sine" }
+  ],
+  "interactions": [
+    { "FOM_name": "Communication", "publish": true, "handler": "I",
+      "parameters": [
+        { "FOM_name": "time", "trick_name": "I.handler.time",
+          "rti_encoding": "ENCODING_LITTLE_ENDIAN" } ] }
+  ]
+}
+@endverbatim
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/BulkConfigLoader.cpp}
+@trick_link_dependency{../../source/TrickHLA/Manager.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_BULK_CONFIG_LOADER_HH
+#define TRICKHLA_BULK_CONFIG_LOADER_HH
+
+// System include files.
+#include <map>
+#include <string>
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Attribute;
+class Conditional;
+class Interaction;
+class InteractionHandler;
+class LagCompensation;
+class Manager;
+class Object;
+class ObjectDeleted;
+class OwnershipHandler;
+class Packing;
+class Parameter;
+
+class BulkConfigLoader
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__BulkConfigLoader();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA BulkConfigLoader class. */
+   BulkConfigLoader();
+   /*! @brief Destructor for the TrickHLA BulkConfigLoader class. */
+   virtual ~BulkConfigLoader();
+
+   // The handler instances are registered from the input file, where the
+   // Python bindings convert the derived class instances to the base class.
+
+   /*! @brief Register a packing instance for the manifest to reference.
+    *  @param name    Name used in the manifest.
+    *  @param packing The packing instance. */
+   void register_packing( char const *name, Packing *packing );
+
+   /*! @brief Register a lag compensation instance for the manifest to reference.
+    *  @param name     Name used in the manifest.
+    *  @param lag_comp The lag compensation instance. */
+   void register_lag_compensation( char const *name, LagCompensation *lag_comp );
+
+   /*! @brief Register a conditional instance for the manifest to reference.
+    *  @param name        Name used in the manifest.
+    *  @param conditional The conditional instance. */
+   void register_conditional( char const *name, Conditional *conditional );
+
+   /*! @brief Register an ownership handler for the manifest to reference.
+    *  @param name      Name used in the manifest.
+    *  @param ownership The ownership handler instance. */
+   void register_ownership_handler( char const *name, OwnershipHandler *ownership );
+
+   /*! @brief Register an object deleted callback for the manifest to reference.
+    *  @param name    Name used in the manifest.
+    *  @param deleted The object deleted instance. */
+   void register_object_deleted( char const *name, ObjectDeleted *deleted );
+
+   /*! @brief Register an interaction handler for the manifest to reference.
+    *  @param name    Name used in the manifest.
+    *  @param handler The interaction handler instance. */
+   void register_interaction_handler( char const *name, InteractionHandler *handler );
+
+   /*! @brief Load the manifest and allocate and populate the manager objects
+    *  and interactions, which must not have been configured yet.
+    *  @param manifest_file      Path of the JSON manifest file.
+    *  @param manager            The TrickHLA manager to populate.
+    *  @param extra_objects      Number of object slots left at the end for the input file to configure.
+    *  @param extra_interactions Number of interaction slots left at the end for the input file to configure. */
+   void load( char const *manifest_file,
+              Manager    &manager,
+              int const   extra_objects      = 0,
+              int const   extra_interactions = 0 );
+
+   /*! @brief Get the wall clock time the last load took.
+    *  @return Load time in seconds. */
+   double get_load_time() const
+   {
+      return load_time;
+   }
+
+   /*! @brief Get the number of objects the last load configured.
+    *  @return Number of objects. */
+   int const get_object_count() const
+   {
+      return object_count;
+   }
+
+   /*! @brief Get the number of attributes the last load configured.
+    *  @return Number of attributes across all objects. */
+   int const get_attribute_count() const
+   {
+      return attribute_count;
+   }
+
+   /*! @brief Get the number of interactions the last load configured.
+    *  @return Number of interactions. */
+   int const get_interaction_count() const
+   {
+      return interaction_count;
+   }
+
+  protected:
+   double load_time;         ///< @trick_units{s}     Wall clock time of the last load.
+   int    object_count;      ///< @trick_units{count} Number of objects the last load configured.
+   int    attribute_count;   ///< @trick_units{count} Number of attributes the last load configured.
+   int    interaction_count; ///< @trick_units{count} Number of interactions the last load configured.
+
+   std::map< std::string, Packing * >            packings;     ///< @trick_io{**} Registered packing instances.
+   std::map< std::string, LagCompensation * >    lag_comps;    ///< @trick_io{**} Registered lag compensation instances.
+   std::map< std::string, Conditional * >        conditionals; ///< @trick_io{**} Registered conditional instances.
+   std::map< std::string, OwnershipHandler * >   ownerships;   ///< @trick_io{**} Registered ownership handlers.
+   std::map< std::string, ObjectDeleted * >      deleteds;     ///< @trick_io{**} Registered object deleted callbacks.
+   std::map< std::string, InteractionHandler * > handlers;     ///< @trick_io{**} Registered interaction handlers.
+
+   std::map< std::string, char * > strings; ///< @trick_io{**} Interned Trick allocated FOM name strings.
+
+   /*! @brief Allocate a string with the Trick memory manager, sharing one
+    *  allocation between identical strings.
+    *  @return Trick allocated copy of the string.
+    *  @param str String to allocate. */
+   char *intern_string( std::string const &str );
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for BulkConfigLoader class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   BulkConfigLoader( BulkConfigLoader const &rhs );
+   /*! @brief Assignment operator for BulkConfigLoader class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   BulkConfigLoader &operator=( BulkConfigLoader const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_BULK_CONFIG_LOADER_HH: Do NOT put anything after this line!
@@ -42,6 +42,31 @@ NASA, Johnson Space Center\n
 namespace TrickHLA
 {
 
+/*! @brief Exception thrown by DebugHandler::terminate_with_message() on a
+ *  thread that defers termination, which carries the error message to the
+ *  thread that terminates the simulation. */
+class DeferredTermination
+{
+  public:
+   /*! @brief Initialization constructor for the DeferredTermination class.
+    *  @param msg Error message to terminate the simulation with. */
+   explicit DeferredTermination( std::string const &msg )
+      : message( msg )
+   {
+      return;
+   }
+
+   /*! @brief Get the error message.
+    *  @return The error message to terminate the simulation with. */
+   std::string const &get_message() const
+   {
+      return message;
+   }
+
+  private:
+   std::string message; ///< @trick_io{**} Error message to terminate the simulation with.
+};
+
 class DebugHandler
 {
    // Let the Trick input processor access protected and private data.
@@ -78,6 +103,12 @@ class DebugHandler
     *  @param message Error message to print to standard error. */
    static void terminate_with_message( std::string const &message );
 
+   /*! @brief Have terminate_with_message() on the calling thread throw a
+    *  DeferredTermination instead of terminating, so that a worker thread
+    *  can hand the error to the thread that terminates the simulation.
+    *  @param defer True to throw DeferredTermination, false to terminate (default). */
+   static void set_defer_termination( bool const defer );
+
   public:
    static DebugLevelEnum  debug_level;  ///< @trick_units{--} Maximum debug report level requested by the user, default: THLA_NO_TRACE
    static DebugSourceEnum code_section; ///< @trick_units{--} Code section(s) for which to activate debug messages, default: THLA_ALL_MODULES
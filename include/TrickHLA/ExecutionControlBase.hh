@@ -100,6 +100,10 @@ class ExecutionControlBase : public TrickHLA::SyncPntListBase
    char *multiphase_init_sync_points; /**< @trick_units{--}
       Comma-separated list of multi-phase initialization sync-points. */
 
+   double cte_spin_margin; /**< @trick_units{s}
+      Wall clock time before a CTE mode transition time to stop sleeping and
+      spin on the CTE clock until the transition time. (default: 0.002) */
+
   public:
    /*! @brief Default constructor for the ExecutionControlBase class. */
    ExecutionControlBase();
@@ -335,6 +339,67 @@ class ExecutionControlBase : public TrickHLA::SyncPntListBase
     *  @return The current CTE time in seconds. */
    double get_cte_time();
 
+   /*! @brief Wait until a CTE mode transition time by sleeping until shortly
+    * before it and then spinning on the CTE clock.
+    *  @return The achieved start error, CTE time after the wait minus the
+    *  transition time, in seconds.
+    *  @param cte_time        CTE time of the mode transition.
+    *  @param transition_name Name of the mode transition for messages. */
+   double wait_for_cte_time( double const cte_time,
+                                   char const  *transition_name );
+
+   /*! @brief Get the start error of the last CTE mode transition.
+    *  @return CTE time after the wait minus the transition time in seconds. */
+   double get_mode_transition_error() const
+   {
+      return this->mode_transition_error;
+   }
+
+   /*! @brief Get the largest magnitude start error of the CTE mode transitions.
+    *  @return Largest magnitude start error in seconds. */
+   double get_mode_transition_error_max() const
+   {
+      return this->mode_transition_error_max;
+   }
+
+   /*! @brief Get the number of CTE mode transitions waited for.
+    *  @return Number of CTE mode transitions. */
+   int get_mode_transition_count() const
+   {
+      return this->mode_transition_count;
+   }
+
+   /*! @brief Record the start error of a CTE go-to-run mode transition.
+    *  @param error CTE time after the wait minus the transition time in seconds. */
+   void record_mode_transition_error( double const error );
+
+   /*! @brief Get the error of the last CTE freeze transition wait. This only
+    * measures how far this federate's wait overshot the freeze time; it does
+    * not control the skew between federates entering freeze.
+    *  @return CTE time after the wait minus the freeze time in seconds. */
+   double get_freeze_transition_error() const
+   {
+      return this->freeze_transition_error;
+   }
+
+   /*! @brief Get the largest magnitude error of the CTE freeze transition waits.
+    *  @return Largest magnitude freeze wait error in seconds. */
+   double get_freeze_transition_error_max() const
+   {
+      return this->freeze_transition_error_max;
+   }
+
+   /*! @brief Get the number of CTE freeze transitions waited for.
+    *  @return Number of CTE freeze transitions. */
+   int get_freeze_transition_count() const
+   {
+      return this->freeze_transition_count;
+   }
+
+   /*! @brief Record the error of a CTE freeze transition wait.
+    *  @param error CTE time after the wait minus the freeze time in seconds. */
+   void record_freeze_transition_error( double const error );
+
    /*! @brief Get the current scenario time from Scenario Timeline.
     *  @return The current scenario time in seconds. */
    double get_scenario_time();
@@ -704,6 +769,14 @@ class ExecutionControlBase : public TrickHLA::SyncPntListBase
    double simulation_freeze_time; ///< @trick_units{s} Trick simulation time for freeze.
    double scenario_freeze_time;   ///< @trick_units{s} Federation execution scenario time for freeze.
 
+   double mode_transition_error;     ///< @trick_units{s}     Start error of the last CTE mode transition.
+   double mode_transition_error_max; ///< @trick_units{s}     Largest magnitude start error of the CTE mode transitions.
+   int    mode_transition_count;     ///< @trick_units{count} Number of CTE mode transitions waited for.
+
+   double freeze_transition_error;     ///< @trick_units{s}     Error of the last CTE freeze transition wait.
+   double freeze_transition_error_max; ///< @trick_units{s}     Largest magnitude error of the CTE freeze transition waits.
+   int    freeze_transition_count;     ///< @trick_units{count} Number of CTE freeze transitions waited for.
+
    bool late_joiner;            ///< @trick_units{--} Flag that this federate is a late joiner.
    bool late_joiner_determined; ///< @trick_units{--} Flag for late joiner determination.
 
@@ -25,6 +25,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Int64Time.cpp}
 @trick_link_dependency{../../source/TrickHLA/FedAmb.cpp}
 @trick_link_dependency{../../source/TrickHLA/Federate.cpp}
+@trick_link_dependency{../../source/TrickHLA/GALTMonitor.cpp}
 @trick_link_dependency{../../source/TrickHLA/Manager.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexProtection.cpp}
@@ -82,6 +83,7 @@ namespace TrickHLA
 class Manager;
 class FedAmb;
 class ExecutionControlBase;
+class GALTMonitor;
 
 /*
  * Enumerated type used to step through the restore process.
@@ -670,6 +672,17 @@ class Federate
    /*! @brief Verify the thread IDs associated to the objects. */
    void verify_trick_child_thread_associations();
 
+   /*! @brief Enable the Trick child threads to pack and send the data for the
+    * objects they own, with the Trick main thread only enforcing the Time
+    * Advance Request (TAR) ordering. Must be called from the input file.
+    *  @param enable True to send the object data on the owning child threads. */
+   void enable_child_thread_send( bool const enable );
+
+   /*! @brief Get the ID of the Trick thread that sends the data for the object.
+    *  @return The Trick thread ID, zero for the Trick main thread.
+    *  @param obj_index Object index. */
+   unsigned int get_send_thread_id_for_obj( unsigned int const obj_index ) const;
+
    /*! @brief Announce to all the child threads the main thread has data available. */
    void announce_data_available();
 
@@ -833,6 +846,37 @@ class Federate
    void set_MOM_HLAfederation_instance_attributes( RTI1516_NAMESPACE::ObjectInstanceHandle           instance_hndl,
                                                    RTI1516_NAMESPACE::AttributeHandleValueMap const &values );
 
+   //
+   // MOM HLAfederate time state used to find the federate holding back GALT.
+   //
+   /*! @brief Set the GALT monitor that receives the MOM time state of the
+    *  federates.
+    *  @param monitor GALT monitor, or NULL for none. */
+   void set_GALT_monitor( GALTMonitor *monitor )
+   {
+      this->galt_monitor = monitor;
+   }
+
+   /*! @brief Subscribe to the MOM HLAfederate time state attributes. */
+   void subscribe_MOM_HLAfederate_time_state();
+
+   /*! @brief Request the MOM to provide the HLAfederate time state attributes
+    *  for all the federates. */
+   void request_MOM_HLAfederate_time_state();
+
+   /*! @brief Decode the MOM HLAfederate time state attributes and pass them
+    *  to the GALT monitor, if there is one.
+    *  @param instance_hndl Object instance handle.
+    *  @param values        Attribute values. */
+   void set_MOM_HLAfederate_time_state( RTI1516_NAMESPACE::ObjectInstanceHandle           instance_hndl,
+                                        RTI1516_NAMESPACE::AttributeHandleValueMap const &values );
+
+   /*! @brief Estimate the memory used by the MOM federate and federation
+    *  instance tables and the joined federate names and handles.
+    *  @param entries Set to the number of table entries.
+    *  @return Approximate bytes of the tables. */
+   size_t get_MOM_memory_size( int64_t &entries );
+
    //
    // Routines to return federation state values.
    //
@@ -892,6 +936,14 @@ class Federate
       return this->granted_time;
    }
 
+   /*! @brief Get the cumulative wall clock time spent waiting for a Time
+    * Advance Grant (TAG).
+    *  @return Cumulative TAG wait time in microseconds. */
+   int64_t get_tag_wait_time() const
+   {
+      return this->tag_wait_time;
+   }
+
    /*! @brief Get the current granted HLA federation execution time in the base HLA Logical Time representation.
     *  @return Reference to current granted HLA federation execution time. */
    double const get_granted_base_time() const
@@ -978,6 +1030,17 @@ class Federate
       return ( this->time_adv_state == TIME_ADVANCE_GRANTED );
    }
 
+   /*! @brief Query if a time advance has been requested and not yet granted.
+    *  @return True if a time advance grant is pending; False otherwise. */
+   bool is_time_advance_requested()
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+
+      return ( this->time_adv_state == TIME_ADVANCE_REQUESTED );
+   }
+
    /*! @brief Sets the granted time from the specified double.
     *  @param time Granted time in seconds. */
    void set_granted_time( double const time );
@@ -1189,6 +1252,7 @@ class Federate
    MutexLock    time_adv_state_mutex; ///< @trick_units{--} HLA Time advance state mutex lock.
    Int64Time    granted_time;         ///< @trick_units{--} HLA time given by RTI
    Int64Time    requested_time;       ///< @trick_units{--} requested/desired HLA time
+   int64_t      tag_wait_time;        ///< @trick_units{us} Cumulative wall clock time spent waiting for a Time Advance Grant.
    double       HLA_time;             ///< @trick_units{s}  Current HLA time to allow for plotting.
    bool         start_to_save;        ///< @trick_io{**} Save flag
    bool         start_to_restore;     ///< @trick_io{**} Restore flag
@@ -1222,6 +1286,16 @@ class Federate
    RTI1516_NAMESPACE::InteractionClassHandle MOM_HLAsetSwitches_class_handle; ///< @trick_io{**} MOM HLAsetSwitches class handle.
    RTI1516_NAMESPACE::ParameterHandle        MOM_HLAautoProvide_param_handle; ///< @trick_io{**} MOM HLAautoProvide parameter handle.
 
+   bool                               MOM_time_state_available;     ///< @trick_io{**} MOM HLAfederate time state attribute handles are available.
+   RTI1516_NAMESPACE::AttributeHandle MOM_HLAtimeRegulating_handle; ///< @trick_io{**} MOM attribute handle to Federate time regulating state.
+   RTI1516_NAMESPACE::AttributeHandle MOM_HLAtimeConstrained_handle; ///< @trick_io{**} MOM attribute handle to Federate time constrained state.
+   RTI1516_NAMESPACE::AttributeHandle MOM_HLAtimeManagerState_handle; ///< @trick_io{**} MOM attribute handle to Federate time manager state.
+   RTI1516_NAMESPACE::AttributeHandle MOM_HLAlogicalTime_handle;      ///< @trick_io{**} MOM attribute handle to Federate logical time.
+   RTI1516_NAMESPACE::AttributeHandle MOM_HLAlookahead_handle;        ///< @trick_io{**} MOM attribute handle to Federate lookahead.
+   RTI1516_NAMESPACE::AttributeHandle MOM_HLAGALT_handle;             ///< @trick_io{**} MOM attribute handle to Federate GALT.
+   RTI1516_NAMESPACE::AttributeHandle MOM_HLALITS_handle;             ///< @trick_io{**} MOM attribute handle to Federate LITS.
+   GALTMonitor                       *galt_monitor;                   ///< @trick_io{**} Optional GALT monitor for the MOM time state.
+
    TrickThreadCoordinator thread_coordinator; ///< @trick_units{--} Trick child thread coordinator with HLA.
 
    // Federation required associations.
@@ -1243,6 +1317,14 @@ class Federate
    /*! @brief Request federation save from the RTI. */
    void request_federation_save();
 
+   /*! @brief Initialize the MOM HLAfederate time state attribute handles. */
+   void initialize_MOM_time_state_handles();
+
+   /*! @brief Get the name of the federate for a MOM HLAfederate instance.
+    *  @return Federate name, or the MOM instance name if not yet known.
+    *  @param instance_hndl MOM HLAfederate object instance handle. */
+   std::string get_MOM_HLAfederate_name( RTI1516_NAMESPACE::ObjectInstanceHandle instance_hndl );
+
    /*! @brief Subscribe to the specified attributes for the given class handle.
     *  @param class_handle   Class handle.
     *  @param attribute_list Attributes handles. */
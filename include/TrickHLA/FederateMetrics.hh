@@ -0,0 +1,161 @@
+/*!
+@file TrickHLA/FederateMetrics.hh
+@ingroup TrickHLA
+@brief This class samples the performance metrics of this federate and packs
+them into a TrickHLA Object so they can be published to the federation.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/Federate.cpp}
+@trick_link_dependency{../../source/TrickHLA/FederateMetrics.cpp}
+@trick_link_dependency{../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../source/TrickHLA/Packing.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_FEDERATE_METRICS_HH
+#define TRICKHLA_FEDERATE_METRICS_HH
+
+// System include files.
+#include <stdint.h>
+
+// TrickHLA include files.
+#include "TrickHLA/Packing.hh"
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Federate;
+class Manager;
+
+class FederateMetrics : public Packing
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__FederateMetrics();
+
+  public:
+   // Published metrics, which are averages over the period since the last
+   // publish except for the cumulative total_overrun_count.
+   char  *federate_name;           ///< @trick_units{--} Name of the federate the metrics are for.
+   double granted_time;            ///< @trick_units{s}  HLA granted time of the federate.
+   double frame_time;              ///< @trick_units{s}  Average wall clock time of a data cycle frame.
+   double frame_time_max;          ///< @trick_units{s}  Maximum wall clock time of a data cycle frame.
+   double tag_wait_time;           ///< @trick_units{s}  Average wall clock time per frame spent waiting for a Time Advance Grant.
+   double pack_time;               ///< @trick_units{s}  Average wall clock time per frame spent packing object data.
+   double unpack_time;             ///< @trick_units{s}  Average wall clock time per frame spent unpacking object data.
+   double send_rate;               ///< @trick_units{--} Attribute value bytes sent per second of wall clock time.
+   double receive_rate;            ///< @trick_units{--} Attribute value bytes received per second of wall clock time.
+   int    reflection_queue_depth;  ///< @trick_units{count} Number of reflections waiting to be processed across all objects.
+   int    interaction_queue_depth; ///< @trick_units{count} Number of received interactions waiting to be processed.
+   int    total_overrun_count;     ///< @trick_units{count} Cumulative number of frames since initialization that exceeded the data cycle time.
+   double mode_transition_error;   ///< @trick_units{s}  Start error of the last CTE mode transition, CTE time after the wait minus the transition time.
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA FederateMetrics class. */
+   FederateMetrics();
+   /*! @brief Destructor for the TrickHLA FederateMetrics class. */
+   virtual ~FederateMetrics();
+
+   /*! @brief Configure the federate metrics.
+    *  @param fed        The TrickHLA Federate to sample.
+    *  @param mgr        The TrickHLA Manager to sample.
+    *  @param data_cycle The data cycle time of the sample() job in seconds. */
+   void configure( Federate    *fed,
+                   Manager     *mgr,
+                   double const data_cycle );
+
+   /*! @brief Initialize the federate metrics. */
+   virtual void initialize();
+
+   /*! @brief Sample the wall clock time of the data cycle frame, which must be
+    * scheduled at the data cycle rate of the federate. */
+   void sample();
+
+   // From the TrickHLA::Packing class.
+   /*! @brief Create a new federate metrics instance for an object
+    * instantiated from a TrickHLA::ObjectTemplate.
+    *  @return New packing instance.
+    *  @param instance_name Trick variable name for the new instance. */
+   virtual Packing *create_template_instance( char const *instance_name );
+
+   // From the TrickHLA::Packing class.
+   /*! @brief Called to pack the data before the data is sent to the RTI. */
+   virtual void pack();
+
+   // From the TrickHLA::Packing class.
+   /*! @brief Called to unpack the data after data is received from the RTI. */
+   virtual void unpack();
+
+   /*! @brief Get the wall clock time of the last update of the metrics.
+    *  @return Wall clock time in microseconds, or zero if never updated. */
+   int64_t get_update_wall_time() const
+   {
+      return this->update_wall_time;
+   }
+
+  protected:
+   Federate *federate; ///< @trick_io{**} Federate to sample.
+   Manager  *manager;  ///< @trick_io{**} Manager to sample.
+
+   double data_cycle; ///< @trick_units{s} Data cycle time of the sample() job.
+
+   int64_t frame_start_wall_time;  ///< @trick_units{us}    Wall clock time at the start of the current frame.
+   int64_t period_start_wall_time; ///< @trick_units{us}    Wall clock time at the start of the publish period.
+   int64_t period_frame_time;      ///< @trick_units{us}    Sum of the frame times in the publish period.
+   int64_t period_frame_time_max;  ///< @trick_units{us}    Maximum frame time in the publish period.
+   int     period_frame_count;     ///< @trick_units{count} Number of frames in the publish period.
+
+   int64_t            prev_tag_wait_time;  ///< @trick_units{us}    Federate TAG wait time at the start of the publish period.
+   int64_t            prev_pack_time;      ///< @trick_units{us}    Object pack time at the start of the publish period.
+   int64_t            prev_unpack_time;    ///< @trick_units{us}    Object unpack time at the start of the publish period.
+   unsigned long long prev_bytes_sent;     ///< @trick_units{count} Object bytes sent at the start of the publish period.
+   unsigned long long prev_bytes_received; ///< @trick_units{count} Object bytes received at the start of the publish period.
+
+   int64_t update_wall_time; ///< @trick_units{us} Wall clock time of the last unpacked update.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for FederateMetrics class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   FederateMetrics( FederateMetrics const &rhs );
+   /*! @brief Assignment operator for FederateMetrics class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   FederateMetrics &operator=( FederateMetrics const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_FEDERATE_METRICS_HH: Do NOT put anything after this line!
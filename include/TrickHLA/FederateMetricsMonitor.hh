@@ -0,0 +1,105 @@
+/*!
+@file TrickHLA/FederateMetricsMonitor.hh
+@ingroup TrickHLA
+@brief This class prints and optionally records a live table of the
+performance metrics published by the federates in the federation.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/FederateMetrics.cpp}
+@trick_link_dependency{../../source/TrickHLA/FederateMetricsMonitor.cpp}
+@trick_link_dependency{../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../source/TrickHLA/Object.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_FEDERATE_METRICS_MONITOR_HH
+#define TRICKHLA_FEDERATE_METRICS_MONITOR_HH
+
+// System include files.
+#include <cstdio>
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Manager;
+
+class FederateMetricsMonitor
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__FederateMetricsMonitor();
+
+  public:
+   bool   print_table;  ///< @trick_units{--} True to print the table of metrics (default: true).
+   char  *record_file;  ///< @trick_units{--} Optional CSV file to record the metrics to (default: NULL).
+   double stale_period; ///< @trick_units{s}  Wall clock time after which metrics not updated are marked stale (default: 5 seconds).
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA FederateMetricsMonitor class. */
+   FederateMetricsMonitor();
+   /*! @brief Destructor for the TrickHLA FederateMetricsMonitor class. */
+   virtual ~FederateMetricsMonitor();
+
+   /*! @brief Configure the monitor.
+    *  @param mgr The TrickHLA Manager with the discovered federate metrics objects. */
+   void configure( Manager *mgr );
+
+   /*! @brief Initialize the monitor, opening the record file if specified. */
+   void initialize();
+
+   /*! @brief Print and record the latest metrics of all the federates. */
+   void update();
+
+   /*! @brief Close the record file. */
+   void shutdown();
+
+  protected:
+   Manager *manager;     ///< @trick_io{**} Manager with the federate metrics objects.
+   FILE    *record_fp;   ///< @trick_io{**} Record file handle.
+   int      print_count; ///< @trick_units{count} Number of tables printed.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for FederateMetricsMonitor class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   FederateMetricsMonitor( FederateMetricsMonitor const &rhs );
+   /*! @brief Assignment operator for FederateMetricsMonitor class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   FederateMetricsMonitor &operator=( FederateMetricsMonitor const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_FEDERATE_METRICS_MONITOR_HH: Do NOT put anything after this line!
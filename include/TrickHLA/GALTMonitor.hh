@@ -0,0 +1,186 @@
+/*!
+@file TrickHLA/GALTMonitor.hh
+@ingroup TrickHLA
+@brief This class reports which federate is holding back the Greatest
+Available Logical Time (GALT) of the federation, using the time state that
+the Management Object Model (MOM) reports for each federate.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/Federate.cpp}
+@trick_link_dependency{../../source/TrickHLA/GALTMonitor.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_GALT_MONITOR_HH
+#define TRICKHLA_GALT_MONITOR_HH
+
+// System include files.
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/MutexLock.hh"
+
+// Bits for the MOM HLAfederate time state attributes in an update.
+#define THLA_GALT_REGULATING ( 1U << 0 )
+#define THLA_GALT_CONSTRAINED ( 1U << 1 )
+#define THLA_GALT_ADVANCING ( 1U << 2 )
+#define THLA_GALT_LOGICAL_TIME ( 1U << 3 )
+#define THLA_GALT_LOOKAHEAD ( 1U << 4 )
+#define THLA_GALT_GALT ( 1U << 5 )
+#define THLA_GALT_LITS ( 1U << 6 )
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Federate;
+
+/*!
+ * @brief Time state of a federate as reported by the MOM, with the times in
+ * HLA base time units.
+ */
+class GALTFederateState
+{
+  public:
+   unsigned int fields; ///< @trick_units{--} THLA_GALT_* bits of the fields that are set.
+
+   bool    time_regulating;  ///< @trick_units{--} Federate is time regulating.
+   bool    time_constrained; ///< @trick_units{--} Federate is time constrained.
+   bool    time_advancing;   ///< @trick_units{--} Federate has a pending time advance request.
+   int64_t logical_time;     ///< @trick_units{--} Federate logical time in base time units.
+   int64_t lookahead;        ///< @trick_units{--} Federate lookahead in base time units.
+   int64_t GALT;             ///< @trick_units{--} Federate GALT in base time units.
+   int64_t LITS;             ///< @trick_units{--} Federate least incoming time stamp in base time units.
+
+   int64_t update_wall_time; ///< @trick_units{us} Monotonic wall clock time of the last update.
+   int64_t blame_time;       ///< @trick_units{us} Wall clock time this federate held back GALT.
+   int     blame_count;      ///< @trick_units{count} Number of samples this federate held back GALT.
+
+   /*! @brief Default constructor for the TrickHLA GALTFederateState class. */
+   GALTFederateState()
+      : fields( 0 ),
+        time_regulating( false ),
+        time_constrained( false ),
+        time_advancing( false ),
+        logical_time( 0 ),
+        lookahead( 0 ),
+        GALT( 0 ),
+        LITS( 0 ),
+        update_wall_time( 0 ),
+        blame_time( 0 ),
+        blame_count( 0 )
+   {
+      return;
+   }
+};
+
+class GALTMonitor
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__GALTMonitor();
+
+  public:
+   bool   print_table;  ///< @trick_units{--} True to print the report (default: true).
+   char  *record_file;  ///< @trick_units{--} Optional CSV file to record every sample to (default: NULL).
+   double stale_period; ///< @trick_units{s}  Wall clock time after which a federate not updated is marked stale (default: 5 seconds).
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA GALTMonitor class. */
+   GALTMonitor();
+   /*! @brief Destructor for the TrickHLA GALTMonitor class. */
+   virtual ~GALTMonitor();
+
+   /*! @brief Configure the monitor, which registers it with the federate.
+    *  @param fed The TrickHLA Federate with the MOM interface. */
+   void configure( Federate *fed );
+
+   /*! @brief Initialize the monitor, opening the record file if specified
+    *  and subscribing to the MOM time state of the federates. */
+   void initialize();
+
+   /*! @brief Sample the time state, charge the elapsed wall clock time to the
+    *  federate holding back GALT, report it, and request the next sample. */
+   void update();
+
+   /*! @brief Close the record file. */
+   void shutdown();
+
+   /*! @brief Merge a MOM time state update for a federate, called from the
+    *  federate ambassador callback thread.
+    *  @param federate_name Name of the federate.
+    *  @param state         Time state with the fields that were reported. */
+   void update_federate_state( std::string const       &federate_name,
+                               GALTFederateState const &state );
+
+   /*! @brief Get the name of the federate holding back GALT at the last sample.
+    *  @return Federate name, or an empty string if none. */
+   std::string const &get_holding_federate() const
+   {
+      return holding_federate;
+   }
+
+  protected:
+   Federate *federate;    ///< @trick_io{**} Federate with the MOM interface.
+   FILE     *record_fp;   ///< @trick_io{**} Record file handle.
+   int       print_count; ///< @trick_units{count} Number of reports printed.
+
+   int64_t prev_wall_time;   ///< @trick_units{us} Monotonic wall clock time of the previous sample.
+   int64_t total_wall_time;  ///< @trick_units{us} Total wall clock time sampled.
+   int64_t unblamed_time;    ///< @trick_units{us} Wall clock time no federate was holding back GALT.
+   int     sample_count;     ///< @trick_units{count} Number of samples taken.
+   int     holder_changes;   ///< @trick_units{count} Number of times the holding federate changed.
+
+   std::string holding_federate; ///< @trick_io{**} Federate holding back GALT at the last sample.
+
+   MutexLock                                  state_mutex; ///< @trick_io{**} Mutex for the federate states.
+   std::map< std::string, GALTFederateState > states;      ///< @trick_io{**} Time state of each federate.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for GALTMonitor class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   GALTMonitor( GALTMonitor const &rhs );
+   /*! @brief Assignment operator for GALTMonitor class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   GALTMonitor &operator=( GALTMonitor const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_GALT_MONITOR_HH: Do NOT put anything after this line!
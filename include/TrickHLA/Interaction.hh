@@ -25,7 +25,9 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Interaction.cpp}
 @trick_link_dependency{../../source/TrickHLA/InteractionItem.cpp}
 @trick_link_dependency{../../source/TrickHLA/InteractionHandler.cpp}
+@trick_link_dependency{../../source/TrickHLA/InteractionOutbox.cpp}
 @trick_link_dependency{../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../source/TrickHLA/MemoryUsage.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../../source/TrickHLA/Parameter.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
@@ -51,6 +53,7 @@ NASA, Johnson Space Center\n
 // TrickHLA include files
 #include "TrickHLA/Int64Interval.hh"
 #include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/MemoryUsage.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/Types.hh"
@@ -87,6 +90,7 @@ class Federate;
 class Manager;
 class InteractionItem;
 class InteractionHandler;
+class InteractionOutboxItem;
 
 class Interaction
 {
@@ -116,6 +120,8 @@ class Interaction
 
    InteractionHandler *handler; ///< @trick_units{--} Interaction handler.
 
+   MemoryUsage memory_usage; ///< @trick_units{--} Memory TrickHLA allocated for the parameter buffers and received items of this interaction.
+
    //--------------------------------------------------------------------------
 
    //--------------------------------------------------------------------------
@@ -171,6 +177,30 @@ class Interaction
    bool send( double                  send_HLA_time,
               RTI1516_USERDATA const &the_user_supplied_tag );
 
+   /*! @brief Queue the interaction in the outbox of the calling Trick thread
+    * to be sent using Receive Order when the Trick main thread flushes the
+    * outboxes, without locking the interaction mutex. The interaction is sent
+    * directly if the calling thread is not a Trick thread.
+    *  @return True if the interaction was queued or sent; False otherwise.
+    *  @param the_user_supplied_tag Users tag. */
+   bool enqueue_send( RTI1516_USERDATA const &the_user_supplied_tag );
+
+   /*! @brief Queue the interaction in the outbox of the calling Trick thread
+    * to be sent using Timestamp Order when the Trick main thread flushes the
+    * outboxes, without locking the interaction mutex. The interaction is sent
+    * directly if the calling thread is not a Trick thread.
+    *  @return True if the interaction was queued or sent; False otherwise.
+    *  @param send_HLA_time The HLA logical time the user wants to send the interaction.
+    *  @param the_user_supplied_tag Users tag. */
+   bool enqueue_send( double                  send_HLA_time,
+                      RTI1516_USERDATA const &the_user_supplied_tag );
+
+   /*! @brief Sends the interaction packed in an outbox item to the RTI,
+    * called from the Trick main thread when the outboxes are flushed.
+    *  @return True if interaction was sent; False otherwise.
+    *  @param item Outbox item with the encoded parameter values. */
+   bool send_outbox_item( InteractionOutboxItem &item );
+
    /*! @brief Process the interaction by decoding the parameter data into the
     * users simulation variables and calling the users interaction-handler. */
    void process_interaction();
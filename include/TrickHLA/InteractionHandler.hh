@@ -106,6 +106,30 @@ class InteractionHandler
     *  @param the_user_supplied_tag Users tag. */
    bool send_interaction( double send_HLA_time, RTI1516_USERDATA const &the_user_supplied_tag );
 
+   /*! @brief Queues the interaction in the outbox of the calling Trick thread
+    * to be sent to the RTI using Receive Order.
+    *  @return True if the interaction was queued or sent; False otherwise. */
+   bool enqueue_send_interaction();
+
+   /*! @brief Queues the interaction in the outbox of the calling Trick thread
+    * to be sent to the RTI using Receive Order.
+    *  @return True if the interaction was queued or sent; False otherwise.
+    *  @param the_user_supplied_tag Users tag. */
+   bool enqueue_send_interaction( RTI1516_USERDATA const &the_user_supplied_tag );
+
+   /*! @brief Queues the interaction in the outbox of the calling Trick thread
+    * to be sent to the RTI using Timestamp Order.
+    *  @return True if the interaction was queued or sent; False otherwise.
+    *  @param send_HLA_time User specified HLA logical time to send the interaction. */
+   bool enqueue_send_interaction( double send_HLA_time );
+
+   /*! @brief Queues the interaction in the outbox of the calling Trick thread
+    * to be sent to the RTI using Timestamp Order.
+    *  @return True if the interaction was queued or sent; False otherwise.
+    *  @param send_HLA_time User specified HLA logical time to send the interaction.
+    *  @param the_user_supplied_tag Users tag. */
+   bool enqueue_send_interaction( double send_HLA_time, RTI1516_USERDATA const &the_user_supplied_tag );
+
    /*! @brief Return a copy of the interactions lookahead time.
     *  @return A copy of the federation lookahead time. */
    Int64Interval get_lookahead() const;
@@ -24,6 +24,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Int64Time.cpp}
 @trick_link_dependency{../../source/TrickHLA/Item.cpp}
 @trick_link_dependency{../../source/TrickHLA/ItemQueue.cpp}
+@trick_link_dependency{../../source/TrickHLA/MemoryAccounting.cpp}
 @trick_link_dependency{../../source/TrickHLA/Parameter.cpp}
 @trick_link_dependency{../../source/TrickHLA/ParameterItem.cpp}
 
@@ -64,6 +65,7 @@ namespace TrickHLA
 // Forward Declared Classes:  Since these classes are only used as references
 // through pointers, these classes are included as forward declarations. This
 // helps to limit issues with recursive includes.
+class MemoryUsage;
 class Parameter;
 class ParameterItem;
 
@@ -151,6 +153,11 @@ class InteractionItem : public Item
    /*! @brief Encode all the parm_items values into this InteractionItem. */
    void restore_queue();
 
+   /*! @brief Account the memory of this item to the received interactions
+    * and to the interaction it is for, until the item is deleted.
+    *  @param owner Memory usage of the interaction. */
+   void account_memory( MemoryUsage *owner );
+
    /*! @brief Query if this InteractionItem is sent TimeStamp Order (TSO).
     *  @return True if sent TimeStamp Order; False otherwise. */
    bool is_timestamp_order() const
@@ -165,6 +172,11 @@ class InteractionItem : public Item
       return ( !order_is_TSO );
    }
 
+  protected:
+   int64_t      memory_bytes;     ///< @trick_io{**} Approximate bytes of this item, its parameter values and tag.
+   MemoryUsage *memory_owner;     ///< @trick_io{**} Memory usage of the interaction this item is accounted to.
+   bool         memory_accounted; ///< @trick_io{**} True once the memory of this item has been accounted for.
+
   private:
    /*! @brief Decode the Interaction values into this Item.
     *  @param inter_type         Type of the containing interaction.
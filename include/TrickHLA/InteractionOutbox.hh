@@ -0,0 +1,196 @@
+/*!
+@file TrickHLA/InteractionOutbox.hh
+@ingroup TrickHLA
+@brief This class provides a per-thread outbox of interaction sends that a
+Trick thread fills without locking and the Trick main thread flushes to the
+RTI once per frame.
+
+Each Trick thread has its own outbox, which is a fixed size ring of items
+with a single producer (the owning thread) and a single consumer (the Trick
+main thread). The item buffers are kept between frames so the encoded
+parameter values are packed into pooled memory.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/Interaction.cpp}
+@trick_link_dependency{../../source/TrickHLA/InteractionOutbox.cpp}
+@trick_link_dependency{../../source/TrickHLA/Parameter.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_INTERACTION_OUTBOX_HH
+#define TRICKHLA_INTERACTION_OUTBOX_HH
+
+// System include files.
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+// TrickHLA include files.
+#include "TrickHLA/StandardsSupport.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Interaction;
+
+/*!
+@class InteractionOutboxItem
+@brief An interaction send waiting in an outbox. The encoded parameter values
+and the user supplied tag are packed back to back into the data buffer, which
+keeps its capacity when the item is reused.
+*/
+class InteractionOutboxItem
+{
+  public:
+   /*! @brief Default constructor for the TrickHLA InteractionOutboxItem class. */
+   InteractionOutboxItem()
+      : interaction( NULL ),
+        timestamp_order( false ),
+        send_time( 0.0 ),
+        enqueue_wall_time( 0LL ),
+        tag_size( 0 ),
+        param_sizes(),
+        data()
+   {
+      return;
+   }
+
+   Interaction *interaction;       ///< @trick_io{**} Interaction to send.
+   bool         timestamp_order;   ///< @trick_io{**} True to send with the send time, false for Receive Order.
+   double       send_time;         ///< @trick_io{**} HLA logical time in seconds to send a Timestamp Order interaction.
+   int64_t      enqueue_wall_time; ///< @trick_io{**} Wall clock time in microseconds the send was enqueued.
+
+   std::size_t                  tag_size;    ///< @trick_io{**} Number of bytes of user supplied tag at the end of the data.
+   std::vector< std::size_t >   param_sizes; ///< @trick_io{**} Encoded size of each parameter in the data.
+   std::vector< unsigned char > data;        ///< @trick_io{**} Pooled buffer of the encoded parameters followed by the tag.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for InteractionOutboxItem class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   InteractionOutboxItem( InteractionOutboxItem const &rhs );
+   /*! @brief Assignment operator for InteractionOutboxItem class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   InteractionOutboxItem &operator=( InteractionOutboxItem const &rhs );
+};
+
+class InteractionOutbox
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__InteractionOutbox();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA InteractionOutbox class. */
+   InteractionOutbox();
+   /*! @brief Destructor for the TrickHLA InteractionOutbox class. */
+   virtual ~InteractionOutbox();
+
+   /*! @brief Allocate the ring of items.
+    *  @param outbox_size Maximum number of interaction sends waiting in the outbox. */
+   void initialize( unsigned int const outbox_size );
+
+   /*! @brief Pack the interaction parameters into the next free item and
+    * publish it to the consumer, called only from the owning thread.
+    *  @return True if enqueued, false if the outbox is full.
+    *  @param inter           Interaction to send.
+    *  @param timestamp_order True to send with the send time.
+    *  @param send_time       HLA logical time in seconds for Timestamp Order.
+    *  @param tag             User supplied tag. */
+   bool enqueue( Interaction            &inter,
+                 bool const              timestamp_order,
+                 double const            send_time,
+                 RTI1516_USERDATA const &tag );
+
+   /*! @brief Get the items enqueued so far, called only from the Trick main
+    * thread. Items enqueued after this call are left for the next flush.
+    *  @return Number of items appended to the list.
+    *  @param items List to append the pending items to, oldest first. */
+   unsigned int collect( std::vector< InteractionOutboxItem * > &items );
+
+   /*! @brief Return the collected items to the owning thread for reuse,
+    * called only from the Trick main thread after they are sent.
+    *  @param count Number of collected items to release. */
+   void release( unsigned int const count );
+
+   /*! @brief Get the number of sends rejected because the outbox was full.
+    *  @return Number of rejected sends. */
+   unsigned long long get_overflow_count() const
+   {
+      return overflow_count;
+   }
+
+   /*! @brief Get the maximum number of sends waiting in the outbox.
+    *  @return Maximum outbox depth. */
+   unsigned int get_max_depth() const
+   {
+      return max_depth;
+   }
+
+  protected:
+   InteractionOutboxItem *items; ///< @trick_io{**} Ring of items.
+   unsigned int           size;  ///< @trick_io{**} Number of items in the ring.
+
+   // The head is only written by the consumer and the tail only by the
+   // producer, each with release semantics so the other side sees complete
+   // items without a lock.
+   unsigned int head; ///< @trick_io{**} Index of the oldest item, advanced by the consumer.
+   unsigned int tail; ///< @trick_io{**} Index of the next free item, advanced by the producer.
+
+   unsigned long long overflow_count; ///< @trick_io{**} Number of sends rejected because the outbox was full.
+   unsigned int       max_depth;      ///< @trick_io{**} Maximum number of sends waiting in the outbox.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for InteractionOutbox class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   InteractionOutbox( InteractionOutbox const &rhs );
+   /*! @brief Assignment operator for InteractionOutbox class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   InteractionOutbox &operator=( InteractionOutbox const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_INTERACTION_OUTBOX_HH: Do NOT put anything after this line!
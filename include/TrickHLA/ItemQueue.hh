@@ -93,6 +93,11 @@ class ItemQueue
     *  @param item Item to put into the queue. */
    void push( Item *item );
 
+   /*! @brief Remove the item from anywhere in the queue and delete it.
+    *  @param item Item to remove from the queue.
+    *  @return True if the item was found and removed, false otherwise. */
+   bool remove( Item *item );
+
    /*! @brief Re-established original 'head' queue pointer after the queue has
     *  been walked. */
    void rewind();
@@ -50,6 +50,7 @@ namespace TrickHLA
 // Forward declarations of TrickHLA classes needed for pointers.
 class Attribute;
 class Object;
+class Packing;
 
 class LagCompensation
 {
@@ -132,6 +133,20 @@ class LagCompensation
     *  @param obj Associated object for this class. */
    virtual void initialize_callback( Object *obj );
 
+   /*! @brief Create a new lag compensation object of the same type as this
+    * prototype for an object instantiated from a TrickHLA::ObjectTemplate.
+    * The new instance must be allocated with the Trick Memory Manager using
+    * the given variable name and must compensate the given packing instance.
+    *  @return New lag compensation instance, or NULL if not supported (default).
+    *  @param instance_name Trick variable name for the new instance.
+    *  @param inst_packing  Packing instance created for the same object. */
+   virtual LagCompensation *create_template_instance(
+      char const *instance_name,
+      Packing    *inst_packing )
+   {
+      return NULL;
+   }
+
   protected:
    bool    initialized; ///< @trick_units{--} Initialization status flag.
    Object *object;      ///< @trick_io{**} Object associated with this lag-comp class.
@@ -26,8 +26,11 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/ItemQueue.cpp}
 @trick_link_dependency{../../source/TrickHLA/Interaction.cpp}
 @trick_link_dependency{../../source/TrickHLA/InteractionItem.cpp}
+@trick_link_dependency{../../source/TrickHLA/InteractionOutbox.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../source/TrickHLA/ObjectTemplate.cpp}
+@trick_link_dependency{../../source/TrickHLA/SenderThread.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 
 @revs_title
@@ -45,13 +48,18 @@ NASA, Johnson Space Center\n
 
 // System include files.
 #include <cstdint>
+#include <deque>
 #include <string>
+#include <vector>
 
 // TrickHLA include files.
 #include "TrickHLA/ExecutionControlBase.hh"
+#include "TrickHLA/InteractionOutbox.hh"
 #include "TrickHLA/ItemQueue.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/Object.hh"
+#include "TrickHLA/ObjectTemplate.hh"
+#include "TrickHLA/SenderThread.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/Types.hh"
 
@@ -122,9 +130,44 @@ class Manager
    int     obj_count; ///< @trick_units{--} Number of TrickHLA Objects.
    Object *objects;   ///< @trick_units{--} Array of TrickHLA object.
 
+   int             obj_template_count; ///< @trick_units{--} Number of TrickHLA Object Templates.
+   ObjectTemplate *obj_templates;      ///< @trick_units{--} Array of TrickHLA Object Templates used to instantiate objects for discovered instances.
+
    int          inter_count;  ///< @trick_units{--} Number of TrickHLA Interactions.
    Interaction *interactions; ///< @trick_units{--} Array of TrickHLA Interactions.
 
+   // Send rate degradation of attributes by send priority when the wall clock
+   // time to send and receive the cyclic data is over budget.
+   double send_receive_budget;     ///< @trick_units{s}     Wall clock time budget to send and receive the cyclic data each data cycle, zero to disable send rate degradation (default: 0).
+   int    degrade_factor;          ///< @trick_units{--}    Factor the attribute cycle ratio is stretched by for each degradation level (default: 2).
+   int    degrade_cycle_count;     ///< @trick_units{count} Consecutive data cycles over budget before degrading another level (default: 2).
+   int    recover_cycle_count;     ///< @trick_units{count} Consecutive data cycles under the recover budget before recovering a level (default: 20).
+   double recover_budget_fraction; ///< @trick_units{--}    Fraction of the budget the send and receive time must be under to recover (default: 0.75).
+
+   // Asynchronous sending of the cyclic attribute updates so the Trick main
+   // thread does not block in the RTI while it packs and sends the data.
+   bool async_send;             ///< @trick_units{--}    True to send the cyclic attribute updates from a dedicated sender thread (default: false).
+   int  async_send_queue_limit; ///< @trick_units{count} Maximum number of queued updates before the main thread blocks (default: 256).
+
+   // Per Trick thread outboxes of interactions queued by Interaction::enqueue_send(),
+   // which the Trick main thread sends in timestamp order once per frame.
+   int interaction_outbox_size; ///< @trick_units{count} Maximum number of interaction sends queued per Trick thread, zero to send them directly (default: 0).
+
+   // Pace the attribute updates requested by late joining federates, which
+   // otherwise all go out in the data cycle the requests arrived in.
+   int    catch_up_cycle_count;     ///< @trick_units{count} Number of data cycles to spread the requested attribute updates over, zero to not limit by data cycles (default: 0).
+   int    catch_up_bytes_per_cycle; ///< @trick_units{count} Estimated bytes of requested attribute updates sent per data cycle, zero to not limit by bytes (default: 0).
+   double catch_up_timeout;         ///< @trick_units{s}     Wall clock time to wait for the objects requested by request_class_data_update() before giving up on them, zero to wait forever (default: 60.0).
+
+   int setup_thread_count; ///< @trick_units{count} Number of threads to initialize the object attributes and interaction parameters with before joining, zero for one per online processor (default: 1).
+
+   // Bound the queue of received interactions so that a burst of interactions
+   // can not grow the memory and latency without bound when the Trick main
+   // thread falls behind the RTI callback thread.
+   int                     interactions_queue_max_depth; ///< @trick_units{count} Maximum number of queued interactions before the overflow policy applies, zero for unbounded (default: 0).
+   QueueOverflowPolicyEnum interactions_queue_policy;    ///< @trick_units{--}    Policy applied when the interaction queue is at its maximum depth (default: QUEUE_OVERFLOW_CONFLATE).
+   double                  queue_block_timeout;          ///< @trick_units{s}     Maximum wall clock time the RTI callback blocks for room in an interaction or reflection queue with the QUEUE_OVERFLOW_BLOCK policy before dropping the oldest queued item (default: 1).
+
    bool  restore_federation;          ///< @trick_io{*i} @trick_units{--} flag indicating whether to trigger the restore
    char *restore_file_name;           ///< @trick_io{*i} @trick_units{--} file name, which will be the label name
    bool  initiated_a_federation_save; ///< @trick_io{**} did this manager initiate the federation save?
@@ -202,9 +245,59 @@ class Manager
     *  @param instance_name Object instance name. */
    void request_data_update( char const *instance_name );
 
+   /*! @brief Request an update of the remotely owned subscribed attributes
+    * of all the discovered objects with one request per object class, such
+    * as when joining late, and track the objects until their data is
+    * received. */
+   void request_class_data_update();
+
+   /*! @brief Determine if the data of all the objects requested by
+    * request_class_data_update() has been received.
+    *  @return True if caught up with the federation. */
+   bool const is_caught_up() const
+   {
+      return ( this->catch_up_remaining_count == 0 );
+   }
+
+   /*! @brief Get the number of objects requested by request_class_data_update()
+    * whose data has not been received yet.
+    *  @return Number of objects still to catch up. */
+   unsigned int get_catch_up_remaining_count() const
+   {
+      return this->catch_up_remaining_count;
+   }
+
+   /*! @brief Get the fraction of the objects requested by
+    * request_class_data_update() whose data has been received.
+    *  @return Catch-up progress from 0 to 1. */
+   double get_catch_up_progress() const
+   {
+      return ( this->catch_up_expected_count > 0 )
+                ? ( (double)( catch_up_expected_count - catch_up_remaining_count ) / (double)catch_up_expected_count )
+                : 1.0;
+   }
+
+   /*! @brief Determine if the requested attribute updates are paced over
+    * the data cycles.
+    *  @return True if the catch-up pacing is enabled. */
+   bool const is_catch_up_paced() const
+   {
+      return ( this->catch_up_cycle_count > 0 ) || ( this->catch_up_bytes_per_cycle > 0 );
+   }
+
+   /*! @brief Get the number of objects with requested attribute updates
+    * waiting to be sent within the catch-up pacing.
+    *  @return Number of objects queued. */
+   unsigned int get_catch_up_queue_size();
+
    /*! @brief Send cyclic an requested atrributes data to the remote federates. */
    void send_cyclic_and_requested_data();
 
+   /*! @brief Send cyclic and requested attributes data for the objects the
+    * Trick child thread owns, called from that child thread.
+    *  @param thread_id Trick child thread ID. */
+   void send_cyclic_and_requested_data_for_thread( unsigned int const thread_id );
+
    /*! @brief Handle the received cyclic data. */
    void receive_cyclic_data();
 
@@ -244,6 +337,179 @@ class Manager
     *  @param object TrickHLA::Object to add to the manager object map. */
    void add_object_to_map( Object *object );
 
+   /*! @brief Mark the TrickHLA::Object as having new data to process, which
+    * adds it to the active set of objects visited by receive_cyclic_data().
+    *  @param object TrickHLA::Object that received new data. */
+   void mark_object_as_changed( Object const *object );
+
+   /*! @brief Mark the TrickHLA::Object as having a change in the attributes
+    * it publishes or owns, which puts it back on the send schedule.
+    *  @param object TrickHLA::Object with the publish or ownership change. */
+   void mark_object_send_schedule_changed( Object const *object );
+
+   /*! @brief Get the total number of objects that can be instantiated from
+    * the object templates, which is how many more elements than the number
+    * of configured objects the 'objects' array must be allocated with.
+    *  @return Total pool size of all the object templates. */
+   int get_object_template_pool_size() const;
+
+   /*! @brief Get the number of elements allocated for the 'objects' array,
+    * which is greater than the object count if object templates are used.
+    *  @return Number of elements allocated for the objects array. */
+   unsigned int get_object_capacity() const;
+
+   /*! @brief Enable or disable the collection of the performance metrics
+    * of the objects, such as pack and unpack times and bytes sent.
+    *  @param collect True to collect the performance metrics. */
+   void set_collect_metrics( bool const collect )
+   {
+      this->collect_metrics = collect;
+   }
+
+   /*! @brief Determine if the performance metrics of the objects are collected.
+    *  @return True if the performance metrics are collected. */
+   bool const is_collecting_metrics() const
+   {
+      return this->collect_metrics;
+   }
+
+   /*! @brief Determine if the send rate of attributes is degraded when the
+    * send and receive time is over budget.
+    *  @return True if send rate degradation is enabled. */
+   bool const is_send_degradation_enabled() const
+   {
+      return ( this->send_receive_budget > 0.0 );
+   }
+
+   /*! @brief Get the current send rate degradation level, where zero is no
+    * degradation and SEND_PRIORITY_LOW is the maximum.
+    *  @return Send rate degradation level. */
+   int get_send_degradation_level() const
+   {
+      return this->send_degradation_level;
+   }
+
+   /*! @brief Get the wall clock time to send and receive the cyclic data for
+    * the last data cycle.
+    *  @return Send and receive time in seconds. */
+   double get_send_receive_time() const
+   {
+      return (double)this->send_receive_wall_time / 1000000.0;
+   }
+
+   /*! @brief Get the number of attribute sends dropped across all the objects
+    * because the send rate was degraded.
+    *  @return Number of dropped attribute sends. */
+   unsigned long long get_dropped_send_count() const;
+
+   /*! @brief Determine if the cyclic attribute updates are sent from the
+    * dedicated sender thread.
+    *  @return True if the sender thread is running. */
+   bool const is_async_send_enabled() const
+   {
+      return this->sender_thread.is_running();
+   }
+
+   /*! @brief Get the dedicated sender thread.
+    *  @return The sender thread. */
+   SenderThread &get_sender_thread()
+   {
+      return this->sender_thread;
+   }
+
+   /*! @brief Block until the sender thread has sent all the queued updates,
+    * which must be done before a time advance request or a synchronous send. */
+   void flush_async_send()
+   {
+      this->sender_thread.flush();
+   }
+
+   /*! @brief Send any queued updates and stop the sender thread. */
+   void stop_async_send();
+
+   /*! @brief Get the interaction outbox of the calling Trick thread.
+    *  @return The outbox, or NULL if the interaction outboxes are not
+    *  configured or the calling thread is not a Trick thread. */
+   InteractionOutbox *get_interaction_outbox();
+
+   /*! @brief Send the interactions queued in the outboxes of all the Trick
+    * threads, Receive Order first and then in timestamp order. */
+   void flush_interaction_outboxes();
+
+   /*! @brief Get the number of interactions sent from the outboxes.
+    *  @return Number of outbox interactions sent. */
+   unsigned long long get_outbox_sent_count() const
+   {
+      return outbox_sent_count;
+   }
+
+   /*! @brief Get the average wall clock time from enqueuing an interaction
+    * in an outbox to sending it.
+    *  @return Average enqueue to send latency in seconds. */
+   double get_outbox_latency_mean() const
+   {
+      return ( outbox_sent_count > 0 )
+                ? ( (double)outbox_latency_sum / (double)outbox_sent_count ) / 1000000.0
+                : 0.0;
+   }
+
+   /*! @brief Get the maximum wall clock time from enqueuing an interaction
+    * in an outbox to sending it.
+    *  @return Maximum enqueue to send latency in seconds. */
+   double get_outbox_latency_max() const
+   {
+      return (double)outbox_latency_max / 1000000.0;
+   }
+
+   /*! @brief Get the number of interaction sends dropped because an outbox
+    * was full.
+    *  @return Number of dropped outbox sends. */
+   unsigned long long get_outbox_overflow_count() const;
+
+   /*! @brief Get the number of received interactions waiting to be processed.
+    *  @return Number of queued interactions. */
+   int get_interactions_queue_size() const
+   {
+      return interactions_queue.size();
+   }
+
+   /*! @brief Get the deepest the received interactions queue has been.
+    *  @return Peak number of queued interactions. */
+   int get_interactions_queue_peak_depth() const
+   {
+      return interactions_queue_peak_depth;
+   }
+
+   /*! @brief Get the number of received interactions dropped by the
+    * interaction queue overflow policy.
+    *  @return Number of dropped interactions. */
+   unsigned long long get_interactions_dropped_count() const
+   {
+      return interactions_dropped_count;
+   }
+
+   /*! @brief Get the number of queued interactions replaced by a newer
+    * interaction of the same class.
+    *  @return Number of conflated interactions. */
+   unsigned long long get_interactions_conflated_count() const
+   {
+      return interactions_conflated_count;
+   }
+
+   /*! @brief Get the number of times the RTI callback blocked for room in
+    * the interaction queue.
+    *  @return Number of blocked interactions. */
+   unsigned long long get_interactions_blocked_count() const
+   {
+      return interactions_blocked_count;
+   }
+
+   /*! @brief Get the array index of the specified TrickHLA::Object.
+    *  @return True if the object is in the manager objects array.
+    *  @param object    TrickHLA::Object to get the array index for.
+    *  @param obj_index Array index of the object. */
+   bool get_object_index( Object const *object, unsigned int &obj_index ) const;
+
    /*! @brief Get the pointer to the associated TrickHLA::Federate instance.
     *  @return Pointer to the associated TrickHLA::Federate instance. */
    Federate *get_federate()
@@ -466,6 +732,12 @@ class Manager
   private:
    ItemQueue interactions_queue; ///< @trick_io{**} Interactions queue.
 
+   int                interactions_queue_peak_depth; ///< @trick_units{count} Deepest the interactions queue has been.
+   unsigned long long interactions_dropped_count;    ///< @trick_units{count} Number of interactions dropped by the overflow policy.
+   unsigned long long interactions_conflated_count;  ///< @trick_units{count} Number of queued interactions replaced by a newer one of the same class.
+   unsigned long long interactions_blocked_count;    ///< @trick_units{count} Number of times the RTI callback blocked for room.
+   bool               interactions_queue_overflowed; ///< @trick_io{**} True once the interactions queue reached its maximum depth, until it drains, guarded by the interactions queue mutex.
+
    int              check_interactions_count; ///< @trick_units{--} Number of checkpointed interactions
    InteractionItem *check_interactions;       ///< @trick_units{--} checkpoint-able version of interactions_queue
 
@@ -477,12 +749,77 @@ class Manager
 
    bool mgr_initialized; ///< @trick_units{--} Internal flag to indicate Manager is initialized.
 
+   bool collect_metrics; ///< @trick_units{--} True to collect the performance metrics of the objects.
+
    MutexLock obj_discovery_mutex; ///< @trick_io{**} Mutex to lock thread over critical code sections.
 
-   ObjectInstanceMap object_map; ///< @trick_io{**} Map of all the Objects this federate uses, the Key is the object instance-handle.
+   ObjectInstanceMap object_map; ///< @trick_io{**} Map of all the Objects this federate uses, the Key is the object instance-handle, protected by the obj_discovery_mutex.
 
    TrickHLAObjInstanceNameIndexMap obj_name_index_map; ///< @trick_io{**} Map of object instance names to array index.
 
+   // Discovery indexes, protected by the obj_discovery_mutex.
+   bool                    discovery_index_initialized; ///< @trick_io{**} True if the discovery indexes have been initialized.
+   ObjectClassNameIndexMap discovery_name_index_map;    ///< @trick_io{**} Object array index by class handle and instance name.
+   ObjectClassIndexSetMap  discovery_free_index_map;    ///< @trick_io{**} Unregistered remote objects without a required name by class handle.
+   VectorOfWstrings        discovery_obj_names;         ///< @trick_io{**} Instance name each object is indexed by in the discovery name index.
+
+   // Active sets of objects so that the per data cycle cost scales with the
+   // activity of the objects instead of the number of configured objects.
+   bool active_sets_initialized;   ///< @trick_io{**} True if the active sets of objects have been initialized.
+   bool send_schedule_initialized; ///< @trick_io{**} True if the object send schedule has been initialized.
+
+   MutexLock active_set_mutex; ///< @trick_io{**} Mutex to lock the active sets updated from the RTI callback thread.
+
+   ObjectIndexSet changed_obj_set;   ///< @trick_io{**} Indexes of objects with received data to process.
+   ObjectIndexSet deleted_obj_set;   ///< @trick_io{**} Indexes of objects pending delete processing.
+   ObjectIndexSet requested_obj_set; ///< @trick_io{**} Indexes of objects with pending attribute update requests.
+   ObjectIndexSet reschedule_obj_set; ///< @trick_io{**} Indexes of objects with a publish or ownership change to put back on the send schedule.
+
+   // Catch-up of late joining federates, where the owner side queue and the
+   // pending set are also protected by the active_set_mutex.
+   std::deque< unsigned int > catch_up_queue;           ///< @trick_io{**} Indexes of objects with attribute update requests paced over the data cycles, oldest first.
+   ObjectIndexSet             catch_up_queued_obj_set;  ///< @trick_io{**} Indexes of the objects in the catch-up queue.
+   size_t                     catch_up_objs_per_cycle;  ///< @trick_io{**} Number of queued objects sent per data cycle to empty the queue in the catch-up cycle count.
+   ObjectIndexSet             catch_up_pending_obj_set; ///< @trick_io{**} Indexes of the objects requested by request_class_data_update() not received yet.
+   unsigned int               catch_up_expected_count;  ///< @trick_io{**} Number of objects requested by request_class_data_update().
+   unsigned int               catch_up_remaining_count; ///< @trick_io{**} Number of the requested objects not received as of the last data cycle.
+   int64_t                    catch_up_start_wall_time; ///< @trick_units{us} Wall clock time of the request_class_data_update().
+
+   std::vector< unsigned int > blocking_read_obj_list; ///< @trick_io{**} Indexes of objects using blocking cyclic reads, visited every data cycle.
+   std::vector< unsigned int > always_send_obj_list;   ///< @trick_io{**} Indexes of objects checked for a send every data cycle.
+
+   int64_t                send_cycle_count;    ///< @trick_io{**} Number of send_cyclic_and_requested_data() data cycles.
+   ObjectIndexScheduleMap send_schedule;       ///< @trick_io{**} Object indexes keyed by the send data cycle they are next due.
+   std::vector< int64_t > obj_next_send_cycle; ///< @trick_io{**} Data cycle each object is next due to send, -1 if not scheduled, -2 if always checked.
+   std::vector< int64_t > obj_last_send_cycle; ///< @trick_io{**} Data cycle each scheduled object was last checked for a send.
+
+   // Send schedules of the Trick child threads indexed by the Trick thread ID,
+   // where each child thread only accesses its own entries. The requested
+   // object sets are also protected by the active_set_mutex.
+   std::vector< ObjectIndexSet >              thread_requested_obj_set;    ///< @trick_io{**} Indexes of the objects of each Trick thread with pending attribute update requests.
+   std::vector< ObjectIndexSet >              thread_reschedule_obj_set;   ///< @trick_io{**} Indexes of the objects of each Trick thread with a publish or ownership change.
+   std::vector< std::vector< unsigned int > > thread_always_send_obj_list; ///< @trick_io{**} Indexes of the objects of each Trick thread checked for a send every thread data cycle.
+   std::vector< int64_t >                     thread_send_cycle_count;     ///< @trick_io{**} Number of send_cyclic_and_requested_data_for_thread() data cycles of each Trick thread.
+   std::vector< ObjectIndexScheduleMap >      thread_send_schedule;        ///< @trick_io{**} Object indexes of each Trick thread keyed by the thread data cycle they are next due.
+   std::vector< std::vector< int64_t > >      thread_obj_next_send_cycle;  ///< @trick_io{**} Thread data cycle each object is next due to send, -1 if not scheduled, -2 if always checked.
+   std::vector< std::vector< int64_t > >      thread_obj_last_send_cycle;  ///< @trick_io{**} Thread data cycle each scheduled object was last checked for a send.
+
+   int     send_degradation_level; ///< @trick_units{--}    Current send rate degradation level.
+   int     over_budget_cycles;     ///< @trick_units{count} Consecutive data cycles over the send and receive budget.
+   int     under_budget_cycles;    ///< @trick_units{count} Consecutive data cycles under the recover budget.
+   int64_t receive_wall_time;      ///< @trick_units{us}    Wall clock time spent receiving cyclic data this data cycle.
+   int64_t send_receive_wall_time; ///< @trick_units{us}    Wall clock time spent sending and receiving cyclic data last data cycle.
+
+   SenderThread sender_thread; ///< @trick_io{**} Dedicated thread sending the cyclic attribute updates.
+
+   InteractionOutbox                      *interaction_outboxes;     ///< @trick_io{**} Interaction outbox of each Trick thread, indexed by the Trick thread ID.
+   unsigned int                            interaction_outbox_count; ///< @trick_io{**} Number of interaction outboxes.
+   std::vector< InteractionOutboxItem * >  outbox_pending;           ///< @trick_io{**} Reused list of the outbox items being flushed.
+   std::vector< unsigned int >             outbox_collected;         ///< @trick_io{**} Number of items collected from each outbox in the flush.
+   unsigned long long                      outbox_sent_count;        ///< @trick_io{**} Number of interactions sent from the outboxes.
+   int64_t                                 outbox_latency_sum;       ///< @trick_units{us} Sum of the enqueue to send latencies of the outbox interactions.
+   int64_t                                 outbox_latency_max;       ///< @trick_units{us} Maximum enqueue to send latency of the outbox interactions.
+
    bool federate_has_been_restored; ///< @trick_io{**} Federate has been restored. do not reserve the object names again!
 
    Federate *federate; ///< @trick_units{--} Associated TrickHLA Federate.
@@ -544,9 +881,144 @@ class Manager
    Object *get_unregistered_remote_object(
       RTI1516_NAMESPACE::ObjectClassHandle const &theObjectClass );
 
+   /*! @brief Verify the object templates and instantiate the first object
+    * for each so the object class is subscribed to with the other objects. */
+   void initialize_object_templates();
+
+   /*! @brief Instantiate the objects for the discovered instances queued for
+    * an object template and bind them to the instances. */
+   void instantiate_pending_template_objects();
+
+   /*! @brief Instantiate and initialize an object from the object template
+    * using the RTI handles of the first object instantiated from it.
+    *  @return The instantiated TrickHLA::Object.
+    *  @param template_index Array index of the object template. */
+   Object *instantiate_object_from_template( int const template_index );
+
+   /*! @brief Queue the discovered instance for an object to be instantiated
+    * from the object template for the class, which must be called with the
+    * obj_discovery_mutex locked.
+    *  @return True if queued; False if no template or the pool is exhausted.
+    *  @param theObject             Object instance handle.
+    *  @param theObjectClass        RTI Object class type.
+    *  @param theObjectInstanceName Object instance name. */
+   bool queue_template_instance( RTI1516_NAMESPACE::ObjectInstanceHandle const &theObject,
+                                 RTI1516_NAMESPACE::ObjectClassHandle const    &theObjectClass,
+                                 std::wstring const                            &theObjectInstanceName );
+
+   /*! @brief Bind the unregistered object to the discovered object instance,
+    * which must be called with the obj_discovery_mutex locked.
+    *  @param trickhla_obj          Unregistered TrickHLA Object.
+    *  @param theObject             Object instance handle.
+    *  @param theObjectInstanceName Object instance name. */
+   void bind_discovered_object( Object                                        *trickhla_obj,
+                                RTI1516_NAMESPACE::ObjectInstanceHandle const &theObject,
+                                std::wstring const                            &theObjectInstanceName );
+
+   /*! @brief Clear the object discovery indexes. */
+   void clear_discovery_indexes();
+
+   /*! @brief Initialize the object discovery indexes for all the objects. */
+   void initialize_discovery_indexes();
+
+   /*! @brief Update the discovery indexes for the object at the given array
+    * index to reflect the current object instance name and registration.
+    *  @param obj_index Array index of the object. */
+   void update_discovery_indexes( unsigned int const obj_index );
+
    /*! @brief Determines the job cycle time. */
    void determine_job_cycle_time();
 
+   /*! @brief Clear the active sets of objects so they are rebuilt on the next
+    * data cycle. */
+   void clear_active_sets();
+
+   /*! @brief Initialize the active sets of objects with received data,
+    * pending deletes, and objects using blocking cyclic reads. */
+   void initialize_active_sets();
+
+   /*! @brief Initialize the schedule of when each object is next due to
+    * send cyclic data, which requires the job cycle time to be known. */
+   void initialize_send_schedule();
+
+   /*! @brief Schedule the next data cycle the object is due to send data.
+    *  @param obj_index Array index of the object. */
+   void schedule_object_send( unsigned int const obj_index );
+
+   /*! @brief Allocate the send schedule of each Trick thread. */
+   void setup_thread_send_schedules();
+
+   /*! @brief Initialize the schedule of when each object the Trick child
+    * thread sends is next due, for the objects added since the last call.
+    *  @param thread_id        Trick child thread ID.
+    *  @param thread_obj_count Number of objects to schedule. */
+   void initialize_thread_send_schedule( unsigned int const thread_id,
+                                         unsigned int const thread_obj_count );
+
+   /*! @brief Schedule the next data cycle of the Trick child thread the
+    * object is due to send data.
+    *  @param thread_id Trick child thread ID.
+    *  @param obj_index Array index of the object. */
+   void schedule_object_send_for_thread( unsigned int const thread_id,
+                                         unsigned int const obj_index );
+
+   /*! @brief Insert the object into the set of requested objects of the Trick
+    * thread that sends it, which must be called with the active_set_mutex
+    * locked.
+    *  @param obj_index Array index of the object. */
+   void insert_requested_object( unsigned int const obj_index );
+
+   /*! @brief Queue an object with an attribute update request to be sent,
+    * paced over the data cycles if catch-up pacing is enabled.
+    *  @param obj_index Array index of the object. */
+   void add_requested_object( unsigned int const obj_index );
+
+   /*! @brief Put an object with an attribute update request that is not on
+    * its data cycle boundary back at the front of the catch-up queue, so it
+    * keeps its place instead of waiting behind the newer requests.
+    *  @param obj_index Array index of the object. */
+   void requeue_requested_object( unsigned int const obj_index );
+
+   /*! @brief Move the queued objects with attribute update requests that fit
+    * in the catch-up budget of this data cycle to the set of objects due.
+    *  @param due_obj_set Set of object indexes to send this data cycle. */
+   void schedule_catch_up_objects( ObjectIndexSet &due_obj_set );
+
+   /*! @brief Report the progress of receiving the objects requested by
+    * request_class_data_update(), and stop waiting for the objects not
+    * received within the catch-up timeout. */
+   void check_catch_up_progress();
+
+   /*! @brief Verify the send rate degradation settings. */
+   void verify_send_degradation_settings();
+
+   /*! @brief Verify the interaction queue overflow settings. */
+   void verify_interactions_queue_settings();
+
+   /*! @brief Apply the overflow policy if the interactions queue is at its
+    * maximum depth, called from the RTI callback thread.
+    *  @param index Interaction index of the received interaction.
+    *  @return True to queue the received interaction, false to drop it. */
+   bool const make_room_in_interactions_queue( int const index );
+
+   /*! @brief Start the dedicated sender thread if asynchronous sending of the
+    * cyclic attribute updates is configured. */
+   void start_async_send();
+
+   /*! @brief Allocate an interaction outbox for each Trick thread if the
+    * interaction outboxes are configured. */
+   void setup_interaction_outboxes();
+
+   /*! @brief Get the number of threads to initialize the object attributes
+    * and interaction parameters with.
+    *  @return Number of setup threads, at least one. */
+   unsigned int get_setup_thread_count() const;
+
+   /*! @brief Update the send rate degradation level from the wall clock time
+    * to send and receive the cyclic data for this data cycle.
+    *  @param send_receive_time Send and receive wall clock time in microseconds. */
+   void update_send_degradation( int64_t const send_receive_time );
+
    // Ownership
    /*! @brief Pull ownership from the other federates if the pull ownership
     * flag has been enabled. */
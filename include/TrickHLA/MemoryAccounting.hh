@@ -0,0 +1,148 @@
+/*!
+@file TrickHLA/MemoryAccounting.hh
+@ingroup TrickHLA
+@brief This class accounts for the memory TrickHLA itself allocates, per
+subsystem and per object, interaction and FOM class, and prints a report of
+the current bytes, peak bytes and allocation counts on demand.
+
+The attribute and parameter buffers, received interaction items, queued
+reflections and OpaqueBuffer encoders record their allocations as they happen.
+The Management Object Model (MOM) federate tables are sampled by update().
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/Federate.cpp}
+@trick_link_dependency{../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../source/TrickHLA/MemoryAccounting.cpp}
+@trick_link_dependency{../../source/TrickHLA/MemoryUsage.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MEMORY_ACCOUNTING_HH
+#define TRICKHLA_MEMORY_ACCOUNTING_HH
+
+// System include files.
+#include <stdint.h>
+
+// TrickHLA include files.
+#include "TrickHLA/MemoryUsage.hh"
+#include "TrickHLA/Types.hh"
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Federate;
+class Manager;
+
+class MemoryAccounting
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__MemoryAccounting();
+
+  public:
+   bool print_on_shutdown; ///< @trick_units{--} True to print the report at shutdown (default: true).
+   int  report_object_max; ///< @trick_units{count} Number of the largest objects and interactions listed in the report, zero for all (default: 10).
+
+   // Subsystem usage as of the last update(), indexed by MemorySubsystemEnum.
+   int64_t current_bytes[MEMORY_SUBSYSTEM_COUNT]; ///< @trick_units{count} Bytes currently allocated by each subsystem.
+   int64_t peak_bytes[MEMORY_SUBSYSTEM_COUNT];    ///< @trick_units{count} Most bytes allocated at once by each subsystem.
+   int64_t alloc_count[MEMORY_SUBSYSTEM_COUNT];   ///< @trick_units{count} Number of allocations by each subsystem.
+
+   int64_t total_current_bytes; ///< @trick_units{count} Bytes currently allocated by all subsystems.
+   int64_t total_peak_bytes;    ///< @trick_units{count} Most bytes allocated by all subsystems as of an update().
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA MemoryAccounting class. */
+   MemoryAccounting();
+   /*! @brief Destructor for the TrickHLA MemoryAccounting class. */
+   virtual ~MemoryAccounting();
+
+   /*! @brief Configure the memory accounting.
+    *  @param fed The TrickHLA Federate to sample the MOM tables of.
+    *  @param mgr The TrickHLA Manager with the objects and interactions. */
+   void configure( Federate *fed,
+                   Manager  *mgr );
+
+   /*! @brief Initialize the memory accounting. */
+   void initialize();
+
+   /*! @brief Sample the MOM tables and update the subsystem usage Trick
+    * variables, which is scheduled periodically. */
+   void update();
+
+   /*! @brief Print the memory report, which can be called on demand from
+    * the input processor or the variable server. */
+   void print_report();
+
+   /*! @brief Print the memory report at shutdown if configured to. */
+   void shutdown();
+
+   /*! @brief Record a change in the bytes allocated by a subsystem.
+    *  @param subsystem   The subsystem that allocated or freed the memory.
+    *  @param delta_bytes Change in the number of allocated bytes.
+    *  @param owner       Usage of the object or interaction the memory is for, or NULL. */
+   static void record( MemorySubsystemEnum const subsystem,
+                       int64_t const             delta_bytes,
+                       MemoryUsage              *owner = NULL );
+
+   /*! @brief Get the usage of a subsystem.
+    *  @return The memory usage of the subsystem.
+    *  @param subsystem The subsystem. */
+   static MemoryUsage const &get_subsystem_usage( MemorySubsystemEnum const subsystem );
+
+   /*! @brief Get the name of a subsystem for the report.
+    *  @return The name of the subsystem.
+    *  @param subsystem The subsystem. */
+   static char const *get_subsystem_name( MemorySubsystemEnum const subsystem );
+
+  protected:
+   Federate *federate; ///< @trick_io{**} Federate to sample the MOM tables of.
+   Manager  *manager;  ///< @trick_io{**} Manager with the objects and interactions.
+
+   static MemoryUsage subsystem_usage[MEMORY_SUBSYSTEM_COUNT]; ///< @trick_io{**} Process wide usage of each subsystem.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for MemoryAccounting class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   MemoryAccounting( MemoryAccounting const &rhs );
+   /*! @brief Assignment operator for MemoryAccounting class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   MemoryAccounting &operator=( MemoryAccounting const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_MEMORY_ACCOUNTING_HH: Do NOT put anything after this line!
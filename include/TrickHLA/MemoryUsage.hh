@@ -0,0 +1,100 @@
+/*!
+@file TrickHLA/MemoryUsage.hh
+@ingroup TrickHLA
+@brief This class holds the current bytes, peak bytes and allocation count
+of memory accounted to a TrickHLA subsystem, object or interaction.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/MemoryUsage.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MEMORY_USAGE_HH
+#define TRICKHLA_MEMORY_USAGE_HH
+
+// System include files.
+#include <stdint.h>
+
+namespace TrickHLA
+{
+
+class MemoryUsage
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__MemoryUsage();
+
+  public:
+   int64_t current_bytes; ///< @trick_units{count} Bytes currently allocated.
+   int64_t peak_bytes;    ///< @trick_units{count} Most bytes allocated at once.
+   int64_t alloc_count;   ///< @trick_units{count} Number of allocations and buffer growths.
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA MemoryUsage class. */
+   MemoryUsage();
+   /*! @brief Destructor for the TrickHLA MemoryUsage class. */
+   virtual ~MemoryUsage();
+
+   /*! @brief Record a change in the allocated bytes, where a positive change
+    * counts as an allocation. This is lock free so that the RTI callback and
+    * Trick child threads can record their allocations concurrently.
+    *  @param delta_bytes Change in the number of allocated bytes. */
+   void record( int64_t const delta_bytes );
+
+   /*! @brief Set the usage of memory that is sampled rather than tracked
+    * allocation by allocation.
+    *  @param bytes   Bytes currently allocated.
+    *  @param entries Number of allocated entries. */
+   void set( int64_t const bytes,
+             int64_t const entries );
+
+   /*! @brief Add another usage to this one, such as to total a FOM class,
+    * where the summed peak is an upper bound of the combined peak.
+    *  @param usage The usage to add. */
+   void add( MemoryUsage const &usage );
+
+   /*! @brief Reset the usage to zero. */
+   void reset();
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for MemoryUsage class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   MemoryUsage( MemoryUsage const &rhs );
+   /*! @brief Assignment operator for MemoryUsage class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   MemoryUsage &operator=( MemoryUsage const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_MEMORY_USAGE_HH: Do NOT put anything after this line!
@@ -0,0 +1,132 @@
+/*!
+@file TrickHLA/MonotonicClock.hh
+@ingroup TrickHLA
+@brief This class provides a low overhead monotonic clock in integer
+nanoseconds for the TrickHLA timeouts, statistics and profiling.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/MonotonicClock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MONOTONIC_CLOCK_HH
+#define TRICKHLA_MONOTONIC_CLOCK_HH
+
+// System include files.
+#include <cstdint>
+#include <time.h>
+
+namespace TrickHLA
+{
+
+class MonotonicClock
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__MonotonicClock();
+
+  public:
+   /*! @brief Calibrate the clock, which is done automatically on first use.
+    *  @details The invariant Time Stamp Counter (TSC) is used if the CPU has
+    *  one and its rate calibrates consistently against CLOCK_MONOTONIC,
+    *  otherwise the clock falls back to CLOCK_MONOTONIC. */
+   static void initialize();
+
+   /*! @brief Get the monotonic time in nanoseconds.
+    *  @return Monotonic time in nanoseconds, from an arbitrary origin. */
+   static int64_t get_time_nanos()
+   {
+      if ( !initialized ) {
+         initialize();
+      }
+#if defined( __x86_64__ )
+      if ( use_tsc ) {
+         uint64_t const ticks = __builtin_ia32_rdtsc() - base_ticks;
+         return base_nanos + (int64_t)( ( (unsigned __int128)ticks * nanos_per_tick ) >> 32 );
+      }
+#endif
+      return get_monotonic_nanos();
+   }
+
+   /*! @brief Get the monotonic time in microseconds.
+    *  @return Monotonic time in microseconds, from an arbitrary origin. */
+   static int64_t get_time_micros()
+   {
+      return get_time_nanos() / 1000;
+   }
+
+   /*! @brief Determine if the clock uses the Time Stamp Counter.
+    *  @return True if the TSC is used, false if using CLOCK_MONOTONIC. */
+   static bool const is_using_tsc()
+   {
+      if ( !initialized ) {
+         initialize();
+      }
+      return use_tsc;
+   }
+
+   /*! @brief Get the calibrated Time Stamp Counter frequency.
+    *  @return TSC frequency in Hz, or zero if the TSC is not used. */
+   static double get_tsc_frequency();
+
+  private:
+   /*! @brief Get the time from CLOCK_MONOTONIC.
+    *  @return Monotonic time in nanoseconds. */
+   static int64_t get_monotonic_nanos()
+   {
+      struct timespec ts;
+      clock_gettime( CLOCK_MONOTONIC, &ts );
+      return ( (int64_t)ts.tv_sec * 1000000000LL ) + (int64_t)ts.tv_nsec;
+   }
+
+   /*! @brief Calibrate the clock, called once by initialize(). */
+   static void calibrate();
+
+   static volatile bool initialized; ///< @trick_io{**} True once the clock is calibrated.
+   static bool          use_tsc;     ///< @trick_io{**} True if the TSC is used.
+
+   static uint64_t base_ticks;     ///< @trick_io{**} TSC value at the calibration base time.
+   static int64_t  base_nanos;     ///< @trick_io{**} CLOCK_MONOTONIC time at the calibration base time.
+   static uint64_t nanos_per_tick; ///< @trick_io{**} Nanoseconds per TSC tick as a 32.32 fixed point value.
+
+  private:
+   // This class only has static functions.
+   /*! @brief Default constructor for the TrickHLA MonotonicClock class. */
+   MonotonicClock();
+   /*! @brief Copy constructor for MonotonicClock class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   MonotonicClock( MonotonicClock const &rhs );
+   /*! @brief Assignment operator for MonotonicClock class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   MonotonicClock &operator=( MonotonicClock const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_MONOTONIC_CLOCK_HH: Do NOT put anything after this line!
@@ -28,6 +28,8 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Int64Time.cpp}
 @trick_link_dependency{../../source/TrickHLA/LagCompensation.cpp}
 @trick_link_dependency{../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../source/TrickHLA/MemoryAccounting.cpp}
+@trick_link_dependency{../../source/TrickHLA/MemoryUsage.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexProtection.cpp}
 @trick_link_dependency{../../source/TrickHLA/OwnershipHandler.cpp}
@@ -50,6 +52,7 @@ NASA, Johnson Space Center\n
 // System include files.
 #include <pthread.h>
 #include <string>
+#include <vector>
 
 // Trick include files.
 #include "trick/attributes.h"
@@ -61,6 +64,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/ElapsedTimeStats.hh"
 #include "TrickHLA/Int64Interval.hh"
 #include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/MemoryUsage.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/ReflectedAttributesQueue.hh"
@@ -137,6 +141,8 @@ class Object
 
    bool blocking_cyclic_read; ///< @trick_units{--} True to block in receive_cyclic_data() for data to be received.
 
+   bool zero_copy_send; ///< @trick_units{--} True to keep a persistent attribute value map that points at the attribute buffers instead of copying them for each send, which is not used with asynchronous sends (default: false).
+
    char *thread_ids; ///< @trick_units{--} Comma separated list of Trick child thread IDs associated to this object.
 
    int        attr_count; ///< @trick_units{--} Number of object attributes.
@@ -145,6 +151,12 @@ class Object
    LagCompensation    *lag_comp;      ///< @trick_units{--} Lag compensation object.
    LagCompensationEnum lag_comp_type; ///< @trick_units{--} Type of lag compensation.
 
+   ReflectionConflationEnum reflection_conflation;      ///< @trick_units{--} Conflation mode of queued reflections, requires THLA_QUEUE_REFLECTED_ATTRIBUTES (default: REFLECTION_CONFLATION_NONE).
+   int                      reflection_queue_max_depth; ///< @trick_units{count} Maximum number of queued reflections before the overflow policy applies, zero for unbounded (default: 0).
+   QueueOverflowPolicyEnum  reflection_queue_policy;    ///< @trick_units{--} Policy applied when the reflection queue is at its maximum depth, requires THLA_QUEUE_REFLECTED_ATTRIBUTES (default: QUEUE_OVERFLOW_CONFLATE).
+
+   SendPriorityEnum send_priority; ///< @trick_units{--} Send priority of the attributes that do not specify their own (default: SEND_PRIORITY_NORMAL).
+
    Packing *packing; ///< @trick_units{--} Data pack/unpack object.
 
    OwnershipHandler *ownership; ///< @trick_units{--} Manages attribute ownership.
@@ -153,6 +165,8 @@ class Object
 
    Conditional *conditional; ///< @trick_units{--} Handler for a conditional attribute
 
+   MemoryUsage memory_usage; ///< @trick_units{--} Memory TrickHLA allocated for the attribute buffers and queued reflections of this object.
+
   public:
    //
    // Public constructors and destructor.
@@ -208,6 +222,31 @@ class Object
     *  @param cycle_time The core job cycle time in seconds. */
    void set_core_job_cycle_time( double const cycle_time );
 
+   /*! @brief Advance the sub-rate counters of all the attributes for the
+    * data cycles this object was not checked for a cyclic send.
+    *  @param skipped_cycles Number of data cycles that were skipped. */
+   void skip_data_cycles( int const skipped_cycles );
+
+   /*! @brief Get the number of data cycles until any published cyclic
+    * attribute of this object is ready to send.
+    *  @return Number of data cycles until the next send, or zero if this
+    *  object does not publish any cyclic attributes. */
+   int get_data_cycles_until_ready() const;
+
+   /*! @brief Degrade the send rate of the attributes based on their send
+    * priority. At a degradation level of N the send rate of the attributes
+    * within N levels of SEND_PRIORITY_LOW is divided by the degrade factor
+    * for each level they are within, and critical attributes are never
+    * degraded.
+    *  @param level          Degradation level, zero for no degradation.
+    *  @param degrade_factor Factor the cycle ratio is stretched by per level. */
+   void set_send_degradation_level( int const level, int const degrade_factor );
+
+   /*! @brief Get the number of attribute sends dropped because the send
+    * rate was degraded.
+    *  @return Number of dropped attribute sends. */
+   unsigned long long get_dropped_send_count() const;
+
    /*! @brief Marks this object as deleted from the RTI and sets all attributes as non-local. */
    void remove_object_instance();
 
@@ -269,11 +308,72 @@ class Object
     *  @param theAttributes The specified attributes. */
    void provide_attribute_update( RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes );
 
+   /*! @brief Subscribe to the FOM encoded values of the attributes that can
+    *  not be read from the shared-memory side channel of the publisher. */
+   void subscribe_to_shared_memory_fallback();
+
 #if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
    /*! @brief Enqueue the reflected attributes.
-    *  @param theAttributes Attributes data. */
-   void enqueue_data( RTI1516_NAMESPACE::AttributeHandleValueMap const &theAttributes );
+    *  @param theAttributes Attributes data.
+    *  @param time          HLA base time of a Timestamp Order reflection. */
+   void enqueue_data( RTI1516_NAMESPACE::AttributeHandleValueMap const &theAttributes,
+                      int64_t const                                     time = ReflectedAttributesQueue::RECEIVE_ORDER_TIME );
+
+   /*! @brief Get the number of reflections conflated in the reflection queue.
+    *  @return Number of conflated reflections. */
+   unsigned long long get_reflection_conflated_count() const
+   {
+      return thla_reflected_attributes_queue.get_conflated_count();
+   }
+
+   /*! @brief Get the number of queued attribute values replaced by a newer
+    * value in the reflection queue.
+    *  @return Number of replaced attribute values. */
+   unsigned long long get_reflection_conflated_attribute_count() const
+   {
+      return thla_reflected_attributes_queue.get_conflated_attribute_count();
+   }
+
+   /*! @brief Get the number of reflections dropped by the reflection queue
+    * overflow policy.
+    *  @return Number of dropped reflections. */
+   unsigned long long get_reflection_dropped_count() const
+   {
+      return thla_reflected_attributes_queue.get_dropped_count();
+   }
+
+   /*! @brief Get the number of times the RTI callback blocked for room in the
+    * reflection queue.
+    *  @return Number of blocked reflections. */
+   unsigned long long get_reflection_blocked_count() const
+   {
+      return thla_reflected_attributes_queue.get_blocked_count();
+   }
+
+   /*! @brief Get the deepest the reflection queue has been.
+    *  @return Peak number of queued reflections. */
+   unsigned int get_reflection_queue_peak_depth() const
+   {
+      return (unsigned int)thla_reflected_attributes_queue.get_peak_depth();
+   }
+#endif
+
+   /*! @brief Get the number of attribute value bytes received, which is
+    *  only counted while the manager is collecting metrics.
+    *  @return Cumulative number of attribute value bytes received. */
+   unsigned long long get_bytes_received();
+
+   /*! @brief Get the number of reflections waiting to be processed.
+    *  @return Number of queued reflections, which is always zero if the
+    *  reflected attributes are not queued. */
+   unsigned int get_reflection_queue_depth()
+   {
+#if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
+      return (unsigned int)thla_reflected_attributes_queue.size();
+#else
+      return 0;
 #endif
+   }
 
    /*! @brief This function extracts the new attribute values.
     *  @param theAttributes Attributes data.
@@ -519,6 +619,17 @@ class Object
     *  @return True for any remotely owned and subscribed attribute. */
    bool any_remotely_owned_subscribed_attribute();
 
+   /*! @brief Add the handles of the remotely owned and subscribed attributes
+    * to the set, which are the attributes an update can be requested for.
+    *  @param attr_handle_set Set of attribute handles to add to. */
+   void get_remotely_owned_subscribed_attributes( RTI1516_NAMESPACE::AttributeHandleSet &attr_handle_set );
+
+   /*! @brief Estimate the number of bytes sent for the requested attribute
+    * update, from the sizes of the locally owned and published attributes
+    * with an update requested.
+    *  @return Estimated size of the requested update in bytes. */
+   size_t get_requested_attribute_size();
+
    /*! @brief Determines if any attribute specified is remotely owned and
     * subscribed to for the given attribute configuration.
     *  @return True for any remotely owned, subscribed attribute.
@@ -587,7 +698,8 @@ class Object
    void set_to_unblocking_cyclic_reads();
 
    /*! @brief Notify any waiting threads of a change in attribute ownership,
-    * which could affect blocking reads. */
+    * which could affect blocking reads, and put the object back on the send
+    * schedule of the manager. */
    void notify_attribute_ownership_changed();
 
    /*! @brief Set the Lag Compensation type for object attribute updates.
@@ -632,6 +744,12 @@ class Object
     *  @param attr_handle Attribute ID. */
    Attribute *get_attribute( RTI1516_NAMESPACE::AttributeHandle attr_handle );
 
+   /*! @brief Get the attribute whose shared-memory descriptor is carried by
+    *  the given attribute handle.
+    *  @return The associated TrickHLA::Attribute, or NULL if not found.
+    *  @param attr_handle Descriptor attribute ID. */
+   Attribute *get_shared_memory_attribute( RTI1516_NAMESPACE::AttributeHandle attr_handle );
+
    /*! @brief Gets the attribute for the given FOM name.
     *  @return Associated TrickHLA::Attribute.
     *  @param attr_FOM_name Attribute FOM name. */
@@ -755,6 +873,21 @@ class Object
     * @param include_requested True to also included requeted attributes */
    void create_attribute_set( DataUpdateEnum const required_config, bool const include_requested );
 
+   /*! @brief Add the attribute value to the attribute value map.
+    * @param index     Index of the attribute.
+    * @param zero_copy True to point the value at the attribute buffer instead of copying it. */
+   void add_attribute_value( unsigned int const index, bool const zero_copy );
+
+   /*! @brief Determine if this federate sends the shared-memory descriptor
+    *  of the attribute.
+    *  @return True if the descriptor attribute is sent with the value.
+    *  @param index Index of the attribute. */
+   bool const is_shared_memory_sender( unsigned int const index ) const;
+
+   /*! @brief Remove the values of the attributes not added for this send
+    * from the persistent zero-copy attribute value map. */
+   void remove_excluded_attribute_values();
+
    /*! @brief Initialize the thread ID array based on the users 'thread_ids' input.*/
    void initialize_thread_ID_array();
 
@@ -787,6 +920,8 @@ class Object
 
    bool attr_update_requested; ///< @trick_units{--} Flag to indicate an attribute updated was requested by another federate.
 
+   bool shared_memory_inline_pending; ///< @trick_units{--} Flag to indicate an attribute needs to subscribe to the FOM encoded value instead of the shared-memory side channel.
+
    bool removed_instance; ///< @trick_units{--} Flag to indicate if object instance was removed from RTI.
 
    bool first_blocking_cyclic_read; ///< @trick_units{--} True if this is the first call to receive_cyclic_data for data to be received.
@@ -808,14 +943,26 @@ class Object
 
    RTI1516_NAMESPACE::AttributeHandleValueMap *attribute_values_map; ///< @trick_io{**} Map of attributes that will be sent as an update to other federates.
 
+   std::vector< bool > zero_copy_attr_included; ///< @trick_io{**} Per attribute index, true if the attribute was added to the zero-copy attribute value map for this send.
+
    ReflectedAttributesQueue thla_reflected_attributes_queue; ///< @trick_io{**} Queue of reflected attributes.
 
-   AttributeMap thla_attribute_map; ///< @trick_io{**} Map of the Attribute's, key is the AttributeHandle.
+   AttributeMap thla_attribute_map;     ///< @trick_io{**} Map of the Attribute's, key is the AttributeHandle.
+   AttributeMap thla_shm_attribute_map; ///< @trick_io{**} Map of the shared-memory Attribute's, key is the descriptor AttributeHandle.
 
   public:
    unsigned long long send_count;    ///< @trick_units{--} Number of times data from this object was sent.
    unsigned long long receive_count; ///< @trick_units{--} Number of times data for this object was received.
 
+   // Performance metrics, only collected if the manager is collecting metrics.
+   int64_t            pack_time;      ///< @trick_units{us} Cumulative wall clock time spent in the packing pack() function.
+   int64_t            unpack_time;    ///< @trick_units{us} Cumulative wall clock time spent in the packing unpack() function.
+   unsigned long long bytes_sent;     ///< @trick_units{count} Cumulative number of attribute value bytes sent.
+   unsigned long long bytes_received; ///< @trick_units{count} Cumulative number of attribute value bytes received, protected by the receive_mutex.
+
+   unsigned long long packed_attr_count;  ///< @trick_units{count} Cumulative number of attributes in the masks passed to pack() and unpack().
+   unsigned long long skipped_attr_count; ///< @trick_units{count} Cumulative number of attributes pack() and unpack() did not have to process.
+
    ElapsedTimeStats elapsed_time_stats; ///< @trick_units{--} Statistics of elapsed times between cyclic data reads.
 
   private:
@@ -831,6 +978,44 @@ class Object
       mark_changed();
    }
 
+   /*! @brief Determine if the manager is collecting performance metrics.
+    *  @return True if performance metrics are collected. */
+   bool const is_collecting_metrics() const;
+
+   /*! @brief Get the mask of the attributes due to be sent, using the same
+    *  criteria as create_attribute_set() except for the Conditional, which is
+    *  only checked after the data is packed.
+    *  @return Packing attribute mask of the attributes due to be sent.
+    *  @param required_config   Attribute configuration required in order to send data.
+    *  @param include_requested True to also include requested attributes. */
+   PackingAttributeMask const get_send_attribute_mask( DataUpdateEnum const required_config,
+                                                       bool const           include_requested ) const;
+
+   /*! @brief Get the mask of the requested attributes we own and publish.
+    *  @return Packing attribute mask of the requested attributes. */
+   PackingAttributeMask const get_requested_attribute_mask() const;
+
+   /*! @brief Get the mask of the attributes that were just received.
+    *  @return Packing attribute mask of the received attributes. */
+   PackingAttributeMask const get_received_attribute_mask() const;
+
+   /*! @brief Call the packing pack() function, timing it if collecting metrics.
+    *  @param attr_mask Mask of the attributes due to be sent. */
+   void pack_with_metrics( PackingAttributeMask const attr_mask );
+
+   /*! @brief Call the packing unpack() function, timing it if collecting metrics.
+    *  @param attr_mask Mask of the attributes that were just received. */
+   void unpack_with_metrics( PackingAttributeMask const attr_mask );
+
+   /*! @brief Add the number of attributes in and not in the mask to the
+    *  packing metrics if collecting metrics.
+    *  @param attr_mask Packing attribute mask passed to the packing object. */
+   void count_masked_attributes( PackingAttributeMask const attr_mask );
+
+   /*! @brief Add the size of the attribute values just sent to the bytes
+    * sent if collecting metrics. */
+   void count_bytes_sent();
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for Object class.
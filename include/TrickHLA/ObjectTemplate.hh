@@ -0,0 +1,208 @@
+/*!
+@file TrickHLA/ObjectTemplate.hh
+@ingroup TrickHLA
+@brief This class defines a class-level template used by the TrickHLA Manager
+to instantiate TrickHLA Objects for discovered object instances.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/ObjectTemplate.cpp}
+@trick_link_dependency{../../source/TrickHLA/Attribute.cpp}
+@trick_link_dependency{../../source/TrickHLA/LagCompensation.cpp}
+@trick_link_dependency{../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../source/TrickHLA/Packing.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_OBJECT_TEMPLATE_HH
+#define TRICKHLA_OBJECT_TEMPLATE_HH
+
+// System include files.
+#include <deque>
+#include <string>
+#include <utility>
+
+// TrickHLA include files.
+#include "TrickHLA/Types.hh"
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Attribute;
+class LagCompensation;
+class Object;
+class Packing;
+
+class ObjectTemplate
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__ObjectTemplate();
+
+   //----------------------------- USER VARIABLES -----------------------------
+   // Public data in this section are for either use within a users simulation
+   // or must be configured by the user.
+  public:
+   // The variables below this point are configured by the user in either the
+   // input or modified-data file.
+   char *name; ///< @trick_units{--} Template name used as the prefix of the Trick variable names allocated for each instance.
+
+   char *FOM_name; ///< @trick_units{--} FOM name for the object class.
+
+   int pool_size; ///< @trick_units{count} Maximum number of objects instantiated from this template.
+
+   int        attr_count; ///< @trick_units{--} Number of template attributes.
+   Attribute *attributes; ///< @trick_units{--} Template attributes, with a 'trick_name' relative to the packing instance.
+
+   Packing *packing; ///< @trick_units{--} Prototype packing object used to create the packing object for each instance.
+
+   LagCompensation    *lag_comp;      ///< @trick_units{--} Optional prototype lag compensation object used to create the lag compensation object for each instance.
+   LagCompensationEnum lag_comp_type; ///< @trick_units{--} Type of lag compensation.
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA ObjectTemplate class. */
+   ObjectTemplate();
+   /*! @brief Destructor for the TrickHLA ObjectTemplate class. */
+   virtual ~ObjectTemplate();
+
+   /*! @brief Verify the user specified template configuration. */
+   void initialize();
+
+   /*! @brief Determine if another object can be instantiated from this template.
+    *  @return True if the pool of objects for this template is not exhausted. */
+   bool const is_pool_available() const
+   {
+      return ( instance_count < pool_size );
+   }
+
+   /*! @brief Get the number of objects instantiated from this template.
+    *  @return Number of instantiated objects. */
+   int get_instance_count() const
+   {
+      return instance_count;
+   }
+
+   /*! @brief Get the index in the manager objects array of the first object
+    * instantiated from this template, which is instantiated at initialization.
+    *  @return Array index of the prototype object, or -1 if none. */
+   int get_prototype_index() const
+   {
+      return prototype_index;
+   }
+
+   /*! @brief Configure the unused object from the manager objects array as a
+    * new instance of this template, allocating its attributes, packing, and
+    * lag compensation objects.
+    *  @param obj       Unused object in the manager objects array.
+    *  @param obj_index Array index of the object. */
+   void instantiate( Object &obj, int const obj_index );
+
+   /*! @brief Determine if a discovered instance can be queued for an object
+    * to be instantiated from this template.
+    *  @return True if the pool has room for another queued instance. */
+   bool const is_pool_available_for_pending() const
+   {
+      return ( ( instance_count + (int)pending_instances.size() ) < pool_size );
+   }
+
+   /*! @brief Queue a discovered instance to bind to an object instantiated
+    * from this template on the Trick main thread.
+    *  @param instance_hdl  Object instance handle of the discovered instance.
+    *  @param instance_name Object instance name of the discovered instance. */
+   void add_pending_instance( RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_hdl,
+                              std::wstring const                            &instance_name )
+   {
+      pending_instances.push_back( std::make_pair( instance_hdl, instance_name ) );
+   }
+
+   /*! @brief Get the oldest queued discovered instance.
+    *  @return True if there is a queued instance; False otherwise.
+    *  @param instance_hdl  Object instance handle of the queued instance.
+    *  @param instance_name Object instance name of the queued instance. */
+   bool const get_pending_instance( RTI1516_NAMESPACE::ObjectInstanceHandle &instance_hdl,
+                                    std::wstring                            &instance_name ) const
+   {
+      if ( pending_instances.empty() ) {
+         return false;
+      }
+      instance_hdl  = pending_instances.front().first;
+      instance_name = pending_instances.front().second;
+      return true;
+   }
+
+   /*! @brief Remove the oldest queued discovered instance. */
+   void pop_pending_instance()
+   {
+      if ( !pending_instances.empty() ) {
+         pending_instances.pop_front();
+      }
+   }
+
+   /*! @brief Remove a queued discovered instance that was deleted before an
+    * object was bound to it.
+    *  @return True if the instance was queued; False otherwise.
+    *  @param instance_hdl Object instance handle of the deleted instance. */
+   bool remove_pending_instance( RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_hdl );
+
+   /*! @brief Remove all the queued discovered instances. */
+   void clear_pending_instances()
+   {
+      pending_instances.clear();
+   }
+
+  protected:
+   int instance_count;  ///< @trick_units{count} Number of objects instantiated from this template.
+   int prototype_index; ///< @trick_units{--} Manager objects array index of the first object instantiated from this template.
+
+   // Discovered instances waiting for an object to be instantiated on the
+   // Trick main thread, protected by the Manager obj_discovery_mutex.
+   std::deque< std::pair< RTI1516_NAMESPACE::ObjectInstanceHandle, std::wstring > > pending_instances; ///< @trick_io{**} Discovered instance handles and names waiting for an object, oldest first.
+
+  private:
+   /*! @brief Uses Trick memory allocation routines to allocate a new string
+    *  that is input file compliant. */
+   char *allocate_input_string( std::string const &cpp_string );
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for ObjectTemplate class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   ObjectTemplate( ObjectTemplate const &rhs );
+   /*! @brief Assignment operator for ObjectTemplate class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   ObjectTemplate &operator=( ObjectTemplate const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_OBJECT_TEMPLATE_HH: Do NOT put anything after this line!
@@ -81,6 +81,19 @@ class Packing
    /*! @brief Unpack the received data. */
    virtual void unpack() = 0;
 
+   /*! @brief Pack the data for the attributes that are due to be sent. The
+    *  mask is available to pack() through is_attribute_in_mask(), so a packing
+    *  object can skip the encoding of the attributes not being sent.
+    *  @param mask Mask of the attributes due to be sent, which can include
+    *  attributes a Conditional later decides not to send. */
+   virtual void pack_masked( PackingAttributeMask const mask );
+
+   /*! @brief Unpack the data for the attributes that were just received. The
+    *  mask is available to unpack() through is_attribute_in_mask(), so a
+    *  packing object can skip the decoding of the attributes not received.
+    *  @param mask Mask of the attributes that were just received. */
+   virtual void unpack_masked( PackingAttributeMask const mask );
+
    //-----------------------------------------------------------------
    // Helper functions.
    //-----------------------------------------------------------------
@@ -101,6 +114,17 @@ class Packing
     *  @return Pointer to the associated TrickHLA managed Object. */
    virtual TrickHLA::Object *get_object() { return object; }
 
+   /*! @brief Create a new packing object of the same type as this prototype
+    * for an object instantiated from a TrickHLA::ObjectTemplate. The new
+    * instance must be allocated with the Trick Memory Manager using the given
+    * variable name so the template attribute trick_names can be resolved.
+    *  @return New packing instance, or NULL if not supported (default).
+    *  @param instance_name Trick variable name for the new instance. */
+   virtual Packing *create_template_instance( char const *instance_name )
+   {
+      return NULL;
+   }
+
    /*! @brief Get the Attribute by FOM name.
     *  @return Attribute for the given name.
     *  @param attr_FOM_name Attribute FOM name. */
@@ -111,6 +135,24 @@ class Packing
     *  @param attr_FOM_name Attribute FOM name. */
    Attribute *get_attribute_and_validate( char const *attr_FOM_name );
 
+   /*! @brief Get the bit for the Attribute in a packing attribute mask.
+    *  @return The bit for the attribute, or zero if not an attribute of the object.
+    *  @param attr Attribute of the object associated with this Packing object. */
+   PackingAttributeMask const get_attribute_mask_bit( Attribute const *attr ) const;
+
+   /*! @brief Determine if the Attribute is in the mask of the attributes
+    *  being packed or unpacked, which is all the attributes when pack() or
+    *  unpack() is not called through pack_masked() or unpack_masked(). An
+    *  unknown attribute is always considered to be in the mask so its data is
+    *  never skipped.
+    *  @return True if the attribute is being packed or unpacked.
+    *  @param attr Attribute of the object associated with this Packing object. */
+   bool const is_attribute_in_mask( Attribute const *attr ) const
+   {
+      PackingAttributeMask const attr_bit = get_attribute_mask_bit( attr );
+      return ( ( attr_bit == 0 ) || ( ( attr_mask & attr_bit ) != 0 ) );
+   }
+
    /*! @brief Get the current scenario time.
     *  @return Returns the current scenario time. */
    double get_scenario_time();
@@ -123,6 +165,8 @@ class Packing
    bool    initialized; ///< @trick_units{--} Initialization status flag.
    Object *object;      ///< @trick_io{**} Object associated with this class.
 
+   PackingAttributeMask attr_mask; ///< @trick_io{**} Mask of the attributes being packed or unpacked.
+
    /*! @brief Uses Trick memory allocation routines to allocate a new string
     *  that is input file compliant. */
    char *allocate_input_string( char const *c_string );
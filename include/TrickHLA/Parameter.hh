@@ -60,6 +60,11 @@ NASA, Johnson Space Center\n
 namespace TrickHLA
 {
 
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class MemoryUsage;
+
 class Parameter
 {
    // Let the Trick input processor access protected and private data.
@@ -101,6 +106,11 @@ class Parameter
                     int const   interaction_index,
                     int const   parameter_index );
 
+   /*! @brief Set the usage the parameter buffer is accounted to, moving any
+    * buffer already allocated over to it.
+    *  @param owner Memory usage of the parent interaction. */
+   void set_memory_owner( MemoryUsage *owner );
+
    /*! @brief Initializes the TrickHLA Parameter from the supplied address and
     * ATTRIBUTES of the trick variable.
     *  @param interaction_fom_name FOM name of the interaction.
@@ -215,10 +225,31 @@ class Parameter
       this->value_changed = false;
    }
 
+   /*! @brief Pack the parameter into the buffer using the appropriate encoding. */
+   void pack_parameter_buffer();
+
    /*! @brief Unpack the parameter from the buffer into the trick-variable
     * using the appropriate decoding. */
    void unpack_parameter_buffer();
 
+   /*! @brief Get the buffer holding the encoded parameter value, which is
+    * valid after pack_parameter_buffer() is called.
+    *  @return The encoded parameter value bytes. */
+   unsigned char const *get_encoded_buffer() const
+   {
+      return buffer;
+   }
+
+   /*! @brief Get the size of the encoded parameter value in the buffer.
+    *  @return The size in bytes of the encoded parameter value. */
+   size_t get_encoded_size() const
+   {
+      // The size is the number of 1-byte bool values in c++ and we need to
+      // map to a 4-byte HLAboolean type. The buffer already holds the
+      // encoded HLAboolean type.
+      return ( ( rti_encoding == ENCODING_BOOLEAN ) ? ( 4 * size ) : size );
+   }
+
    /*! @brief Prints the contents of buffer used to encode/decode the parameter
     * to the console on standard out. */
    void print_buffer() const;
@@ -240,6 +271,7 @@ class Parameter
   private:
    unsigned char *buffer;          ///< @trick_units{--} Byte buffer for the attribute value bytes.
    size_t         buffer_capacity; ///< @trick_units{--} The capacity of the buffer.
+   MemoryUsage   *memory_owner;    ///< @trick_io{**} Memory usage of the parent interaction the buffer is accounted to.
 
    bool size_is_static; ///< @trick_units{--} Flag to indicate the size of this attribute is static.
 
@@ -262,9 +294,6 @@ class Parameter
     *  @param capacity Desired capacity of the buffer in bytes. */
    void ensure_buffer_capacity( size_t capacity );
 
-   /*! @brief Pack the parameter into the buffer using the appropriate encoding. */
-   void pack_parameter_buffer();
-
    /*! @brief Gets the parameter size in bytes.
     *  @return The size in bytes of the parameter. */
    size_t get_parameter_size();
@@ -20,7 +20,10 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../../source/TrickHLA/ReflectedAttributesQueue.cpp}
+@trick_link_dependency{../../source/TrickHLA/Federate.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/SleepTimeout.cpp}
+@trick_link_dependency{../../source/TrickHLA/MemoryAccounting.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 
 @revs_title
@@ -51,6 +54,12 @@ NASA, Johnson Space Center\n
 namespace TrickHLA
 {
 
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Federate;
+class MemoryUsage;
+
 class ReflectedAttributesQueue
 {
    // Let the Trick input processor access protected and private data.
@@ -73,6 +82,8 @@ class ReflectedAttributesQueue
 
    HLAAttributeMapQueue attribute_map_queue; ///< @trick_io{**} Queue of AttributeHandleValueMap from attribute reflections.
 
+   HLATimeQueue attribute_time_queue; ///< @trick_io{**} Queue of the timestamps of the queued attribute reflections.
+
   public:
    //
    // Public constructors and destructor.
@@ -87,9 +98,40 @@ class ReflectedAttributesQueue
     *  @return True if queue is empty, False otherwise. */
    bool empty();
 
-   /*! @brief Push the attributes onto the queue.
-    *  @param theAttributes The reflected attributes. */
-   void push( RTI1516_NAMESPACE::AttributeHandleValueMap const &theAttributes );
+   /*! @brief Configure the conflation of queued reflections.
+    *  @param mode      Reflection conflation mode.
+    *  @param max_depth Maximum number of queued reflections, where zero is
+    *  unbounded. Once the queue is this deep the overflow policy applies,
+    *  which by default merges new reflections into the newest queued one. */
+   void configure_conflation( ReflectionConflationEnum const mode,
+                              int const                      max_depth );
+
+   /*! @brief Configure the policy applied when the queue is at its maximum depth.
+    *  @param policy        Queue overflow policy.
+    *  @param block_timeout Maximum wall clock time in seconds to block for
+    *  the QUEUE_OVERFLOW_BLOCK policy before dropping the oldest reflection. */
+   void configure_overflow( QueueOverflowPolicyEnum const policy,
+                            double const                  block_timeout );
+
+   /*! @brief For the QUEUE_OVERFLOW_BLOCK policy, wait until the queue is
+    * below its maximum depth. This must be called without holding a lock the
+    * consumer of the queue needs. The wait ends without room while the
+    * federate has a time advance request pending, and push() then drops the
+    * oldest reflection instead.
+    *  @return True if there is room, false if the wait ended without room.
+    *  @param federate Federate whose time advance grant must not be held up. */
+   bool const wait_for_room( Federate *federate );
+
+   /*! @brief Push the attributes onto the queue, or merge them into the
+    * newest queued reflection if conflation applies, applying the overflow
+    * policy if the queue is at its maximum depth.
+    *  @param theAttributes The reflected attributes.
+    *  @param time          HLA base time of a Timestamp Order reflection, or
+    *  RECEIVE_ORDER_TIME for a Receive Order reflection.
+    *  @return True if the queue just reached its maximum depth, which is only
+    *  reported again after the queue drains. */
+   bool const push( RTI1516_NAMESPACE::AttributeHandleValueMap const &theAttributes,
+                    int64_t const                                     time = RECEIVE_ORDER_TIME );
 
    /*! @brief Pop the front value off the queue and the destructor for the
     * value will be called. */
@@ -102,7 +144,95 @@ class ReflectedAttributesQueue
    /*! @brief Clear the queue of all values. */
    void clear();
 
+   /*! @brief Get the number of queued reflections.
+    *  @return Number of queued reflections. */
+   size_t size();
+
+   /*! @brief Get the number of reflections merged into a queued reflection.
+    *  @return Number of conflated reflections. */
+   unsigned long long get_conflated_count() const
+   {
+      return conflated_count;
+   }
+
+   /*! @brief Get the number of queued attribute values replaced by a newer
+    * value from a conflated reflection.
+    *  @return Number of replaced attribute values. */
+   unsigned long long get_conflated_attribute_count() const
+   {
+      return conflated_attribute_count;
+   }
+
+   /*! @brief Get the number of reflections dropped by the overflow policy.
+    *  @return Number of dropped reflections. */
+   unsigned long long get_dropped_count() const
+   {
+      return dropped_count;
+   }
+
+   /*! @brief Get the number of times the RTI callback blocked for room.
+    *  @return Number of blocked reflections. */
+   unsigned long long get_blocked_count() const
+   {
+      return blocked_count;
+   }
+
+   /*! @brief Get the deepest the queue has been.
+    *  @return Peak number of queued reflections. */
+   size_t get_peak_depth() const
+   {
+      return peak_depth;
+   }
+
+   /*! @brief Get the maximum queue depth.
+    *  @return Maximum number of queued reflections, zero for unbounded. */
+   int get_max_depth() const
+   {
+      return max_depth;
+   }
+
+   /*! @brief Set the usage the queued reflections are accounted to.
+    *  @param owner Memory usage of the object the queue belongs to. */
+   void set_memory_owner( MemoryUsage *owner );
+
+   /*! @brief Get the approximate memory used by the queued reflections.
+    *  @return Bytes of the queued attribute values and map entries. */
+   int64_t get_queued_bytes() const
+   {
+      return queued_bytes;
+   }
+
+   static int64_t const RECEIVE_ORDER_TIME = LLONG_MIN; ///< @trick_io{**} Time used to queue a Receive Order reflection.
+
+  protected:
+   ReflectionConflationEnum conflation_mode; ///< @trick_units{--} Reflection conflation mode.
+   int                      max_depth;       ///< @trick_units{count} Maximum number of queued reflections, zero for unbounded.
+
+   QueueOverflowPolicyEnum overflow_policy; ///< @trick_units{--} Policy applied when the queue is at its maximum depth.
+   double                  block_timeout;   ///< @trick_units{s} Maximum wall clock time to block for room.
+
+   unsigned long long conflated_count;           ///< @trick_units{count} Number of reflections merged into a queued reflection.
+   unsigned long long conflated_attribute_count; ///< @trick_units{count} Number of queued attribute values replaced by a newer value.
+   unsigned long long dropped_count;             ///< @trick_units{count} Number of reflections dropped by the overflow policy.
+   unsigned long long blocked_count;             ///< @trick_units{count} Number of times the RTI callback blocked for room.
+   size_t             peak_depth;                ///< @trick_units{count} Deepest the queue has been.
+   bool               overflowed;                ///< @trick_units{--} True once the queue reached its maximum depth, until it drains.
+
+   MemoryUsage *memory_owner; ///< @trick_io{**} Memory usage of the object the queued reflections are accounted to.
+   int64_t      queued_bytes; ///< @trick_units{count} Approximate bytes of the queued reflections.
+
   private:
+   /*! @brief Determine if a reflection with the given time can be merged into
+    * the newest queued reflection. Must be called with the queue_mutex locked.
+    *  @param time HLA base time of the reflection.
+    *  @return True if the reflection can be conflated. */
+   bool is_conflation_allowed( int64_t const time );
+
+   /*! @brief Account for a change in the bytes of the queued reflections.
+    * Must be called with the queue_mutex locked.
+    *  @param delta_bytes Change in the queued bytes. */
+   void account_bytes( int64_t const delta_bytes );
+
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for ReflectedAttributesQueue class.
     *  @details This constructor is private to prevent inadvertent copies. */
@@ -0,0 +1,216 @@
+/*!
+@file TrickHLA/SenderThread.hh
+@ingroup TrickHLA
+@brief This class provides a dedicated thread that issues the RTI attribute
+value updates queued by the Trick main thread, in the order they were queued.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/Int64Time.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/SenderThread.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_SENDER_THREAD_HH
+#define TRICKHLA_SENDER_THREAD_HH
+
+// System include files.
+#include <deque>
+#include <pthread.h>
+
+// TrickHLA include files.
+#include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/StandardsSupport.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+namespace TrickHLA
+{
+
+/*!
+@class SenderThreadItem
+@brief An attribute value update queued for the sender thread. The item owns
+its attribute values so they can not change after being queued.
+*/
+class SenderThreadItem
+{
+  public:
+   /*! @brief Default constructor for the TrickHLA SenderThreadItem class. */
+   SenderThreadItem()
+      : obj_name( NULL ),
+        rti_amb( NULL ),
+        instance_handle(),
+        attribute_values(),
+        timestamp_order( false ),
+        update_time()
+   {
+      return;
+   }
+
+   char const                                *obj_name;         ///< @trick_io{**} Name of the object the update is for.
+   RTI1516_NAMESPACE::RTIambassador          *rti_amb;          ///< @trick_io{**} RTI ambassador to send the update with.
+   RTI1516_NAMESPACE::ObjectInstanceHandle    instance_handle;  ///< @trick_io{**} Object instance handle.
+   RTI1516_NAMESPACE::AttributeHandleValueMap attribute_values; ///< @trick_io{**} Attribute values to send.
+   bool                                       timestamp_order;  ///< @trick_io{**} True to send as Timestamp Order.
+   Int64Time                                  update_time;      ///< @trick_io{**} Timestamp of a Timestamp Order update.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for SenderThreadItem class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SenderThreadItem( SenderThreadItem const &rhs );
+   /*! @brief Assignment operator for SenderThreadItem class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SenderThreadItem &operator=( SenderThreadItem const &rhs );
+};
+
+class SenderThread
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__SenderThread();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA SenderThread class. */
+   SenderThread();
+   /*! @brief Destructor for the TrickHLA SenderThread class, which sends
+    *  any queued updates and stops the thread. */
+   virtual ~SenderThread();
+
+   /*! @brief Start the sender thread.
+    *  @param queue_limit Maximum number of queued updates before enqueue()
+    *  blocks the caller. */
+   void start( unsigned int const queue_limit );
+
+   /*! @brief Send any queued updates and stop the sender thread. */
+   void stop();
+
+   /*! @brief Determine if the sender thread is running.
+    *  @return True if the sender thread is running. */
+   bool const is_running() const
+   {
+      return running;
+   }
+
+   /*! @brief Queue an attribute value update for the sender thread, blocking
+    *  while the queue is at its limit.
+    *  @param obj_name         Name of the object the update is for.
+    *  @param rti_amb          RTI ambassador to send the update with.
+    *  @param instance_handle  Object instance handle.
+    *  @param attribute_values Attribute values to send, which are taken by
+    *  the queued update leaving the map empty.
+    *  @param timestamp_order  True to send as Timestamp Order.
+    *  @param update_time      Timestamp of a Timestamp Order update. */
+   void enqueue( char const                                    *obj_name,
+                 RTI1516_NAMESPACE::RTIambassador              *rti_amb,
+                 RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_handle,
+                 RTI1516_NAMESPACE::AttributeHandleValueMap    &attribute_values,
+                 bool const                                     timestamp_order,
+                 Int64Time const                               &update_time );
+
+   /*! @brief Block until all the queued updates have been sent, which must
+    *  be done before a time advance request to preserve the Timestamp Order
+    *  semantics and before any synchronous send to preserve the send order. */
+   void flush();
+
+   /*! @brief Get the number of times enqueue() blocked on a full queue.
+    *  @return Number of times the caller was blocked by back-pressure. */
+   unsigned long long get_blocked_count() const
+   {
+      return blocked_count;
+   }
+
+   /*! @brief Get the maximum number of updates that were queued.
+    *  @return Maximum queue depth. */
+   unsigned int get_max_queue_depth() const
+   {
+      return max_queue_depth;
+   }
+
+   /*! @brief Get the number of updates the sender thread sent.
+    *  @return Number of updates sent. */
+   unsigned long long get_sent_count() const
+   {
+      return sent_count;
+   }
+
+  private:
+   /*! @brief The pthread start routine.
+    *  @return Always NULL.
+    *  @param arg Pointer to the SenderThread instance. */
+   static void *thread_main( void *arg );
+
+   /*! @brief Send the queued updates until the thread is stopped. */
+   void run();
+
+   /*! @brief Make the RTI call for the queued update.
+    *  @param item The queued update. */
+   void send( SenderThreadItem &item );
+
+   pthread_t thread;   ///< @trick_io{**} The sender thread.
+   bool      running;  ///< @trick_io{**} True if the sender thread is running.
+   bool      stopping; ///< @trick_io{**} True if the sender thread was asked to stop.
+   bool      sending;  ///< @trick_io{**} True while the sender thread makes an RTI call.
+
+   unsigned int queue_limit; ///< @trick_io{**} Maximum number of queued updates.
+
+   std::deque< SenderThreadItem * > queue; ///< @trick_io{**} Updates waiting to be sent, in order.
+
+   MutexLock      mutex;        ///< @trick_io{**} Mutex to lock the queue and state.
+   pthread_cond_t work_cond;    ///< @trick_io{**} Signals the sender thread an update was queued or to stop.
+   pthread_cond_t drained_cond; ///< @trick_io{**} Signals waiting callers an update was sent.
+
+   unsigned long long blocked_count;   ///< @trick_io{**} Number of times enqueue() blocked on a full queue.
+   unsigned int       max_queue_depth; ///< @trick_io{**} Maximum number of updates that were queued.
+   unsigned long long sent_count;      ///< @trick_io{**} Number of updates sent.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for SenderThread class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SenderThread( SenderThread const &rhs );
+   /*! @brief Assignment operator for SenderThread class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SenderThread &operator=( SenderThread const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_SENDER_THREAD_HH: Do NOT put anything after this line!
@@ -0,0 +1,195 @@
+/*!
+@file TrickHLA/SharedMemoryChannel.hh
+@ingroup TrickHLA
+@brief This class provides a double-buffered shared-memory side channel for
+exchanging large attribute values between federates on the same host.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/SharedMemoryChannel.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_SHARED_MEMORY_CHANNEL_HH
+#define TRICKHLA_SHARED_MEMORY_CHANNEL_HH
+
+// System include files.
+#include <cstdint>
+#include <stdlib.h>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/Types.hh"
+
+#define THLA_SHARED_MEMORY_SEGMENT_NAME_SIZE 64
+
+namespace TrickHLA
+{
+
+/*!
+@struct SharedMemoryDescriptor
+@brief The small descriptor sent through the RTI in the descriptor attribute
+that refers to an attribute value written into the shared-memory side channel.
+*/
+typedef struct {
+   uint32_t magic;    ///< @trick_units{--}    Identifies the value as a shared-memory descriptor.
+   uint32_t version;  ///< @trick_units{--}    Version of the descriptor and segment layout.
+   uint64_t host_id;  ///< @trick_units{--}    Identifier of the host the publisher runs on.
+   uint64_t offset;   ///< @trick_units{count} Offset in bytes of the value in the segment.
+   uint64_t sequence; ///< @trick_units{count} Sequence number of the value.
+   uint64_t size;     ///< @trick_units{count} Size of the value in bytes.
+
+   char segment[THLA_SHARED_MEMORY_SEGMENT_NAME_SIZE]; ///< @trick_units{--} Name of the shared-memory segment.
+} SharedMemoryDescriptor;
+
+class SharedMemoryChannel
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__SharedMemoryChannel();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA SharedMemoryChannel class. */
+   SharedMemoryChannel();
+   /*! @brief Destructor for the TrickHLA SharedMemoryChannel class, which
+    *  unmaps the segment and removes it if this channel created it. */
+   virtual ~SharedMemoryChannel();
+
+   /*! @brief Determine if the data is a shared-memory descriptor.
+    *  @return True if the data is a shared-memory descriptor.
+    *  @param data      The attribute value data.
+    *  @param data_size The size of the attribute value data in bytes. */
+   static bool const is_descriptor( void const  *data,
+                                    size_t const data_size );
+
+   /*! @brief Get the identifier of this host, which is a hash of the host name.
+    *  @return The identifier of this host. */
+   static uint64_t const get_host_id();
+
+   /*! @brief Set the name of the segment this channel creates.
+    *  @param name The POSIX shared-memory object name, which starts with a '/'. */
+   void set_segment_name( std::string const &name )
+   {
+      this->segment_name = name;
+   }
+
+   /*! @brief Get the name of the segment of this channel.
+    *  @return The POSIX shared-memory object name. */
+   std::string const &get_segment_name() const
+   {
+      return segment_name;
+   }
+
+   /*! @brief Determine if the segment is created or mapped.
+    *  @return True if the segment is created or mapped. */
+   bool const is_open() const
+   {
+      return ( segment != NULL );
+   }
+
+   /*! @brief Create the segment with two buffers of the given capacity.
+    *  @return True if the segment was created, false otherwise.
+    *  @param buffer_capacity The capacity of each of the two buffers in bytes. */
+   bool const create( size_t const buffer_capacity );
+
+   /*! @brief Write the value into the buffer the readers are not using and
+    *  update the descriptor to refer to it.
+    *  @return True if written, false if the value exceeds the buffer capacity.
+    *  @param data      The attribute value to write.
+    *  @param data_size The size of the attribute value in bytes. */
+   bool const write( void const  *data,
+                     size_t const data_size );
+
+   /*! @brief Get the descriptor of the last value written.
+    *  @return The descriptor of the last value written. */
+   SharedMemoryDescriptor const *get_descriptor() const
+   {
+      return &descriptor;
+   }
+
+   /*! @brief Read the value the descriptor refers to, mapping the segment of
+    *  the publisher as needed.
+    *  @return The result of reading the value.
+    *  @param data      The received attribute value holding the descriptor.
+    *  @param data_size The size of the received attribute value in bytes. */
+   SharedMemoryReadEnum const read( void const  *data,
+                                    size_t const data_size );
+
+   /*! @brief Get the value from the last successful read.
+    *  @return Pointer to the bytes of the value. */
+   unsigned char *get_read_data() const
+   {
+      return read_buffer;
+   }
+
+   /*! @brief Get the size of the value from the last successful read.
+    *  @return The size of the value in bytes. */
+   size_t get_read_size() const
+   {
+      return read_size;
+   }
+
+   /*! @brief Unmap the segment, removing it if this channel created it. */
+   void close();
+
+  private:
+   /*! @brief Map the named segment of a publisher for reading.
+    *  @return True if the segment was mapped, false otherwise.
+    *  @param name The POSIX shared-memory object name. */
+   bool const open( char const *name );
+
+   std::string segment_name; ///< @trick_io{**} Name of the shared-memory segment.
+
+   unsigned char *segment;      ///< @trick_io{**} Address the segment is mapped at.
+   size_t         segment_size; ///< @trick_io{**} Size of the mapped segment in bytes.
+   bool           owner;        ///< @trick_io{**} True if this channel created the segment.
+
+   uint64_t sequence; ///< @trick_io{**} Sequence number of the last value written.
+
+   SharedMemoryDescriptor descriptor; ///< @trick_io{**} Descriptor of the last value written.
+
+   unsigned char *read_buffer;   ///< @trick_io{**} Copy of the last value read.
+   size_t         read_capacity; ///< @trick_io{**} Capacity of the read buffer.
+   size_t         read_size;     ///< @trick_io{**} Size of the last value read.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for SharedMemoryChannel class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SharedMemoryChannel( SharedMemoryChannel const &rhs );
+   /*! @brief Assignment operator for SharedMemoryChannel class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SharedMemoryChannel &operator=( SharedMemoryChannel const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_SHARED_MEMORY_CHANNEL_HH: Do NOT put anything after this line!
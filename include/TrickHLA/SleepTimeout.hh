@@ -86,8 +86,8 @@ class SleepTimeout
     *  @return Integer value of 0 for success, otherwise non-zero for an error. */
    int const sleep() const;
 
-   /*! @brief Gets the wall clock time.
-    *  @return The wall clock time in microseconds. */
+   /*! @brief Gets the monotonic clock time.
+    *  @return The monotonic clock time in microseconds. */
    int64_t const time() const;
 
    /*! @brief Determine if we cumulatively slept for the configured timeout time.
@@ -95,7 +95,7 @@ class SleepTimeout
    bool const timeout() const;
 
    /*! @brief Determine if we cumulatively slept for the configured timeout time.
-    *  @param time_in_micros Wall clock time in microseconds.
+    *  @param time_in_micros Monotonic clock time in microseconds.
     *  @return True if timeout exceeded, false otherwise. */
    bool const timeout( int64_t const time_in_micros ) const;
 
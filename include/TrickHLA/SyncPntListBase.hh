@@ -23,6 +23,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/SyncPntListBase.cpp}
 @trick_link_dependency{../../source/TrickHLA/Federate.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/SleepTimeout.cpp}
 @trick_link_dependency{../../source/TrickHLA/SyncPnt.cpp}
 
 @revs_title
@@ -37,6 +38,8 @@ NASA, Johnson Space Center\n
 #define TRICKHLA_SYNC_PNT_LIST_BASE_HH
 
 // System includes.
+#include <map>
+#include <pthread.h>
 #include <string>
 
 // Trick include files.
@@ -45,6 +48,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Federate.hh"
 #include "TrickHLA/LoggableSyncPnt.hh"
 #include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/SleepTimeout.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/SyncPnt.hh"
 
@@ -60,6 +64,8 @@ NASA, Johnson Space Center\n
 namespace TrickHLA
 {
 
+typedef std::map< std::wstring, SyncPnt * > SyncPntLabelMap;
+
 class SyncPntListBase
 {
    // Let the Trick input processor access protected and private data.
@@ -248,6 +254,32 @@ class SyncPntListBase
    virtual void print_sync_points();
 
   protected:
+   /*! @brief Add the synchronization point to the list and the label lookup
+    * map, where the first synchronization point added for a label is the one
+    * found by a lookup. Must be called with the mutex locked.
+    *  @param sync_pnt The SyncPnt instance. */
+   virtual void insert_sync_point( SyncPnt *sync_pnt );
+
+   /*! @brief Remove the synchronization point from the label lookup map. The
+    * caller is responsible for removing it from the list and deleting it.
+    * Must be called with the mutex locked.
+    *  @param sync_pnt The SyncPnt instance. */
+   virtual void erase_sync_point_label( SyncPnt const *sync_pnt );
+
+   /*! @brief Set the state of the synchronization point and wake up any
+    * threads waiting on a synchronization point state change. Must be called
+    * with the mutex locked.
+    *  @param sync_pnt The SyncPnt instance.
+    *  @param state    The new synchronization point state. */
+   virtual void set_sync_point_state( SyncPnt              *sync_pnt,
+                                      SyncPtStateEnum const state );
+
+   /*! @brief Wait for a synchronization point state change or until the
+    * wait time expires. Must be called with the mutex locked exactly once,
+    * which is released while waiting.
+    *  @param wait_micros Maximum wait time in microseconds. */
+   void wait_for_sync_point_state_change( long const wait_micros = THLA_DEFAULT_SLEEP_WAIT_IN_MICROS );
+
    // Principal synchronization point functions.
    /*! @brief Register the synchronization point with the RTI.
     *  @param RTI_amb HLA RTI Ambassador.
@@ -287,6 +319,10 @@ class SyncPntListBase
 
    std::vector< SyncPnt * > sync_point_list; ///< @trick_io{**} Vector of synchronization points.
 
+   SyncPntLabelMap sync_point_map; ///< @trick_io{**} Map of synchronization points, key is the label.
+
+   pthread_cond_t state_change_cond; ///< @trick_io{**} Condition signaled when a synchronization point changes state.
+
    std::wstring reconfig_name; ///< @trick_io{**} Wide string of the reconfiguration name.
 
   private:
@@ -92,6 +92,17 @@ class TrickThreadCoordinator
    /*! @brief Verify the threads IDs associated to objects in the input file. */
    void verify_trick_thread_associations();
 
+   /*! @brief Enable the Trick child threads to pack and send the data for the
+    * objects they own instead of the Trick main thread.
+    *  @param enable True to send the object data on the owning child threads. */
+   void enable_child_thread_send( bool const enable );
+
+   /*! @brief Get the ID of the Trick thread that packs and sends the data for
+    * the object, which is zero for the Trick main thread.
+    *  @return The Trick thread ID.
+    *  @param obj_index Object index. */
+   unsigned int get_send_thread_id_for_obj( unsigned int const obj_index ) const;
+
    /*! @brief Announce to all the child threads the main thread has data available. */
    void announce_data_available();
 
@@ -128,6 +139,12 @@ class TrickThreadCoordinator
    /*! @brief Wait to send data for Trick child thread. */
    void wait_to_send_data_for_child_thread( unsigned int const thread_id );
 
+   /*! @brief Trick child thread packs and sends the data for the objects it owns. */
+   void send_data_for_child_thread( unsigned int const thread_id );
+
+   /*! @brief Assign the Trick child thread that sends the data for each object. */
+   void assign_send_threads();
+
   protected:
    Federate *federate; ///< @trick_units{--} Associated TrickHLA::Federate.
    Manager  *manager;  ///< @trick_units{--} Associated TrickHLA::Manager.
@@ -146,6 +163,9 @@ class TrickThreadCoordinator
    long long *data_cycle_base_time_per_obj;    ///< @trick_units{--} Data cycle times per object instance in the base HLA Logical Time representation.
 
    long long main_thread_data_cycle_base_time; ///< @trick_units{--} Trick main thread data cycle time in the base HLA Logical Time representation.
+
+   bool          child_thread_send;      ///< @trick_units{--} True if the Trick child threads pack and send the data for the objects they own (default: false).
+   unsigned int *send_thread_id_per_obj; ///< @trick_units{--} ID of the Trick thread that sends the data per object instance, zero for the main thread.
 };
 
 } // namespace TrickHLA
@@ -37,6 +37,7 @@ NASA, Johnson Space Center\n
 #include <limits.h>
 #include <map>
 #include <queue>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -151,6 +152,88 @@ typedef enum {
 
 } LagCompensationEnum;
 
+/*!
+@enum ReflectionConflationEnum
+@brief Define the TrickHLA conflation mode for queued attribute reflections.
+*/
+typedef enum {
+
+   REFLECTION_CONFLATION_FIRST_VALUE  = 0, ///< Set to the First value in the enumeration.
+   REFLECTION_CONFLATION_NONE         = 0, ///< No conflation, every reflection is queued.
+   REFLECTION_CONFLATION_LATEST_VALUE = 1, ///< Merge queued reflections per attribute, latest value wins.
+   REFLECTION_CONFLATION_SAME_TIME    = 2, ///< Merge queued reflections per attribute only if they have the same timestamp.
+   REFLECTION_CONFLATION_LAST_VALUE   = 2  ///< Set to the Last value in the enumeration.
+
+} ReflectionConflationEnum;
+
+/*!
+@enum QueueOverflowPolicyEnum
+@brief Define the TrickHLA policy applied when a received interaction or
+reflection queue reaches its maximum depth.
+*/
+typedef enum {
+
+   QUEUE_OVERFLOW_FIRST_VALUE = 0, ///< Set to the First value in the enumeration.
+   QUEUE_OVERFLOW_CONFLATE    = 0, ///< Merge into a queued item, the newest reflection or the queued interaction of the same class.
+   QUEUE_OVERFLOW_DROP_OLDEST = 1, ///< Drop the oldest queued item to make room.
+   QUEUE_OVERFLOW_DROP_NEWEST = 2, ///< Drop the newly received item.
+   QUEUE_OVERFLOW_BLOCK       = 3, ///< Block the RTI callback until there is room, but drop the oldest queued item instead while a time advance grant is pending or once the block timeout expires.
+   QUEUE_OVERFLOW_LAST_VALUE  = 3  ///< Set to the Last value in the enumeration.
+
+} QueueOverflowPolicyEnum;
+
+/*!
+@enum SendPriorityEnum
+@brief Define the TrickHLA send priority of an attribute, which determines
+how soon the cyclic send rate of the attribute is degraded when the HLA data
+send and receive time exceeds the budget.
+*/
+typedef enum {
+
+   SEND_PRIORITY_FIRST_VALUE = 0, ///< Set to the First value in the enumeration.
+   SEND_PRIORITY_CRITICAL    = 0, ///< Critical data, the send rate is never degraded.
+   SEND_PRIORITY_HIGH        = 1, ///< High priority, the send rate is degraded last.
+   SEND_PRIORITY_NORMAL      = 2, ///< Normal priority.
+   SEND_PRIORITY_LOW         = 3, ///< Low priority, the send rate is degraded first.
+   SEND_PRIORITY_OBJECT      = 4, ///< Use the send priority of the object the attribute belongs to.
+   SEND_PRIORITY_LAST_VALUE  = 4  ///< Set to the Last value in the enumeration.
+
+} SendPriorityEnum;
+
+/*!
+@enum SharedMemoryReadEnum
+@brief Define the TrickHLA result of reading an attribute value from the
+shared-memory side channel of a co-located federate.
+*/
+typedef enum {
+
+   SHARED_MEMORY_READ_FIRST_VALUE = 0, ///< Set to the First value in the enumeration.
+   SHARED_MEMORY_READ_OK          = 0, ///< The attribute value was read.
+   SHARED_MEMORY_READ_REMOTE      = 1, ///< The publisher is on another host or its segment can not be mapped.
+   SHARED_MEMORY_READ_STALE       = 2, ///< The value was overwritten by a newer one before it could be read.
+   SHARED_MEMORY_READ_LAST_VALUE  = 2  ///< Set to the Last value in the enumeration.
+
+} SharedMemoryReadEnum;
+
+/*!
+@enum MemorySubsystemEnum
+@brief Define the TrickHLA subsystems whose memory is accounted for by the
+TrickHLA::MemoryAccounting report.
+*/
+typedef enum {
+
+   MEMORY_SUBSYSTEM_FIRST_VALUE = 0, ///< Set to the First value in the enumeration.
+   MEMORY_ATTRIBUTE_BUFFERS     = 0, ///< Encoded attribute value buffers.
+   MEMORY_PARAMETER_BUFFERS     = 1, ///< Encoded interaction parameter value buffers.
+   MEMORY_INTERACTION_ITEMS     = 2, ///< Received interactions waiting to be processed.
+   MEMORY_REFLECTION_QUEUES     = 3, ///< Queued attribute reflections.
+   MEMORY_OPAQUE_BUFFERS        = 4, ///< OpaqueBuffer encoders, such as the SpaceFOM encoders.
+   MEMORY_MOM_TABLES            = 5, ///< Management Object Model (MOM) federate tables, sampled.
+   MEMORY_SUBSYSTEM_LAST_VALUE  = 5, ///< Set to the Last value in the enumeration.
+   MEMORY_SUBSYSTEM_COUNT       = 6  ///< Number of accounted subsystems.
+
+} MemorySubsystemEnum;
+
 /*!
 @enum DebugLevelEnum
 @brief Define the TrickHLA level for debug messages.
@@ -314,15 +397,33 @@ typedef std::auto_ptr< RTI1516_NAMESPACE::RTIambassador > TrickRTIAmbPtr;
 #pragma GCC diagnostic                                    pop
 
 typedef std::queue< RTI1516_NAMESPACE::AttributeHandleValueMap > HLAAttributeMapQueue;
+typedef std::queue< int64_t >                                    HLATimeQueue;
 
 typedef std::map< RTI1516_NAMESPACE::ObjectInstanceHandle, std::wstring > TrickHLAObjInstanceNameMap;
 
 typedef std::map< std::string, unsigned int > TrickHLAObjInstanceNameIndexMap;
 
+typedef std::set< unsigned int > ObjectIndexSet;
+
+typedef std::map< std::wstring, unsigned int > ObjectWstringNameIndexMap;
+
+typedef std::map< RTI1516_NAMESPACE::ObjectClassHandle, ObjectWstringNameIndexMap > ObjectClassNameIndexMap;
+
+typedef std::map< RTI1516_NAMESPACE::ObjectClassHandle, ObjectIndexSet > ObjectClassIndexSetMap;
+
+typedef std::multimap< int64_t, unsigned int > ObjectIndexScheduleMap;
+
 typedef std::vector< std::string > VectorOfStrings;
 
 typedef std::vector< std::wstring > VectorOfWstrings;
 
+// Bit mask of the attributes of an object passed to the Packing pack() and
+// unpack() functions, where bit i is the attribute at index i of the object.
+// Bit 63 is shared by all the attributes at index 63 and higher.
+typedef uint64_t PackingAttributeMask;
+
+#define THLA_PACKING_ALL_ATTRIBUTES ( ~( (TrickHLA::PackingAttributeMask)0 ) )
+
 //
 // Helper methods for these enumerations.
 //
@@ -19,6 +19,7 @@ NASA, Johnson Space Center\n
 @python_module{TrickHLA}
 
 @tldh
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../../source/TrickHLA/Utilities.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 
@@ -45,6 +46,7 @@ NASA, Johnson Space Center\n
 
 // TrickHLA include files.
 #include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/Types.hh"
 
 // Certain Pitch RTI calls can cause the floating-point control word register
@@ -249,6 +251,9 @@ class Utilities
     *  @return Byteswap value. */
    static std::string get_release_date();
 
+  public:
+   static MutexLock trick_mm_mutex; ///< @trick_io{**} Serializes the Trick memory-manager calls made by the threads that initialize the attributes and parameters in parallel.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for Utilities class.
@@ -148,6 +148,10 @@ else
    # Determine the gcc compiler version.
    COMPILER_VERSION = $(shell $(CPPC_CMD) -dumpversion | cut -d . -f 1)
 
+   # The TrickHLA shared-memory side channel uses shm_open(), which is in the
+   # librt library for glibc versions before 2.34.
+   TRICK_USER_LINK_LIBS += -lrt
+
    # The gcc version 11 compiler defaults to C++17 which removed the
    # dynamic exception specification. Instead fallback to C++14 because
    # the IEEE 1516-2010 APIs use dynamic exception specifications.
@@ -99,6 +99,13 @@ class SinePacking : public SineData, public TrickHLA::Packing
     *  @param obj Object associated with this packing class. */
    virtual void initialize_callback( TrickHLA::Object *obj );
 
+   // From the TrickHLA::Packing class.
+   /*! @brief Create a new packing and simulation data instance for an object
+    * instantiated from a TrickHLA::ObjectTemplate.
+    *  @return New packing instance.
+    *  @param instance_name Trick variable name for the new instance. */
+   virtual TrickHLA::Packing *create_template_instance( char const *instance_name );
+
    // From the TrickHLA::Packing class.
    /*! @brief Called to pack the data before the data is sent to the RTI. */
    virtual void pack();
@@ -146,6 +146,42 @@ void SinePacking::initialize_callback(
    tol_attr   = get_attribute_and_validate( "Tolerance" );
 }
 
+/*!
+ * @details From the TrickHLA::Packing class. The packing instance and its
+ * simulation data are allocated as named Trick variables so that the object
+ * template attribute trick_names, which are relative to the packing instance,
+ * can be resolved.
+ *
+ * @job_class{scheduled}
+ */
+TrickHLA::Packing *SinePacking::create_template_instance(
+   char const *instance_name )
+{
+   string decl_str = string( "TrickHLAModel::SinePacking " ) + instance_name;
+
+   SinePacking *inst = static_cast< SinePacking * >( trick_MM->declare_var( decl_str.c_str() ) );
+   if ( inst == NULL ) {
+      send_hs( stderr, "TrickHLAModel::SinePacking::create_template_instance():%d ERROR allocating Trick Memory for '%s'%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      return NULL;
+   }
+
+   decl_str = string( "TrickHLAModel::SineData " ) + instance_name + "_sim_data";
+
+   SineData *inst_sim_data = static_cast< SineData * >( trick_MM->declare_var( decl_str.c_str() ) );
+   if ( inst_sim_data == NULL ) {
+      send_hs( stderr, "TrickHLAModel::SinePacking::create_template_instance():%d ERROR allocating Trick Memory for '%s_sim_data'%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      return NULL;
+   }
+
+   inst->configure( inst_sim_data );
+   inst->phase_deg = this->phase_deg;
+   inst->initialize();
+
+   return inst;
+}
+
 void SinePacking::pack()
 {
    if ( !initialized ) {
@@ -161,20 +197,38 @@ void SinePacking::pack()
    // in the unpack() function, since we don't run the risk of corrupting our
    // state.
 
-   // Copy over the sim-data over to the packing data as a starting point.
-   this->set_name( sim_data->get_name() );
-   this->set_time( sim_data->get_time() );
-   this->set_value( sim_data->get_value() );
-   this->set_derivative( sim_data->get_derivative() );
-   this->set_phase( sim_data->get_phase() );
-   this->set_frequency( sim_data->get_frequency() );
-   this->set_amplitude( sim_data->get_amplitude() );
-   this->set_tolerance( sim_data->get_tolerance() );
-
-   // For this example to show how to use the Packing API's, we will assume
-   // that the phase shared between federates is in degrees so covert it from
-   // radians to degrees.
-   phase_deg = sim_data->get_phase() * 180.0 / M_PI;
+   // Copy over the sim-data over to the packing data as a starting point,
+   // but only for the attributes that are due to be sent this time.
+   if ( is_attribute_in_mask( name_attr ) ) {
+      this->set_name( sim_data->get_name() );
+   }
+   if ( is_attribute_in_mask( time_attr ) ) {
+      this->set_time( sim_data->get_time() );
+   }
+   if ( is_attribute_in_mask( value_attr ) ) {
+      this->set_value( sim_data->get_value() );
+   }
+   if ( is_attribute_in_mask( dvdt_attr ) ) {
+      this->set_derivative( sim_data->get_derivative() );
+   }
+   if ( is_attribute_in_mask( freq_attr ) ) {
+      this->set_frequency( sim_data->get_frequency() );
+   }
+   if ( is_attribute_in_mask( amp_attr ) ) {
+      this->set_amplitude( sim_data->get_amplitude() );
+   }
+   if ( is_attribute_in_mask( tol_attr ) ) {
+      this->set_tolerance( sim_data->get_tolerance() );
+   }
+
+   if ( is_attribute_in_mask( phase_attr ) ) {
+      this->set_phase( sim_data->get_phase() );
+
+      // For this example to show how to use the Packing API's, we will assume
+      // that the phase shared between federates is in degrees so covert it
+      // from radians to degrees.
+      phase_deg = sim_data->get_phase() * 180.0 / M_PI;
+   }
 
    // Use the inherited debug-handler to allow debug comments to be turned
    // on and off from a setting in the input file.
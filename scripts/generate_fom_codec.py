@@ -0,0 +1,1048 @@
+#!/usr/bin/env python3
+# @file generate_fom_codec.py
+# @brief This program generates C++ data types and HLA encoders from FOM XML.
+#
+# This is a Python program used to generate a C++ header file with the data
+# types and the HLA encode/decode functions for the datatypes defined in one
+# or more FOM modules. The generated functions follow the IEEE 1516.2-2010
+# encoding rules (octet boundary padding, fixed and variable arrays, fixed
+# records, enumerations and big or little endian basic types). For the data
+# types with a fixed size the field offsets are computed by this program, so
+# the generated code uses constant offsets and does no memory allocation.
+#
+# The generated functions for a FOM datatype named 'Name' are:
+#   size_t encoded_size_Name( value, pos ) - End position of the encoded value.
+#   void   encode_Name( buffer, pos, value ) - Encode the value at pos.
+#   bool   decode_Name( buffer, size, pos, value ) - Decode the value at pos.
+# and for the fixed size datatypes also:
+#   Name_ENCODED_SIZE - The constexpr encoded size in bytes.
+#   Name_field_OFFSET - The constexpr offset of each fixed record field.
+#   void put_Name( p, value ) - Encode the value at the aligned pointer p.
+#   void get_Name( p, value ) - Decode the value at the aligned pointer p.
+#
+# @revs_title
+# @revs_begin
+# @rev_entry{ TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial creation.}
+# @revs_end
+#
+import sys
+import os
+import re
+import argparse
+import textwrap
+import xml.etree.ElementTree as ET
+
+from trickhla_message import *
+
+# Namespace of the basic type helper functions in the generated code.
+_BASICS_NS = 'TrickHLA::FOMCodec::'
+
+
+class BasicType():
+   def __init__( self, name, cpp_type, size, put_fn, get_fn ):
+      self.name = name
+      self.cpp_type = cpp_type
+      self.size = size
+      self.put_fn = _BASICS_NS + put_fn
+      self.get_fn = _BASICS_NS + get_fn
+      self.builtin = True
+      self.semantics = None
+
+
+class SimpleType():
+   def __init__( self, name, rep, builtin = False, semantics = None ):
+      self.name = name
+      self.rep = rep
+      self.builtin = builtin
+      self.semantics = semantics
+
+
+class EnumType():
+   def __init__( self, name, rep, enumerators, builtin = False, semantics = None ):
+      self.name = name
+      self.rep = rep
+      self.enumerators = enumerators
+      self.builtin = builtin
+      self.semantics = semantics
+
+
+class ArrayType():
+   def __init__( self, name, element, cardinality, cpp_type = None, builtin = False, semantics = None ):
+      self.name = name
+      self.element = element
+      self.cardinality = cardinality  # None for a variable array.
+      self.cpp_type = cpp_type
+      self.builtin = builtin
+      self.semantics = semantics
+
+
+class RecordType():
+   def __init__( self, name, fields, semantics = None ):
+      self.name = name
+      self.fields = fields  # List of (field name, datatype name) tuples.
+      self.builtin = False
+      self.semantics = semantics
+
+
+# Main routine.
+def main():
+
+   #
+   # Setup command line argument parsing.
+   #
+   parser = argparse.ArgumentParser( prog = 'generate_fom_codec', \
+                                     formatter_class = argparse.RawDescriptionHelpFormatter, \
+                                     description = 'Generate C++ data types and HLA encode/decode functions from FOM XML datatypes.', \
+                                     epilog = textwrap.dedent( '''\n
+Examples:\n  generate_fom_codec -f FOMs/SpaceFOM/SISO_SpaceFOM_datatypes.xml -o SpaceFOMCodec.hh -n SpaceFOMCodec
+  generate_fom_codec -f FOMs/SpaceFOM/SISO_SpaceFOM_datatypes.xml -f FOMs/SpaceFOM/SISO_SpaceFOM_management.xml -t ExecutionMode -o ExecModeCodec.hh''' ) )
+
+   parser.add_argument( '-f', '--fom', action = 'append', required = True, dest = 'foms', \
+                        help = 'FOM module XML file to read datatypes from, can be repeated.' )
+   parser.add_argument( '-o', '--output', required = True, \
+                        help = 'Generated C++ header file.' )
+   parser.add_argument( '-n', '--namespace', default = 'FOMCodec', \
+                        help = 'C++ namespace of the generated code (default FOMCodec).' )
+   parser.add_argument( '-t', '--type', action = 'append', dest = 'types', \
+                        help = 'Only generate this datatype and the datatypes it uses, can be repeated (default all).' )
+   parser.add_argument( '-v', '--verbose', action = 'store_true', \
+                        help = 'Generate verbose output.' )
+
+   # Parse the command line arguments.
+   args = parser.parse_args()
+
+   # Start with the HLA predefined datatypes.
+   registry = predefined_types()
+   fom_type_names = []
+
+   # Read the datatypes from each of the FOM modules.
+   for fom in args.foms:
+      if not os.path.isfile( fom ):
+         TrickHLAMessage.failure( 'FOM file not found: ' + fom )
+      if args.verbose:
+         TrickHLAMessage.status( 'Reading FOM datatypes from: ' + fom )
+      for fom_type in read_fom_types( fom ):
+         if fom_type.name in registry and registry[fom_type.name].builtin:
+            # FOM modules can repeat the HLA predefined datatypes.
+            continue
+         registry[fom_type.name] = fom_type
+         if fom_type.name not in fom_type_names:
+            fom_type_names.append( fom_type.name )
+
+   # Determine the datatypes to generate.
+   if args.types:
+      for type_name in args.types:
+         if type_name not in registry:
+            TrickHLAMessage.failure( 'Datatype \'' + type_name + '\' not found in the FOM modules!' )
+      roots = args.types
+   else:
+      roots = fom_type_names
+
+   ordered = []
+   for type_name in roots:
+      order_types( registry, type_name, ordered, [] )
+
+   if args.verbose:
+      TrickHLAMessage.status( 'Generating ' + str( len( ordered ) ) + ' datatypes into: ' + args.output )
+
+   # Write the generated header file.
+   header = generate_header( registry, ordered, args.namespace,
+                             header_file_name( args.output ), args.foms )
+   with open( args.output, 'w' ) as out_file:
+      out_file.write( header )
+
+   TrickHLAMessage.success( 'Generated ' + args.output )
+
+   return
+
+
+def predefined_types():
+   registry = {}
+
+   def add( fom_type ):
+      registry[fom_type.name] = fom_type
+
+   # IEEE 1516.2-2010 basic data representations.
+   add( BasicType( 'HLAoctet', 'unsigned char', 1, 'put_octet', 'get_octet' ) )
+   add( BasicType( 'HLAoctetPairBE', 'uint16_t', 2, 'put_uint16_be', 'get_uint16_be' ) )
+   add( BasicType( 'HLAoctetPairLE', 'uint16_t', 2, 'put_uint16_le', 'get_uint16_le' ) )
+   add( BasicType( 'HLAinteger16BE', 'int16_t', 2, 'put_int16_be', 'get_int16_be' ) )
+   add( BasicType( 'HLAinteger16LE', 'int16_t', 2, 'put_int16_le', 'get_int16_le' ) )
+   add( BasicType( 'HLAinteger32BE', 'int32_t', 4, 'put_int32_be', 'get_int32_be' ) )
+   add( BasicType( 'HLAinteger32LE', 'int32_t', 4, 'put_int32_le', 'get_int32_le' ) )
+   add( BasicType( 'HLAinteger64BE', 'int64_t', 8, 'put_int64_be', 'get_int64_be' ) )
+   add( BasicType( 'HLAinteger64LE', 'int64_t', 8, 'put_int64_le', 'get_int64_le' ) )
+   add( BasicType( 'HLAfloat32BE', 'float', 4, 'put_float32_be', 'get_float32_be' ) )
+   add( BasicType( 'HLAfloat32LE', 'float', 4, 'put_float32_le', 'get_float32_le' ) )
+   add( BasicType( 'HLAfloat64BE', 'double', 8, 'put_float64_be', 'get_float64_be' ) )
+   add( BasicType( 'HLAfloat64LE', 'double', 8, 'put_float64_le', 'get_float64_le' ) )
+
+   # IEEE 1516.2-2010 predefined simple, enumerated and array datatypes.
+   add( SimpleType( 'HLAASCIIchar', 'HLAoctet', builtin = True ) )
+   add( SimpleType( 'HLAunicodeChar', 'HLAoctetPairBE', builtin = True ) )
+   add( SimpleType( 'HLAbyte', 'HLAoctet', builtin = True ) )
+   add( EnumType( 'HLAboolean', 'HLAinteger32BE', [( 'HLAfalse', 0 ), ( 'HLAtrue', 1 )], builtin = True ) )
+   add( ArrayType( 'HLAASCIIstring', 'HLAASCIIchar', None, 'std::string', builtin = True ) )
+   add( ArrayType( 'HLAunicodeString', 'HLAunicodeChar', None, 'std::wstring', builtin = True ) )
+   add( ArrayType( 'HLAopaqueData', 'HLAbyte', None, 'std::vector< unsigned char >', builtin = True ) )
+
+   return registry
+
+
+def local_name( element ):
+   # Strip the XML namespace from the element tag.
+   return element.tag.split( '}' )[-1]
+
+
+def child_text( element, name ):
+   for child in element:
+      if local_name( child ) == name:
+         return ( child.text or '' ).strip()
+   return None
+
+
+def children( element, name ):
+   return [child for child in element if local_name( child ) == name]
+
+
+def read_fom_types( fom ):
+   try:
+      root = ET.parse( fom ).getroot()
+   except ET.ParseError as err:
+      TrickHLAMessage.failure( 'Could not parse FOM file ' + fom + ': ' + str( err ) )
+
+   fom_types = []
+   for data_types in root.iter():
+      if local_name( data_types ) != 'dataTypes':
+         continue
+
+      for group in data_types:
+         group_name = local_name( group )
+
+         if group_name == 'basicDataRepresentations':
+            for basic in children( group, 'basicData' ):
+               fom_types.append( read_basic_type( fom, basic ) )
+
+         elif group_name == 'simpleDataTypes':
+            for simple in children( group, 'simpleData' ):
+               fom_types.append( SimpleType( child_text( simple, 'name' ),
+                                             child_text( simple, 'representation' ),
+                                             semantics = child_text( simple, 'semantics' ) ) )
+
+         elif group_name == 'enumeratedDataTypes':
+            for enum in children( group, 'enumeratedData' ):
+               enumerators = []
+               for enumerator in children( enum, 'enumerator' ):
+                  enumerators.append( ( child_text( enumerator, 'name' ),
+                                        int( child_text( enumerator, 'value' ), 0 ) ) )
+               fom_types.append( EnumType( child_text( enum, 'name' ),
+                                           child_text( enum, 'representation' ),
+                                           enumerators,
+                                           semantics = child_text( enum, 'semantics' ) ) )
+
+         elif group_name == 'arrayDataTypes':
+            for array in children( group, 'arrayData' ):
+               fom_types.append( read_array_type( fom, array ) )
+
+         elif group_name == 'fixedRecordDataTypes':
+            for record in children( group, 'fixedRecordData' ):
+               fields = []
+               for field in children( record, 'field' ):
+                  fields.append( ( child_text( field, 'name' ), child_text( field, 'dataType' ) ) )
+               if not fields:
+                  TrickHLAMessage.failure( 'Fixed record \'' + child_text( record, 'name' )
+                                           + '\' in ' + fom + ' has no fields!' )
+               fom_types.append( RecordType( child_text( record, 'name' ), fields,
+                                             semantics = child_text( record, 'semantics' ) ) )
+
+         elif group_name == 'variantRecordDataTypes':
+            for variant in children( group, 'variantRecordData' ):
+               TrickHLAMessage.warning( 'Variant record \'' + child_text( variant, 'name' )
+                                        + '\' in ' + fom + ' is not supported, skipping it.' )
+
+   return fom_types
+
+
+def read_basic_type( fom, basic ):
+   name = child_text( basic, 'name' )
+   size = int( child_text( basic, 'size' ) or '0' )
+   endian = ( child_text( basic, 'endian' ) or 'Big' ).lower()
+   interpretation = ( child_text( basic, 'interpretation' ) or '' ).lower()
+   suffix = 'le' if endian.startswith( 'little' ) else 'be'
+
+   if size not in ( 8, 16, 32, 64 ):
+      TrickHLAMessage.failure( 'Basic datatype \'' + name + '\' in ' + fom
+                               + ' has an unsupported size of ' + str( size ) + ' bits!' )
+   if size == 8:
+      return BasicType( name, 'unsigned char', 1, 'put_octet', 'get_octet' )
+   if 'float' in interpretation and size in ( 32, 64 ):
+      cpp_type = 'float' if size == 32 else 'double'
+      return BasicType( name, cpp_type, size // 8,
+                        'put_float' + str( size ) + '_' + suffix,
+                        'get_float' + str( size ) + '_' + suffix )
+   if 'unsigned' in interpretation:
+      return BasicType( name, 'uint' + str( size ) + '_t', size // 8,
+                        'put_uint' + str( size ) + '_' + suffix,
+                        'get_uint' + str( size ) + '_' + suffix )
+   return BasicType( name, 'int' + str( size ) + '_t', size // 8,
+                     'put_int' + str( size ) + '_' + suffix,
+                     'get_int' + str( size ) + '_' + suffix )
+
+
+def read_array_type( fom, array ):
+   name = child_text( array, 'name' )
+   encoding = child_text( array, 'encoding' ) or 'HLAvariableArray'
+   cardinality = child_text( array, 'cardinality' ) or 'Dynamic'
+
+   if encoding == 'HLAfixedArray':
+      count = 1
+      try:
+         # Multi-dimensional fixed arrays are encoded as one flat array.
+         for dimension in cardinality.split( ',' ):
+            count *= int( dimension.strip() )
+      except ValueError:
+         TrickHLAMessage.failure( 'Fixed array \'' + name + '\' in ' + fom
+                                  + ' has an invalid cardinality \'' + cardinality + '\'!' )
+      return ArrayType( name, child_text( array, 'dataType' ), count,
+                        semantics = child_text( array, 'semantics' ) )
+
+   if encoding != 'HLAvariableArray':
+      TrickHLAMessage.failure( 'Array \'' + name + '\' in ' + fom
+                               + ' has an unsupported encoding \'' + encoding + '\'!' )
+   return ArrayType( name, child_text( array, 'dataType' ), None,
+                     semantics = child_text( array, 'semantics' ) )
+
+
+def lookup( registry, type_name ):
+   if type_name not in registry:
+      TrickHLAMessage.failure( 'Unknown datatype \'' + str( type_name ) + '\'!' )
+   return registry[type_name]
+
+
+def dependencies( fom_type ):
+   if isinstance( fom_type, ( SimpleType, EnumType ) ):
+      return [fom_type.rep]
+   if isinstance( fom_type, ArrayType ):
+      return [fom_type.element]
+   if isinstance( fom_type, RecordType ):
+      return [field_type for ( field_name, field_type ) in fom_type.fields]
+   return []
+
+
+def order_types( registry, type_name, ordered, visiting ):
+   # Depth first so a datatype is always generated after the ones it uses.
+   if type_name in ordered:
+      return
+   if type_name in visiting:
+      TrickHLAMessage.failure( 'Datatype \'' + type_name + '\' is recursive, which is not supported!' )
+   visiting.append( type_name )
+   for dependency in dependencies( lookup( registry, type_name ) ):
+      order_types( registry, dependency, ordered, visiting )
+   visiting.remove( type_name )
+   ordered.append( type_name )
+
+
+def cpp_identifier( name ):
+   identifier = re.sub( r'[^A-Za-z0-9_]', '_', name )
+   if identifier[0].isdigit():
+      identifier = '_' + identifier
+   return identifier
+
+
+def basic_of( registry, fom_type ):
+   while not isinstance( fom_type, BasicType ):
+      fom_type = lookup( registry, fom_type.rep )
+   return fom_type
+
+
+def cpp_type( registry, fom_type ):
+   if isinstance( fom_type, BasicType ):
+      return fom_type.cpp_type
+   if isinstance( fom_type, SimpleType ):
+      if fom_type.builtin:
+         if fom_type.name == 'HLAASCIIchar':
+            return 'char'
+         return cpp_type( registry, lookup( registry, fom_type.rep ) )
+      return cpp_identifier( fom_type.name )
+   if isinstance( fom_type, EnumType ):
+      return 'bool' if fom_type.builtin else cpp_identifier( fom_type.name )
+   if isinstance( fom_type, ArrayType ) and fom_type.cpp_type is not None:
+      return fom_type.cpp_type
+   return cpp_identifier( fom_type.name )
+
+
+def is_scalar( fom_type ):
+   return isinstance( fom_type, ( BasicType, SimpleType, EnumType ) )
+
+
+def round_up( offset, boundary ):
+   return ( ( offset + boundary - 1 ) // boundary ) * boundary
+
+
+def octet_boundary( registry, fom_type ):
+   if is_scalar( fom_type ):
+      return basic_of( registry, fom_type ).size
+   if isinstance( fom_type, ArrayType ):
+      element_boundary = octet_boundary( registry, lookup( registry, fom_type.element ) )
+      if fom_type.cardinality is None:
+         # The element count is an HLAinteger32BE.
+         return max( 4, element_boundary )
+      return element_boundary
+   return max( [octet_boundary( registry, lookup( registry, field_type ) )
+                for ( field_name, field_type ) in fom_type.fields] )
+
+
+def fixed_size( registry, fom_type ):
+   # Encoded size of a datatype that starts on its octet boundary, or None
+   # if the size depends on the value.
+   if is_scalar( fom_type ):
+      return basic_of( registry, fom_type ).size
+   if isinstance( fom_type, ArrayType ):
+      if fom_type.cardinality is None:
+         return None
+      element = lookup( registry, fom_type.element )
+      element_size = fixed_size( registry, element )
+      if element_size is None:
+         return None
+      stride = round_up( element_size, octet_boundary( registry, element ) )
+      return ( ( fom_type.cardinality - 1 ) * stride ) + element_size
+   offset = 0
+   for ( field_name, field_type ) in fom_type.fields:
+      field = lookup( registry, field_type )
+      field_size = fixed_size( registry, field )
+      if field_size is None:
+         return None
+      offset = round_up( offset, octet_boundary( registry, field ) ) + field_size
+   return offset
+
+
+def minimum_size( registry, fom_type ):
+   size = fixed_size( registry, fom_type )
+   if size is not None:
+      return size
+   if isinstance( fom_type, ArrayType ):
+      if fom_type.cardinality is None:
+         return 4
+      return fom_type.cardinality * minimum_size( registry, lookup( registry, fom_type.element ) )
+   return sum( [minimum_size( registry, lookup( registry, field_type ) )
+                for ( field_name, field_type ) in fom_type.fields] )
+
+
+def offset_ptr( ptr, offset ):
+   return ptr if offset == 0 else ptr + ' + ' + str( offset )
+
+
+def put_stmt( registry, fom_type, ptr, expr ):
+   # Statement to encode a fixed size value at an aligned pointer.
+   if isinstance( fom_type, BasicType ):
+      return fom_type.put_fn + '( ' + ptr + ', ' + expr + ' );'
+   if isinstance( fom_type, SimpleType ):
+      return put_stmt( registry, lookup( registry, fom_type.rep ), ptr, expr )
+   if isinstance( fom_type, EnumType ):
+      basic = basic_of( registry, fom_type )
+      if fom_type.builtin:
+         value = '( ' + expr + ' ? 1 : 0 )'
+      else:
+         value = 'static_cast< ' + basic.cpp_type + ' >( ' + expr + ' )'
+      return basic.put_fn + '( ' + ptr + ', ' + value + ' );'
+   return 'put_' + cpp_identifier( fom_type.name ) + '( ' + ptr + ', ' + expr + ' );'
+
+
+def get_stmt( registry, fom_type, ptr, expr ):
+   # Statement to decode a fixed size value at an aligned pointer.
+   if isinstance( fom_type, BasicType ):
+      return expr + ' = ' + fom_type.get_fn + '( ' + ptr + ' );'
+   if isinstance( fom_type, SimpleType ):
+      return get_stmt( registry, lookup( registry, fom_type.rep ), ptr, expr )
+   if isinstance( fom_type, EnumType ):
+      basic = basic_of( registry, fom_type )
+      if fom_type.builtin:
+         return expr + ' = ( ' + basic.get_fn + '( ' + ptr + ' ) != 0 );'
+      return expr + ' = static_cast< ' + cpp_type( registry, fom_type ) + ' >( ' \
+         + basic.get_fn + '( ' + ptr + ' ) );'
+   return 'get_' + cpp_identifier( fom_type.name ) + '( ' + ptr + ', ' + expr + ' );'
+
+
+def size_stmts( registry, fom_type, expr ):
+   # Statements advancing 'pos' past an encoded value.
+   size = fixed_size( registry, fom_type )
+   if size is not None:
+      return ['pos = ' + _BASICS_NS + 'pad_to( pos, ' + str( octet_boundary( registry, fom_type ) )
+              + ' ) + ' + str( size ) + ';']
+   return ['pos = encoded_size_' + cpp_identifier( fom_type.name ) + '( ' + expr + ', pos );']
+
+
+def encode_stmts( registry, fom_type, expr ):
+   # Statements encoding a value at 'pos' and advancing 'pos' past it.
+   size = fixed_size( registry, fom_type )
+   if size is not None:
+      return [_BASICS_NS + 'zero_pad( buffer, pos, ' + str( octet_boundary( registry, fom_type ) ) + ' );',
+              put_stmt( registry, fom_type, 'buffer + pos', expr ),
+              'pos += ' + str( size ) + ';']
+   return ['encode_' + cpp_identifier( fom_type.name ) + '( buffer, pos, ' + expr + ' );']
+
+
+def decode_stmts( registry, fom_type, expr ):
+   # Statements decoding a value at 'pos' and advancing 'pos' past it.
+   size = fixed_size( registry, fom_type )
+   if size is not None:
+      return ['pos = ' + _BASICS_NS + 'pad_to( pos, ' + str( octet_boundary( registry, fom_type ) ) + ' );',
+              'if ( ( pos + ' + str( size ) + ' ) > size ) {',
+              '   return false;',
+              '}',
+              get_stmt( registry, fom_type, 'buffer + pos', expr ),
+              'pos += ' + str( size ) + ';']
+   return ['if ( !decode_' + cpp_identifier( fom_type.name ) + '( buffer, size, pos, ' + expr + ' ) ) {',
+           '   return false;',
+           '}']
+
+
+def indent( lines, level ):
+   return [( '   ' * level ) + line if line else line for line in lines]
+
+
+def brief( fom_type, kind ):
+   text = 'FOM ' + kind + ' datatype \'' + fom_type.name + '\'.'
+   if fom_type.semantics:
+      # Only use the first sentence of the FOM semantics.
+      sentence = ' '.join( fom_type.semantics.split() ).split( '. ' )[0].rstrip( '.' )
+      text += ' ' + sentence + '.'
+   return text
+
+
+def generate_declaration( registry, fom_type ):
+   name = cpp_identifier( fom_type.name )
+   lines = []
+
+   if isinstance( fom_type, SimpleType ):
+      lines.append( '/*! @brief ' + brief( fom_type, 'simple' ) + ' */' )
+      lines.append( 'typedef ' + cpp_type( registry, lookup( registry, fom_type.rep ) ) + ' ' + name + ';' )
+
+   elif isinstance( fom_type, EnumType ):
+      lines.append( '/*! @brief ' + brief( fom_type, 'enumerated' ) + ' */' )
+      lines.append( 'typedef enum {' )
+      for index, ( enum_name, enum_value ) in enumerate( fom_type.enumerators ):
+         comma = ',' if index < len( fom_type.enumerators ) - 1 else ''
+         lines.append( '   ' + cpp_identifier( enum_name ) + ' = ' + str( enum_value ) + comma )
+      lines.append( '} ' + name + ';' )
+
+   elif isinstance( fom_type, ArrayType ):
+      element = lookup( registry, fom_type.element )
+      if fom_type.cardinality is None:
+         if isinstance( element, ArrayType ) and element.cardinality is not None:
+            TrickHLAMessage.failure( 'Variable array \'' + fom_type.name
+                                     + '\' of fixed arrays is not supported!' )
+         lines.append( '/*! @brief ' + brief( fom_type, 'variable array' ) + ' */' )
+         lines.append( 'typedef std::vector< ' + cpp_type( registry, element ) + ' > ' + name + ';' )
+      else:
+         lines.append( '/*! @brief ' + brief( fom_type, 'fixed array' ) + ' */' )
+         lines.append( 'typedef ' + cpp_type( registry, element ) + ' ' + name
+                       + '[' + str( fom_type.cardinality ) + '];' )
+
+   elif isinstance( fom_type, RecordType ):
+      lines.append( '/*! @brief ' + brief( fom_type, 'fixed record' ) + ' */' )
+      lines.append( 'typedef struct {' )
+      for ( field_name, field_type ) in fom_type.fields:
+         lines.append( '   ' + cpp_type( registry, lookup( registry, field_type ) ) + ' '
+                       + cpp_identifier( field_name ) + '; ///< @trick_units{--} ' + field_name )
+      lines.append( '} ' + name + ';' )
+
+   return lines
+
+
+def generate_fixed_functions( registry, fom_type ):
+   name = cpp_identifier( fom_type.name )
+   value_type = cpp_type( registry, fom_type )
+   size = fixed_size( registry, fom_type )
+   boundary = octet_boundary( registry, fom_type )
+   put_body = []
+   get_body = []
+   offset_lines = []
+
+   if is_scalar( fom_type ):
+      scalar = fom_type if isinstance( fom_type, EnumType ) else lookup( registry, fom_type.rep )
+      if isinstance( fom_type, EnumType ):
+         put_body.append( put_stmt( registry, fom_type, 'p', 'value' ) )
+         get_body.append( get_stmt( registry, fom_type, 'p', 'value' ) )
+      else:
+         put_body.append( put_stmt( registry, scalar, 'p', 'value' ) )
+         get_body.append( get_stmt( registry, scalar, 'p', 'value' ) )
+
+   elif isinstance( fom_type, ArrayType ):
+      element = lookup( registry, fom_type.element )
+      element_size = fixed_size( registry, element )
+      stride = round_up( element_size, octet_boundary( registry, element ) )
+      ptr = 'p + ( i * ' + str( stride ) + ' )'
+      put_body.append( 'for ( size_t i = 0; i < ' + str( fom_type.cardinality ) + '; ++i ) {' )
+      put_body.append( '   ' + put_stmt( registry, element, ptr, 'value[i]' ) )
+      if stride > element_size:
+         put_body.append( '   if ( ( i + 1 ) < ' + str( fom_type.cardinality ) + ' ) {' )
+         put_body.append( '      memset( ' + ptr + ' + ' + str( element_size ) + ', 0, '
+                          + str( stride - element_size ) + ' );' )
+         put_body.append( '   }' )
+      put_body.append( '}' )
+      get_body.append( 'for ( size_t i = 0; i < ' + str( fom_type.cardinality ) + '; ++i ) {' )
+      get_body.append( '   ' + get_stmt( registry, element, ptr, 'value[i]' ) )
+      get_body.append( '}' )
+
+   else:
+      offset = 0
+      for ( field_name, field_type ) in fom_type.fields:
+         field = lookup( registry, field_type )
+         aligned = round_up( offset, octet_boundary( registry, field ) )
+         field_offset = name + '_' + cpp_identifier( field_name ) + '_OFFSET'
+         offset_lines.append( 'constexpr size_t ' + field_offset + ' = ' + str( aligned )
+                              + '; ///< Offset of the ' + field_name + ' field in bytes.' )
+         if aligned > offset:
+            put_body.append( 'memset( ' + offset_ptr( 'p', offset ) + ', 0, ' + str( aligned - offset ) + ' );' )
+         put_body.append( put_stmt( registry, field, 'p + ' + field_offset,
+                                    'value.' + cpp_identifier( field_name ) ) )
+         get_body.append( get_stmt( registry, field, 'p + ' + field_offset,
+                                    'value.' + cpp_identifier( field_name ) ) )
+         offset = aligned + fixed_size( registry, field )
+
+   lines = []
+   lines.append( 'constexpr size_t ' + name + '_ENCODED_SIZE   = ' + str( size ) + '; ///< Encoded size of ' + name + ' in bytes.' )
+   lines.append( 'constexpr size_t ' + name + '_OCTET_BOUNDARY = ' + str( boundary ) + '; ///< Octet boundary of ' + name + '.' )
+   lines.extend( offset_lines )
+   lines.append( '' )
+   lines.append( '/*! @brief Encode ' + name + ' at an aligned pointer, with room for ' + name + '_ENCODED_SIZE bytes. */' )
+   lines.append( 'inline void put_' + name + '( unsigned char *p, ' + value_type + ' const &value )' )
+   lines.append( '{' )
+   lines.extend( indent( put_body, 1 ) )
+   lines.append( '}' )
+   lines.append( '' )
+   lines.append( '/*! @brief Decode ' + name + ' at an aligned pointer, with ' + name + '_ENCODED_SIZE bytes available. */' )
+   lines.append( 'inline void get_' + name + '( unsigned char const *p, ' + value_type + ' &value )' )
+   lines.append( '{' )
+   lines.extend( indent( get_body, 1 ) )
+   lines.append( '}' )
+   lines.append( '' )
+   lines.append( '/*! @brief Get the buffer position after ' + name + ' is encoded at pos. */' )
+   lines.append( 'constexpr size_t encoded_size_' + name + '( ' + value_type + ' const &, size_t const pos = 0 )' )
+   lines.append( '{' )
+   lines.append( '   return ' + _BASICS_NS + 'pad_to( pos, ' + name + '_OCTET_BOUNDARY ) + ' + name + '_ENCODED_SIZE;' )
+   lines.append( '}' )
+   lines.append( '' )
+   lines.append( '/*! @brief Encode ' + name + ' at pos, which is advanced past the encoded value. */' )
+   lines.append( 'inline void encode_' + name + '( unsigned char *buffer, size_t &pos, ' + value_type + ' const &value )' )
+   lines.append( '{' )
+   lines.append( '   ' + _BASICS_NS + 'zero_pad( buffer, pos, ' + str( boundary ) + ' );' )
+   lines.append( '   put_' + name + '( buffer + pos, value );' )
+   lines.append( '   pos += ' + str( size ) + ';' )
+   lines.append( '}' )
+   lines.append( '' )
+   lines.append( '/*! @brief Decode ' + name + ' at pos, which is advanced past the decoded value.' )
+   lines.append( ' *  @return False if the buffer is too small. */' )
+   lines.append( 'inline bool decode_' + name + '( unsigned char const *buffer, size_t const size, size_t &pos, ' + value_type + ' &value )' )
+   lines.append( '{' )
+   lines.append( '   size_t const start = ' + _BASICS_NS + 'pad_to( pos, ' + str( boundary ) + ' );' )
+   lines.append( '   if ( ( start + ' + str( size ) + ' ) > size ) {' )
+   lines.append( '      return false;' )
+   lines.append( '   }' )
+   lines.append( '   get_' + name + '( buffer + start, value );' )
+   lines.append( '   pos = start + ' + str( size ) + ';' )
+   lines.append( '   return true;' )
+   lines.append( '}' )
+   return lines
+
+
+def generate_variable_functions( registry, fom_type ):
+   name = cpp_identifier( fom_type.name )
+   value_type = cpp_type( registry, fom_type )
+   boundary = octet_boundary( registry, fom_type )
+   pad_to = 'pos = ' + _BASICS_NS + 'pad_to( pos, ' + str( boundary ) + ' );'
+   zero_pad = _BASICS_NS + 'zero_pad( buffer, pos, ' + str( boundary ) + ' );'
+   size_body = [pad_to]
+   encode_body = [zero_pad]
+   decode_body = [pad_to]
+
+   if isinstance( fom_type, ArrayType ) and fom_type.cardinality is None:
+      element = lookup( registry, fom_type.element )
+      element_size = fixed_size( registry, element )
+      size_body = ['pos = ' + _BASICS_NS + 'pad_to( pos, ' + str( boundary ) + ' ) + 4;']
+      if element_size is not None:
+         # Closed form for the elements, which are all the same size.
+         stride = round_up( element_size, octet_boundary( registry, element ) )
+         size_body.append( 'if ( !value.empty() ) {' )
+         size_body.append( '   pos = ' + _BASICS_NS + 'pad_to( pos, ' + str( octet_boundary( registry, element ) )
+                           + ' ) + ( ( value.size() - 1 ) * ' + str( stride ) + ' ) + ' + str( element_size ) + ';' )
+         size_body.append( '}' )
+      else:
+         size_body.append( 'for ( size_t i = 0; i < value.size(); ++i ) {' )
+         size_body.extend( indent( size_stmts( registry, element, 'value[i]' ), 1 ) )
+         size_body.append( '}' )
+
+      encode_body.append( _BASICS_NS + 'put_int32_be( buffer + pos, static_cast< int32_t >( value.size() ) );' )
+      encode_body.append( 'pos += 4;' )
+      encode_body.append( 'for ( size_t i = 0; i < value.size(); ++i ) {' )
+      encode_body.extend( indent( encode_stmts( registry, element, 'value[i]' ), 1 ) )
+      encode_body.append( '}' )
+
+      decode_body.append( 'if ( ( pos + 4 ) > size ) {' )
+      decode_body.append( '   return false;' )
+      decode_body.append( '}' )
+      decode_body.append( 'int32_t const count = ' + _BASICS_NS + 'get_int32_be( buffer + pos );' )
+      decode_body.append( 'pos += 4;' )
+      decode_body.append( '// Reject a count the rest of the buffer can not hold before resizing.' )
+      decode_body.append( 'if ( ( count < 0 ) || ( static_cast< size_t >( count ) > ( ( size - pos ) / '
+                          + str( max( 1, minimum_size( registry, element ) ) ) + ' ) ) ) {' )
+      decode_body.append( '   return false;' )
+      decode_body.append( '}' )
+      decode_body.append( 'value.resize( static_cast< size_t >( count ) );' )
+      decode_body.append( 'for ( size_t i = 0; i < value.size(); ++i ) {' )
+      decode_body.extend( indent( decode_stmts( registry, element, 'value[i]' ), 1 ) )
+      decode_body.append( '}' )
+
+   elif isinstance( fom_type, ArrayType ):
+      element = lookup( registry, fom_type.element )
+      for ( body, stmts ) in ( ( size_body, size_stmts ), ( encode_body, encode_stmts ), ( decode_body, decode_stmts ) ):
+         body.append( 'for ( size_t i = 0; i < ' + str( fom_type.cardinality ) + '; ++i ) {' )
+         body.extend( indent( stmts( registry, element, 'value[i]' ), 1 ) )
+         body.append( '}' )
+
+   else:
+      for ( field_name, field_type ) in fom_type.fields:
+         field = lookup( registry, field_type )
+         expr = 'value.' + cpp_identifier( field_name )
+         size_body.extend( size_stmts( registry, field, expr ) )
+         encode_body.extend( encode_stmts( registry, field, expr ) )
+         decode_body.extend( decode_stmts( registry, field, expr ) )
+
+   lines = []
+   lines.append( 'constexpr size_t ' + name + '_OCTET_BOUNDARY = ' + str( boundary ) + '; ///< Octet boundary of ' + name + '.' )
+   lines.append( '' )
+   lines.append( '/*! @brief Get the buffer position after ' + name + ' is encoded at pos. */' )
+   lines.append( 'inline size_t encoded_size_' + name + '( ' + value_type + ' const &value, size_t pos = 0 )' )
+   lines.append( '{' )
+   lines.extend( indent( size_body, 1 ) )
+   lines.append( '   return pos;' )
+   lines.append( '}' )
+   lines.append( '' )
+   lines.append( '/*! @brief Encode ' + name + ' at pos, which is advanced past the encoded value.' )
+   lines.append( ' *  The buffer must hold encoded_size_' + name + '( value, pos ) bytes. */' )
+   lines.append( 'inline void encode_' + name + '( unsigned char *buffer, size_t &pos, ' + value_type + ' const &value )' )
+   lines.append( '{' )
+   lines.extend( indent( encode_body, 1 ) )
+   lines.append( '}' )
+   lines.append( '' )
+   lines.append( '/*! @brief Decode ' + name + ' at pos, which is advanced past the decoded value.' )
+   lines.append( ' *  @return False if the buffer is too small or the data is invalid. */' )
+   lines.append( 'inline bool decode_' + name + '( unsigned char const *buffer, size_t const size, size_t &pos, ' + value_type + ' &value )' )
+   lines.append( '{' )
+   lines.extend( indent( decode_body, 1 ) )
+   lines.append( '   return true;' )
+   lines.append( '}' )
+   return lines
+
+
+# The basic type helpers are shared by all the generated headers.
+_BASICS = '''#ifndef TRICKHLA_FOM_CODEC_BASICS
+#define TRICKHLA_FOM_CODEC_BASICS
+
+namespace TrickHLA
+{
+namespace FOMCodec
+{
+
+// The bytes are assembled with shifts so the byte order is fixed at compile
+// time and there is no run time byte swapping decision.
+
+constexpr size_t pad_to( size_t const pos, size_t const boundary )
+{
+   return ( ( pos + boundary - 1 ) / boundary ) * boundary;
+}
+
+inline void zero_pad( unsigned char *buffer, size_t &pos, size_t const boundary )
+{
+   size_t const end = pad_to( pos, boundary );
+   while ( pos < end ) {
+      buffer[pos++] = 0;
+   }
+}
+
+inline void put_octet( unsigned char *p, unsigned char const v )
+{
+   p[0] = v;
+}
+
+inline unsigned char get_octet( unsigned char const *p )
+{
+   return p[0];
+}
+
+inline void put_uint16_be( unsigned char *p, uint16_t const v )
+{
+   p[0] = (unsigned char)( v >> 8 );
+   p[1] = (unsigned char)v;
+}
+
+inline void put_uint16_le( unsigned char *p, uint16_t const v )
+{
+   p[0] = (unsigned char)v;
+   p[1] = (unsigned char)( v >> 8 );
+}
+
+inline uint16_t get_uint16_be( unsigned char const *p )
+{
+   return (uint16_t)( ( (uint16_t)p[0] << 8 ) | (uint16_t)p[1] );
+}
+
+inline uint16_t get_uint16_le( unsigned char const *p )
+{
+   return (uint16_t)( ( (uint16_t)p[1] << 8 ) | (uint16_t)p[0] );
+}
+
+inline void put_uint32_be( unsigned char *p, uint32_t const v )
+{
+   put_uint16_be( p, (uint16_t)( v >> 16 ) );
+   put_uint16_be( p + 2, (uint16_t)v );
+}
+
+inline void put_uint32_le( unsigned char *p, uint32_t const v )
+{
+   put_uint16_le( p, (uint16_t)v );
+   put_uint16_le( p + 2, (uint16_t)( v >> 16 ) );
+}
+
+inline uint32_t get_uint32_be( unsigned char const *p )
+{
+   return ( (uint32_t)get_uint16_be( p ) << 16 ) | (uint32_t)get_uint16_be( p + 2 );
+}
+
+inline uint32_t get_uint32_le( unsigned char const *p )
+{
+   return ( (uint32_t)get_uint16_le( p + 2 ) << 16 ) | (uint32_t)get_uint16_le( p );
+}
+
+inline void put_uint64_be( unsigned char *p, uint64_t const v )
+{
+   put_uint32_be( p, (uint32_t)( v >> 32 ) );
+   put_uint32_be( p + 4, (uint32_t)v );
+}
+
+inline void put_uint64_le( unsigned char *p, uint64_t const v )
+{
+   put_uint32_le( p, (uint32_t)v );
+   put_uint32_le( p + 4, (uint32_t)( v >> 32 ) );
+}
+
+inline uint64_t get_uint64_be( unsigned char const *p )
+{
+   return ( (uint64_t)get_uint32_be( p ) << 32 ) | (uint64_t)get_uint32_be( p + 4 );
+}
+
+inline uint64_t get_uint64_le( unsigned char const *p )
+{
+   return ( (uint64_t)get_uint32_le( p + 4 ) << 32 ) | (uint64_t)get_uint32_le( p );
+}
+
+inline void put_int16_be( unsigned char *p, int16_t const v )
+{
+   put_uint16_be( p, (uint16_t)v );
+}
+
+inline void put_int16_le( unsigned char *p, int16_t const v )
+{
+   put_uint16_le( p, (uint16_t)v );
+}
+
+inline int16_t get_int16_be( unsigned char const *p )
+{
+   return (int16_t)get_uint16_be( p );
+}
+
+inline int16_t get_int16_le( unsigned char const *p )
+{
+   return (int16_t)get_uint16_le( p );
+}
+
+inline void put_int32_be( unsigned char *p, int32_t const v )
+{
+   put_uint32_be( p, (uint32_t)v );
+}
+
+inline void put_int32_le( unsigned char *p, int32_t const v )
+{
+   put_uint32_le( p, (uint32_t)v );
+}
+
+inline int32_t get_int32_be( unsigned char const *p )
+{
+   return (int32_t)get_uint32_be( p );
+}
+
+inline int32_t get_int32_le( unsigned char const *p )
+{
+   return (int32_t)get_uint32_le( p );
+}
+
+inline void put_int64_be( unsigned char *p, int64_t const v )
+{
+   put_uint64_be( p, (uint64_t)v );
+}
+
+inline void put_int64_le( unsigned char *p, int64_t const v )
+{
+   put_uint64_le( p, (uint64_t)v );
+}
+
+inline int64_t get_int64_be( unsigned char const *p )
+{
+   return (int64_t)get_uint64_be( p );
+}
+
+inline int64_t get_int64_le( unsigned char const *p )
+{
+   return (int64_t)get_uint64_le( p );
+}
+
+inline void put_float32_be( unsigned char *p, float const v )
+{
+   uint32_t u;
+   memcpy( &u, &v, sizeof( u ) );
+   put_uint32_be( p, u );
+}
+
+inline void put_float32_le( unsigned char *p, float const v )
+{
+   uint32_t u;
+   memcpy( &u, &v, sizeof( u ) );
+   put_uint32_le( p, u );
+}
+
+inline float get_float32_be( unsigned char const *p )
+{
+   uint32_t const u = get_uint32_be( p );
+   float          v;
+   memcpy( &v, &u, sizeof( v ) );
+   return v;
+}
+
+inline float get_float32_le( unsigned char const *p )
+{
+   uint32_t const u = get_uint32_le( p );
+   float          v;
+   memcpy( &v, &u, sizeof( v ) );
+   return v;
+}
+
+inline void put_float64_be( unsigned char *p, double const v )
+{
+   uint64_t u;
+   memcpy( &u, &v, sizeof( u ) );
+   put_uint64_be( p, u );
+}
+
+inline void put_float64_le( unsigned char *p, double const v )
+{
+   uint64_t u;
+   memcpy( &u, &v, sizeof( u ) );
+   put_uint64_le( p, u );
+}
+
+inline double get_float64_be( unsigned char const *p )
+{
+   uint64_t const u = get_uint64_be( p );
+   double         v;
+   memcpy( &v, &u, sizeof( v ) );
+   return v;
+}
+
+inline double get_float64_le( unsigned char const *p )
+{
+   uint64_t const u = get_uint64_le( p );
+   double         v;
+   memcpy( &v, &u, sizeof( v ) );
+   return v;
+}
+
+} // namespace FOMCodec
+} // namespace TrickHLA
+
+#endif // TRICKHLA_FOM_CODEC_BASICS
+'''
+
+
+def header_file_name( output ):
+   # Name the header by its include path when it is under an include directory.
+   parts = os.path.normpath( os.path.abspath( output ) ).split( os.sep )
+   if 'include' in parts[:-1]:
+      index = len( parts ) - 1 - parts[::-1].index( 'include' )
+      return '/'.join( parts[index + 1:] )
+   return os.path.basename( output )
+
+
+def generate_header( registry, ordered, namespace, file_name, foms ):
+   if '/' in file_name:
+      group = file_name.split( '/' )[0]
+      guard = cpp_identifier( file_name ).upper()
+   else:
+      group = 'TrickHLA'
+      guard = cpp_identifier( namespace + '_' + file_name ).upper()
+   lines = []
+   lines.append( '/*!' )
+   lines.append( '@file ' + file_name )
+   lines.append( '@ingroup ' + group )
+   lines.append( '@brief HLA data types and encode/decode functions generated from the' )
+   lines.append( 'FOM datatypes in:' )
+   for fom in foms:
+      lines.append( '  ' + fom )
+   lines.append( '' )
+   lines.append( 'This file was generated by scripts/generate_fom_codec.py, do not edit it.' )
+   lines.append( 'The fixed size datatypes are encoded with constant offsets and no memory' )
+   lines.append( 'allocation, the variable arrays use std::string, std::wstring or std::vector.' )
+   lines.append( '' )
+   lines.append( '@trick_parse{everything}' )
+   lines.append( '' )
+   lines.append( '@python_module{' + group + '}' )
+   lines.append( '*/' )
+   lines.append( '' )
+   lines.append( '#ifndef ' + guard )
+   lines.append( '#define ' + guard )
+   lines.append( '' )
+   lines.append( '// System include files.' )
+   lines.append( '#include <cstdint>' )
+   lines.append( '#include <cstring>' )
+   lines.append( '#include <stdlib.h>' )
+   lines.append( '#include <string>' )
+   lines.append( '#include <vector>' )
+   lines.append( '' )
+   lines.append( _BASICS )
+   lines.append( 'namespace ' + namespace )
+   lines.append( '{' )
+
+   for type_name in ordered:
+      fom_type = lookup( registry, type_name )
+      if isinstance( fom_type, BasicType ):
+         continue
+
+      section = []
+      if not fom_type.builtin:
+         section.extend( generate_declaration( registry, fom_type ) )
+         section.append( '' )
+
+      # The predefined scalar datatypes are always encoded in place.
+      if not ( fom_type.builtin and is_scalar( fom_type ) ):
+         if fixed_size( registry, fom_type ) is not None:
+            section.extend( generate_fixed_functions( registry, fom_type ) )
+         else:
+            section.extend( generate_variable_functions( registry, fom_type ) )
+
+      if section:
+         lines.append( '' )
+         lines.append( '// ' + fom_type.name )
+         lines.extend( section )
+
+   lines.append( '' )
+   lines.append( '} // namespace ' + namespace )
+   lines.append( '' )
+   lines.append( '#endif // ' + guard + ': Do NOT put anything after this line!' )
+   lines.append( '' )
+   return '\n'.join( lines )
+
+
+#
+# Call the main function.
+#
+main()
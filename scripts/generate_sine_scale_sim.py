@@ -0,0 +1,806 @@
+#!/usr/bin/env python3
+# @file generate_sine_scale_sim.py
+# @brief This program generates a scale-test variant of the SIM_sine simulation.
+#
+# This is a Python program used to generate a Trick simulation directory that
+# is a scaled up variant of SIM_sine. The generated simulation has N sine
+# wave objects built on the models/sine data, packing, lag compensation and
+# conditional classes, where each object has the Test class sine attributes
+# plus M payload attributes of a configurable size. The HLA object instances,
+# attributes and interactions are configured in the input files with the
+# Modified_data/TrickHLA TrickHLAObjectConfig, TrickHLAAttributeConfig,
+# TrickHLAInteractionConfig and TrickHLAParameterConfig classes.
+#
+# The generated simulation directory contains:
+#   S_define          - N sine sim-objects, the interaction sender, THLA and
+#                       the THLA_METRICS federate performance metrics.
+#   S_overrides.mk    - Build settings using TRICKHLA_HOME.
+#   FOMs/             - The SIM_sine FOM modules plus a ScaleTest.xml module
+#                       with the Test.ScaleTest class and payload attributes.
+#   Log_data/         - Data logging of the federate performance metrics.
+#   RUN_publisher/    - Federate that creates and publishes the N objects.
+#   RUN_subscriber/   - Federate that subscribes to the N objects.
+#
+# The run_sine_scale_tests.py driver uses this program to sweep a set of
+# configurations and report how the federates scale.
+#
+# @revs_title
+# @revs_begin
+# @rev_entry{ TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial creation.}
+# @revs_end
+#
+import sys
+import os
+import shutil
+import argparse
+import textwrap
+import json
+
+from trickhla_message import *
+
+# Names of the two federates in the generated federation.
+PUBLISHER_NAME = 'Scale-Publisher-Federate'
+SUBSCRIBER_NAME = 'Scale-Subscriber-Federate'
+
+# Name of the data recording group for the federate metrics.
+METRICS_LOG_GROUP = 'ScaleMetrics'
+
+# The sine attributes of the Test FOM class and the packing data for them.
+SINE_ATTRIBUTES = [( 'Time', 'time', 'ENCODING_LITTLE_ENDIAN' ),
+                   ( 'Value', 'value', 'ENCODING_LITTLE_ENDIAN' ),
+                   ( 'dvdt', 'dvdt', 'ENCODING_LITTLE_ENDIAN' ),
+                   ( 'Phase', 'phase_deg', 'ENCODING_LITTLE_ENDIAN' ),
+                   ( 'Frequency', 'freq', 'ENCODING_LITTLE_ENDIAN' ),
+                   ( 'Amplitude', 'amp', 'ENCODING_LITTLE_ENDIAN' ),
+                   ( 'Tolerance', 'tol', 'ENCODING_LITTLE_ENDIAN' ),
+                   ( 'Name', 'name', 'ENCODING_UNICODE_STRING' )]
+
+# Lag compensation choices and their TrickHLA enumeration values.
+LAG_COMP_TYPES = {'none': 'LAG_COMPENSATION_NONE',
+                  'send': 'LAG_COMPENSATION_SEND_SIDE',
+                  'receive': 'LAG_COMPENSATION_RECEIVE_SIDE'}
+
+
+# Main routine.
+def main():
+
+   #
+   # Setup command line argument parsing.
+   #
+   parser = argparse.ArgumentParser( prog = 'generate_sine_scale_sim', \
+                                     formatter_class = argparse.RawDescriptionHelpFormatter, \
+                                     description = 'Generate a SIM_sine scale-test simulation with N objects of M payload attributes.', \
+                                     epilog = textwrap.dedent( '''\n
+Examples:\n  generate_sine_scale_sim -n 100 -m 4 -s 64 -o sims/TrickHLA/SIM_sine_scale
+  generate_sine_scale_sim -n 1000 -m 0 --data-rate 0.1 --interaction-rate 0.05 --interaction-burst 10 --lag-comp receive -o SIM_sine_1000
+  generate_sine_scale_sim -n 2000 -m 2 --bulk-config -o SIM_sine_2000''' ) )
+
+   parser.add_argument( '-o', '--output', required = True, \
+                        help = 'Generated simulation directory.' )
+   parser.add_argument( '-n', '--objects', type = int, default = 10, \
+                        help = 'Number of sine objects (default 10).' )
+   parser.add_argument( '-m', '--attributes', type = int, default = 0, \
+                        help = 'Number of payload attributes per object in addition to the sine attributes (default 0).' )
+   parser.add_argument( '-s', '--attribute-size', type = int, default = 8, dest = 'attribute_size', \
+                        help = 'Size of each payload attribute in bytes (default 8).' )
+   parser.add_argument( '--data-rate', type = float, default = 0.25, dest = 'data_rate', \
+                        help = 'HLA data cycle time and lookahead in seconds (default 0.25).' )
+   parser.add_argument( '--payload-rate', type = float, default = 0.0, dest = 'payload_rate', \
+                        help = 'Send period of the payload attributes in seconds, a multiple of the data rate (default every data cycle).' )
+   parser.add_argument( '--interaction-rate', type = float, default = 0.0, dest = 'interaction_rate', \
+                        help = 'Period in seconds of the interaction sends, zero for no interactions (default 0).' )
+   parser.add_argument( '--interaction-burst', type = int, default = 1, dest = 'interaction_burst', \
+                        help = 'Number of interactions sent each interaction period (default 1).' )
+   parser.add_argument( '--interaction-both', action = 'store_true', dest = 'interaction_both', \
+                        help = 'Have the subscriber federate send interactions too.' )
+   parser.add_argument( '--lag-comp', choices = sorted( LAG_COMP_TYPES.keys() ), default = 'none', dest = 'lag_comp', \
+                        help = 'Lag compensation type of the objects (default none).' )
+   parser.add_argument( '--conditional', action = 'store_true', \
+                        help = 'Use the sine conditional to only send changed attributes, requires zero payload attributes.' )
+   parser.add_argument( '--bulk-config', action = 'store_true', dest = 'bulk_config', \
+                        help = 'Configure the objects and interactions from a TrickHLA::BulkConfigLoader JSON manifest.' )
+   parser.add_argument( '--run-duration', type = float, default = 30.0, dest = 'run_duration', \
+                        help = 'Scenario run duration in seconds (default 30).' )
+   parser.add_argument( '--realtime', action = 'store_true', \
+                        help = 'Run the federates in real-time instead of as fast as possible.' )
+   parser.add_argument( '--federation', default = None, \
+                        help = 'Federation name (default derived from the configuration).' )
+   parser.add_argument( '--local-settings', default = 'crcHost = localhost\n crcPort = 8989', dest = 'local_settings', \
+                        help = 'RTI local settings designator (default Pitch crcHost = localhost, crcPort = 8989).' )
+   parser.add_argument( '-f', '--force', action = 'store_true', \
+                        help = 'Overwrite an existing output directory.' )
+   parser.add_argument( '-v', '--verbose', action = 'store_true', \
+                        help = 'Generate verbose output.' )
+
+   # Parse the command line arguments.
+   args = parser.parse_args()
+
+   # Validate the configuration.
+   if args.objects < 1:
+      TrickHLAMessage.failure( 'The number of objects must be at least 1!' )
+   if args.attributes < 0:
+      TrickHLAMessage.failure( 'The number of payload attributes can not be negative!' )
+   if args.attribute_size < 1:
+      TrickHLAMessage.failure( 'The payload attribute size must be at least 1 byte!' )
+   if args.data_rate <= 0.0:
+      TrickHLAMessage.failure( 'The data rate must be greater than zero!' )
+   if args.payload_rate < 0.0 or args.interaction_rate < 0.0:
+      TrickHLAMessage.failure( 'The payload and interaction rates can not be negative!' )
+   if args.interaction_burst < 1:
+      TrickHLAMessage.failure( 'The interaction burst must be at least 1!' )
+   if args.conditional and args.attributes > 0:
+      # The sine conditional only knows about the sine attributes.
+      TrickHLAMessage.failure( 'The --conditional option requires zero payload attributes!' )
+   if args.payload_rate > 0.0:
+      ratio = args.payload_rate / args.data_rate
+      if abs( ratio - round( ratio ) ) > 1.0e-9 or round( ratio ) < 1:
+         TrickHLAMessage.failure( 'The payload rate must be an integer multiple of the data rate!' )
+
+   if args.federation is None:
+      args.federation = 'SineScale_N' + str( args.objects ) \
+                        + '_M' + str( args.attributes ) \
+                        + '_S' + str( args.attribute_size )
+
+   # Find the SIM_sine simulation to copy the shared files from.
+   trickhla_home = os.path.dirname( os.path.dirname( os.path.abspath( __file__ ) ) )
+   sine_sim_dir = os.path.join( trickhla_home, 'sims', 'TrickHLA', 'SIM_sine' )
+   if not os.path.isdir( sine_sim_dir ):
+      TrickHLAMessage.failure( 'SIM_sine simulation not found: ' + sine_sim_dir )
+
+   if os.path.exists( args.output ):
+      if not args.force:
+         TrickHLAMessage.failure( 'Output directory already exists, use --force to overwrite: ' + args.output )
+      shutil.rmtree( args.output )
+
+   if args.verbose:
+      TrickHLAMessage.status( 'Generating ' + str( args.objects ) + ' objects with '
+                              + str( args.attributes ) + ' payload attributes of '
+                              + str( args.attribute_size ) + ' bytes into: ' + args.output )
+
+   # Copy the SIM_sine FOM modules and add the scale-test FOM module.
+   shutil.copytree( os.path.join( sine_sim_dir, 'FOMs' ), os.path.join( args.output, 'FOMs' ) )
+   write_file( os.path.join( args.output, 'FOMs', 'ScaleTest.xml' ), generate_fom( args ) )
+
+   write_file( os.path.join( args.output, 'S_define' ), generate_s_define( args ) )
+   write_file( os.path.join( args.output, 'S_overrides.mk' ), generate_s_overrides() )
+   write_file( os.path.join( args.output, 'Log_data', 'log_scale_metrics.py' ), generate_log_data() )
+   write_file( os.path.join( args.output, 'RUN_publisher', 'input.py' ), generate_input( args, True ) )
+   write_file( os.path.join( args.output, 'RUN_subscriber', 'input.py' ), generate_input( args, False ) )
+   if args.bulk_config:
+      write_file( os.path.join( args.output, manifest_path( True ) ), generate_manifest( args, True ) )
+      write_file( os.path.join( args.output, manifest_path( False ) ), generate_manifest( args, False ) )
+
+   TrickHLAMessage.success( 'Generated ' + args.output )
+
+   return
+
+
+def write_file( path, text ):
+   directory = os.path.dirname( path )
+   if directory and not os.path.isdir( directory ):
+      os.makedirs( directory )
+   with open( path, 'w' ) as out_file:
+      out_file.write( text )
+   return
+
+
+def payload_attribute_names( args ):
+   return [( 'Payload' + str( k ), 'payload_' + str( k ) ) for k in range( args.attributes )]
+
+
+def generate_fom( args ):
+   lines = []
+   lines.append( '<?xml version="1.0" encoding="UTF-8"?>' )
+   lines.append( '<objectModel xmlns="http://www.sisostds.org/schemas/IEEE1516-2010"' )
+   lines.append( '             xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance"' )
+   lines.append( '             xsi:schemaLocation="http://www.sisostds.org/schemas/IEEE1516-2010 http://www.sisostds.org/schemas/IEEE1516-DIF-2010.xsd">' )
+   lines.append( '   <modelIdentification>' )
+   lines.append( '      <name>ScaleTest.xml</name>' )
+   lines.append( '      <type>FOM</type>' )
+   lines.append( '      <version>1.0</version>' )
+   lines.append( '      <securityClassification>Unclassified</securityClassification>' )
+   lines.append( '      <description>Generated by generate_sine_scale_sim: ' + str( args.attributes )
+                 + ' payload attributes of ' + str( args.attribute_size ) + ' bytes.</description>' )
+   lines.append( '   </modelIdentification>' )
+   lines.append( '   <objects>' )
+   lines.append( '      <objectClass>' )
+   lines.append( '         <name>HLAobjectRoot</name>' )
+   lines.append( '         <objectClass>' )
+   lines.append( '            <name>Test</name>' )
+   lines.append( '            <objectClass>' )
+   lines.append( '               <name>ScaleTest</name>' )
+   lines.append( '               <sharing>PublishSubscribe</sharing>' )
+   for ( fom_name, trick_name ) in payload_attribute_names( args ):
+      lines.append( '               <attribute>' )
+      lines.append( '                  <name>' + fom_name + '</name>' )
+      lines.append( '                  <dataType>ScalePayload</dataType>' )
+      lines.append( '                  <updateType>Periodic</updateType>' )
+      lines.append( '                  <ownership>DivestAcquire</ownership>' )
+      lines.append( '                  <sharing>PublishSubscribe</sharing>' )
+      lines.append( '                  <transportation>HLAreliable</transportation>' )
+      lines.append( '                  <order>TimeStamp</order>' )
+      lines.append( '               </attribute>' )
+   lines.append( '            </objectClass>' )
+   lines.append( '         </objectClass>' )
+   lines.append( '      </objectClass>' )
+   lines.append( '   </objects>' )
+   lines.append( '   <dataTypes>' )
+   lines.append( '      <arrayDataTypes>' )
+   lines.append( '         <arrayData>' )
+   lines.append( '            <name>ScalePayload</name>' )
+   lines.append( '            <dataType>HLAoctet</dataType>' )
+   lines.append( '            <cardinality>' + str( args.attribute_size ) + '</cardinality>' )
+   lines.append( '            <encoding>HLAfixedArray</encoding>' )
+   lines.append( '            <semantics>Scale-test payload.</semantics>' )
+   lines.append( '         </arrayData>' )
+   lines.append( '      </arrayDataTypes>' )
+   lines.append( '   </dataTypes>' )
+   lines.append( '</objectModel>' )
+   return '\n'.join( lines ) + '\n'
+
+
+def generate_s_define( args ):
+   interaction_rate = args.interaction_rate if args.interaction_rate > 0.0 else args.data_rate
+
+   text = textwrap.dedent( '''\
+      //=============================================================================
+      // Generated by generate_sine_scale_sim, do not edit.
+      //
+      // Scale-test variant of SIM_sine with {objects} sine objects, each with
+      // {attributes} payload attributes of {size} bytes.
+      //=============================================================================
+      #include "sim_objects/default_trick_sys.sm"
+
+      //=============================================================================
+      // Define the job calling intervals.
+      //=============================================================================
+      #define DYN_RATE  {data_rate} // The propagation rate of the sine objects.
+
+      //=============================================================================
+      // Define the HLA job cycle times.
+      //=============================================================================
+      #define THLA_DATA_CYCLE_TIME        {data_rate} // HLA data communication cycle time.
+      #define THLA_INTERACTION_CYCLE_TIME {data_rate} // HLA Interaction cycle time.
+      #define SCALE_INTERACTION_RATE      {interaction_rate} // Interaction send period.
+
+      //=============================================================================
+      // Define the HLA phase initialization priorities.
+      //=============================================================================
+      #define P_HLA_INIT   60    // HLA initialization phase.
+      #define P_HLA_EARLY  1     // HLA early job phase.
+      #define P_HLA_LATE   65534 // HLA late job phase.
+
+      ##include <cstring>
+
+      ##include "TrickHLA/Manager.hh"
+      ##include "TrickHLA/KnownFederate.hh"
+      ##include "TrickHLA/SimTimeline.hh"
+      ##include "TrickHLA/ScenarioTimeline.hh"
+      ##include "TrickHLA/BulkConfigLoader.hh"
+
+      ##include "sine/include/SineData.hh"
+      ##include "sine/include/SinePacking.hh"
+      ##include "sine/include/SineLagCompensation.hh"
+      ##include "sine/include/SineConditional.hh"
+      ##include "sine/include/SineInteractionHandler.hh"
+      ##include "sine/include/SineObjectDeleted.hh"
+
+      #define SCALE_PAYLOAD_SIZE {size} // Payload attribute size in bytes.
+
+      //=============================================================================
+      // SIM_OBJECT: ScaleSineSimObj
+      // Sim-object for an analytic sine wave with payload attributes.
+      //=============================================================================
+      class ScaleSineSimObj : public Trick::SimObject {{
+
+       public:
+         TrickHLAModel::SineData truth_data;
+         TrickHLAModel::SineData sim_data;
+
+         TrickHLAModel::SinePacking            packing;
+
+         TrickHLAModel::SineLagCompensation    lag_compensation;
+
+         TrickHLAModel::SineConditional        conditional;
+
+         TrickHLAModel::SineObjectDeleted      obj_deleted;
+
+         unsigned int payload_count;
+      ''' ).format( objects = args.objects,
+                    attributes = args.attributes,
+                    size = args.attribute_size,
+                    data_rate = repr( args.data_rate ),
+                    interaction_rate = repr( interaction_rate ) )
+
+   for ( fom_name, trick_name ) in payload_attribute_names( args ):
+      text += '   unsigned char ' + trick_name + '[SCALE_PAYLOAD_SIZE];\n'
+
+   text += textwrap.indent( textwrap.dedent( '''\
+
+         ScaleSineSimObj() : payload_count( 0 ) {
+            // TrickHLA API data flow, sending data:   sim-data --> lag-comp-data --> packing-data
+            // TrickHLA API data flow, receiving data: packing-data --> lag-comp-data --> sim-data
+            P50 ("initialization") lag_compensation.configure( &sim_data );
+            P50 ("initialization") lag_compensation.initialize();
+
+            P50 ("initialization") packing.configure( &lag_compensation );
+            P50 ("initialization") packing.initialize();
+
+            P50 ("initialization") conditional.configure( &packing );
+            P50 ("initialization") conditional.initialize();
+
+            (DYN_RATE, "scheduled") truth_data.compute_value( THLA.execution_control.get_scenario_time() );
+            (DYN_RATE, "scheduled") sim_data.compute_value( THLA.execution_control.get_scenario_time() );
+            (DYN_RATE, "scheduled") sim_data.compute_derivative( THLA.execution_control.get_scenario_time() );
+      ''' ), '   ' )
+   if args.attributes > 0:
+      text += '      (DYN_RATE, "scheduled") update_payload();\n'
+   text += '   }\n\n'
+
+   text += '   // Change the payload each frame so every update carries new data.\n'
+   text += '   void update_payload() {\n'
+   text += '      ++payload_count;\n'
+   for ( fom_name, trick_name ) in payload_attribute_names( args ):
+      text += '      memset( ' + trick_name + ', ( payload_count & 0xFF ), SCALE_PAYLOAD_SIZE );\n'
+   text += '   }\n'
+
+   text += textwrap.dedent( '''\
+
+       private:
+         // Do not allow the implicit copy constructor or assignment operator.
+         ScaleSineSimObj( ScaleSineSimObj const & rhs );
+         ScaleSineSimObj & operator=( ScaleSineSimObj const & rhs );
+      };
+
+
+      //=============================================================================
+      // SIM_OBJECT: ScaleInteractionSimObj
+      // Sim-object that sends a burst of sine interactions each period.
+      //=============================================================================
+      class ScaleInteractionSimObj : public Trick::SimObject {
+
+       public:
+         TrickHLAModel::SineInteractionHandler interaction_handler;
+
+         int burst_count; // Interactions sent each period, zero to send none.
+
+         ScaleInteractionSimObj() : burst_count( 0 ) {
+      ''' )
+   if args.interaction_rate > 0.0:
+      text += '      (SCALE_INTERACTION_RATE, "scheduled") send_burst( THLA.execution_control.get_scenario_time() );\n'
+   text += textwrap.dedent( '''\
+         }
+
+         void send_burst( double const send_time ) {
+            for ( int i = 0; i < burst_count; ++i ) {
+               interaction_handler.send_sine_interaction( send_time );
+            }
+         }
+
+       private:
+         // Do not allow the implicit copy constructor or assignment operator.
+         ScaleInteractionSimObj( ScaleInteractionSimObj const & rhs );
+         ScaleInteractionSimObj & operator=( ScaleInteractionSimObj const & rhs );
+      };
+
+
+      //=============================================================================
+      // SIM_OBJECT: THLA - Generalized TrickHLA interface routines.
+      //=============================================================================
+      #include "THLA.sm"
+      THLASimObject THLA( THLA_DATA_CYCLE_TIME,
+                          THLA_INTERACTION_CYCLE_TIME,
+                          P_HLA_EARLY,
+                          P_HLA_INIT,
+                          P_HLA_LATE );
+
+
+      //=============================================================================
+      // SIM_OBJECT: THLA_METRICS - Publish the performance metrics of the federate.
+      //=============================================================================
+      #include "THLAMetrics.sm"
+      THLAMetricsSimObject THLA_METRICS( THLA.federate,
+                                         THLA.manager,
+                                         THLA_DATA_CYCLE_TIME,
+                                         P_HLA_EARLY );
+
+
+      //=============================================================================
+      // SIM_OBJECT: THLA_INIT - Timelines used by the execution control.
+      //=============================================================================
+      class THLAInitSimObj : public Trick::SimObject {
+
+       public:
+
+         TrickHLA::SimTimeline      sim_timeline;
+         TrickHLA::ScenarioTimeline scenario_timeline;
+
+         THLAInitSimObj()
+            : scenario_timeline( sim_timeline, 0.0, 0.0 )
+         {
+            return;
+         }
+
+       private:
+         // Do not allow the implicit copy constructor or assignment operator.
+         THLAInitSimObj( THLAInitSimObj const & rhs );
+         THLAInitSimObj & operator=( THLAInitSimObj const & rhs );
+      };
+
+
+      // Instantiations
+      ''' )
+
+   for i in range( args.objects ):
+      text += 'ScaleSineSimObj        S' + str( i ) + ';\n'
+   text += 'ScaleInteractionSimObj I;\n'
+   text += 'THLAInitSimObj         THLA_INIT;\n'
+
+   return text
+
+
+def generate_s_overrides():
+   return textwrap.dedent( '''\
+      #=============================================================================
+      # Generated by generate_sine_scale_sim, do not edit.
+      #
+      # Allow user to specify their own package locations.
+      #   - File is skipped if not present
+      #=============================================================================
+      -include ${HOME}/.trickhla/S_user_env.mk
+
+      ifdef TRICKHLA_HOME
+      TRICK_SFLAGS += -I${TRICKHLA_HOME}/S_modules
+      include ${TRICKHLA_HOME}/makefiles/S_hla.mk
+      else
+      $(error "You must set the TRICKHLA_HOME environment variable.")
+      endif
+
+      #=============================================================================
+      # Construct Build Environment
+      #=============================================================================
+
+      TRICK_CFLAGS    += -Wno-deprecated-declarations -I. -I${TRICKHLA_HOME}/models
+      TRICK_CXXFLAGS  += -Wno-deprecated-declarations -I. -I${TRICKHLA_HOME}/models
+      ''' )
+
+
+def generate_log_data():
+   return textwrap.dedent( '''\
+      ##############################################################################
+      # PURPOSE:
+      #    (This is an input file python routine to log the federate performance
+      #     metrics of a generated sine scale-test simulation.)
+      #
+      # REFERENCE:
+      #    (Trick 17 documentation.)
+      #
+      # ASSUMPTIONS AND LIMITATIONS:
+      #    ((Assumes that trick and data_record are available globally.))
+      #
+      # PROGRAMMERS:
+      #    (((TrickHLA Team) (NASA/ER6) (Oct 2026) (--) (Initial version.)))
+      ##############################################################################
+
+      def log_scale_metrics( log_cycle ) :
+
+         # Create an ASCII recording group so the driver can read the CSV file.
+         dr_group = trick.DRAscii( '{group}' )
+         dr_group.thisown = 0
+
+         # Set the logging cycle frequency.
+         dr_group.set_cycle( log_cycle )
+
+         # Set up other logging parameters.
+         dr_group.set_freq( trick.DR_Always )
+         dr_group.enable()
+
+         for var in [ 'frame_time', 'frame_time_max', 'tag_wait_time',
+                      'pack_time', 'unpack_time', 'send_rate', 'receive_rate',
+                      'reflection_queue_depth', 'interaction_queue_depth',
+                      'total_overrun_count' ] :
+            dr_group.add_variable( 'THLA_METRICS.metrics.' + var )
+
+         # Add the data recording group to Trick's data recording.
+         trick.add_data_record_group( dr_group, trick.DR_Buffer )
+
+         return
+      ''' ).replace( '{group}', METRICS_LOG_GROUP )
+
+
+def generate_input( args, is_publisher ):
+   fed_name = PUBLISHER_NAME if is_publisher else SUBSCRIBER_NAME
+   lag_comp_type = LAG_COMP_TYPES[args.lag_comp]
+   sends_interactions = ( args.interaction_rate > 0.0 ) and ( is_publisher or args.interaction_both )
+   payload_cycle = args.payload_rate if args.payload_rate > 0.0 else 0.0
+
+   text = textwrap.dedent( '''\
+      ##############################################################################
+      # Generated by generate_sine_scale_sim, do not edit.
+      #
+      # {fed_name}: {objects} sine objects with {attributes} payload attributes
+      # of {size} bytes.
+      ##############################################################################
+      import os
+      import sys
+      import time
+      sys.path.append( os.environ['TRICKHLA_HOME'] )
+      from Modified_data.TrickHLA.TrickHLAObjectConfig import *
+      from Modified_data.TrickHLA.TrickHLAAttributeConfig import *
+      from Modified_data.TrickHLA.TrickHLAInteractionConfig import *
+      from Modified_data.TrickHLA.TrickHLAParameterConfig import *
+      from Modified_data.TrickHLA.TrickHLAFederateMetricsObject import *
+
+      #---------------------------------------------
+      # Set up Trick executive parameters.
+      #---------------------------------------------
+      trick.exec_set_trap_sigfpe(True)
+      trick.exec_set_enable_freeze(False)
+      trick.exec_set_freeze_command(False)
+      trick.sim_control_panel_set_enabled(False)
+      trick.exec_set_stack_trace(False)
+      trick.exec_set_software_frame({data_rate})
+      ''' ).format( fed_name = fed_name,
+                    objects = args.objects,
+                    attributes = args.attributes,
+                    size = args.attribute_size,
+                    data_rate = repr( args.data_rate ) )
+
+   if args.realtime:
+      text += 'trick.real_time_enable()\n'
+
+   text += textwrap.dedent( '''\
+
+      run_duration = {run_duration}
+
+      #---------------------------------------------
+      # Set up data to record.
+      #---------------------------------------------
+      exec(open( "Log_data/log_scale_metrics.py" ).read())
+      log_scale_metrics( 1.0 )
+
+
+      # =========================================================================
+      # Set up HLA interoperability.
+      # =========================================================================
+      THLA.federate.debug_level = trick.DEBUG_LEVEL_0_TRACE
+
+      THLA.federate.local_settings = {local_settings}
+      THLA.federate.lookahead_time = {data_rate}
+
+      # Configure the federate.
+      THLA.federate.name             = '{fed_name}'
+      THLA.federate.FOM_modules      = 'FOMs/S_FOMfile.xml,FOMs/ScaleTest.xml,FOMs/TrickHLAFreezeInteraction.xml,FOMs/TrickHLA/TrickHLAFederateMetrics.xml'
+      THLA.federate.federation_name  = '{federation}'
+      THLA.federate.time_regulating  = True
+      THLA.federate.time_constrained = True
+
+      # Set the timelines used by the execution control.
+      THLA.execution_control.sim_timeline      = THLA_INIT.sim_timeline
+      THLA.execution_control.scenario_timeline = THLA_INIT.scenario_timeline
+
+      # Both federates must join before the scale test starts.
+      THLA.federate.enable_known_feds      = True
+      THLA.federate.known_feds_count       = 2
+      THLA.federate.known_feds             = trick.sim_services.alloc_type( THLA.federate.known_feds_count, 'TrickHLA::KnownFederate' )
+      THLA.federate.known_feds[0].name     = '{publisher}'
+      THLA.federate.known_feds[0].required = True
+      THLA.federate.known_feds[1].name     = '{subscriber}'
+      THLA.federate.known_feds[1].required = True
+
+      THLA.simple_sim_config.owner        = '{publisher}'
+      THLA.simple_sim_config.run_duration = run_duration
+      #---------------------------------------------
+      # Sine wave initial states.
+      #---------------------------------------------
+      object_count = {objects}
+
+      for indx in range( object_count ) :
+         sim_obj_name = 'S' + str( indx )
+         sim_obj      = eval( sim_obj_name )
+
+         # Give each object a unique name and sine wave.
+         sim_obj.sim_data.name = sim_obj_name + '.sim_data.name'
+         for data in [ sim_obj.truth_data, sim_obj.sim_data ] :
+            data.value = 0.0
+            data.amp   = 1.0
+            data.phase = 0.0
+            data.freq  = 0.1 + 0.001 * indx
+            data.dvdt  = data.amp * data.freq
+
+      I.interaction_handler.name = '{fed_name}: I.interaction_handler.name'
+      I.burst_count = {burst_count}
+
+      # Only the TrickHLA object and interaction configuration is timed.
+      config_start_time = time.time()
+      ''' ).format( fed_name = fed_name,
+                    publisher = PUBLISHER_NAME,
+                    subscriber = SUBSCRIBER_NAME,
+                    federation = args.federation,
+                    local_settings = repr( args.local_settings ),
+                    data_rate = repr( args.data_rate ),
+                    run_duration = repr( args.run_duration ),
+                    burst_count = args.interaction_burst if sends_interactions else 0,
+                    objects = args.objects )
+
+   if args.bulk_config:
+      text += textwrap.dedent( '''\
+
+         #---------------------------------------------
+         # Objects and interactions from the bulk configuration manifest.
+         #---------------------------------------------
+         loader = trick.TrickHLA.BulkConfigLoader()
+         for indx in range( object_count ) :
+            sim_obj_name = 'S' + str( indx )
+            sim_obj      = eval( sim_obj_name )
+            loader.register_packing( sim_obj_name, sim_obj.packing )
+            loader.register_lag_compensation( sim_obj_name, sim_obj.lag_compensation )
+            loader.register_conditional( sim_obj_name, sim_obj.conditional )
+            loader.register_object_deleted( sim_obj_name, sim_obj.obj_deleted )
+         loader.register_interaction_handler( 'I', I.interaction_handler )
+
+         # Leave the last object slot for the federate performance metrics.
+         loader.load( '{manifest}', THLA.manager, 1, 0 )
+         ''' ).format( manifest = manifest_path( is_publisher ) )
+   else:
+      text += textwrap.dedent( '''\
+
+         #---------------------------------------------
+         # Interactions.
+         #---------------------------------------------
+         communication = TrickHLAInteractionConfig( 'Communication', {send}, True, I.interaction_handler )
+         communication.parameters.append( TrickHLAParameterConfig( 'Message', 'I.interaction_handler.message', trick.ENCODING_UNICODE_STRING ) )
+         communication.parameters.append( TrickHLAParameterConfig( 'time', 'I.interaction_handler.time', trick.ENCODING_LITTLE_ENDIAN ) )
+         communication.parameters.append( TrickHLAParameterConfig( 'year', 'I.interaction_handler.year', trick.ENCODING_LITTLE_ENDIAN ) )
+
+         THLA.manager.inter_count  = 1
+         THLA.manager.interactions = trick.sim_services.alloc_type( THLA.manager.inter_count, 'TrickHLA::Interaction' )
+         communication.initialize( THLA.manager.interactions[0] )
+
+
+         #---------------------------------------------
+         # Objects.
+         #---------------------------------------------
+         payload_count = {attributes}
+         payload_cycle = {payload_cycle}
+
+         # One object per sine sim-object plus the federate performance metrics.
+         THLA.manager.obj_count = object_count + 1
+         THLA.manager.objects   = trick.sim_services.alloc_type( THLA.manager.obj_count, 'TrickHLA::Object' )
+
+         sine_attributes = {sine_attributes}
+
+         for indx in range( object_count ) :
+            sim_obj_name = 'S' + str( indx )
+            sim_obj      = eval( sim_obj_name )
+
+            fed_object = TrickHLAObjectConfig( {create},
+                                               '{publisher}.Scale' + str( indx ),
+                                               'Test.ScaleTest',
+                                               sim_obj.lag_compensation,
+                                               trick.{lag_comp_type},
+                                               None,
+                                               sim_obj.obj_deleted,
+                                               {conditional},
+                                               sim_obj.packing,
+                                               THLA.manager.objects[indx] )
+
+            for ( fom_name, packing_name, encoding ) in sine_attributes :
+               fed_object.attributes.append( TrickHLAAttributeConfig( fom_name,
+                                                                      sim_obj_name + '.packing.' + packing_name,
+                                                                      {create},
+                                                                      {subscribe},
+                                                                      {create},
+                                                                      trick.CONFIG_CYCLIC,
+                                                                      eval( 'trick.' + encoding ) ) )
+
+            for k in range( payload_count ) :
+               fed_object.attributes.append( TrickHLAAttributeConfig( 'Payload' + str( k ),
+                                                                      sim_obj_name + '.payload_' + str( k ),
+                                                                      {create},
+                                                                      {subscribe},
+                                                                      {create},
+                                                                      trick.CONFIG_CYCLIC,
+                                                                      trick.ENCODING_LITTLE_ENDIAN ) )
+
+            fed_object.initialize( THLA.manager.objects[indx] )
+
+            # Send the payload attributes at their own rate if configured.
+            if payload_cycle > 0.0 :
+               for k in range( payload_count ) :
+                  THLA.manager.objects[indx].attributes[len( sine_attributes ) + k].cycle_time = payload_cycle
+         ''' ).format( publisher = PUBLISHER_NAME,
+                       send = str( sends_interactions ),
+                       attributes = args.attributes,
+                       payload_cycle = repr( payload_cycle ),
+                       sine_attributes = '[ ' + ',\n                       '.join( [repr( attr ) for attr in SINE_ATTRIBUTES] ) + ' ]',
+                       create = str( is_publisher ),
+                       subscribe = str( not is_publisher ),
+                       lag_comp_type = lag_comp_type,
+                       conditional = 'sim_obj.conditional' if args.conditional else 'None' )
+
+   text += textwrap.dedent( '''\
+
+      # Publish the performance metrics of this federate.
+      metrics_object = TrickHLAFederateMetricsObject( True,
+                                                      '{fed_name}.Metrics',
+                                                      THLA_METRICS.metrics,
+                                                      'THLA_METRICS.metrics',
+                                                      THLA.manager.objects[object_count] )
+      metrics_object.initialize( THLA.manager.objects[object_count] )
+
+      # The run_sine_scale_tests.py driver reads this line from the output.
+      print( 'Object configuration time: %.6f seconds' % ( time.time() - config_start_time ) )
+
+
+      #---------------------------------------------
+      # Set up simulation termination time.
+      #---------------------------------------------
+      trick.sim_services.exec_set_terminate_time( run_duration )
+      ''' ).format( fed_name = fed_name )
+
+   return text
+
+
+def manifest_path( is_publisher ):
+   return 'Modified_data/scale_' + ( 'publisher' if is_publisher else 'subscriber' ) + '.json'
+
+
+def generate_manifest( args, is_publisher ):
+   # The same objects and interactions the input file configures otherwise,
+   # as a TrickHLA::BulkConfigLoader manifest.
+   sends_interactions = ( args.interaction_rate > 0.0 ) and ( is_publisher or args.interaction_both )
+
+   attributes = []
+   for ( fom_name, packing_name, encoding ) in SINE_ATTRIBUTES:
+      attributes.append( {'FOM_name': fom_name,
+                          'trick_name': 'S{i}.packing.' + packing_name,
+                          'config': 'CONFIG_CYCLIC',
+                          'publish': is_publisher,
+                          'subscribe': not is_publisher,
+                          'locally_owned': is_publisher,
+                          'rti_encoding': encoding} )
+   for ( fom_name, trick_name ) in payload_attribute_names( args ):
+      attribute = {'FOM_name': fom_name,
+                   'trick_name': 'S{i}.' + trick_name,
+                   'config': 'CONFIG_CYCLIC',
+                   'publish': is_publisher,
+                   'subscribe': not is_publisher,
+                   'locally_owned': is_publisher,
+                   'rti_encoding': 'ENCODING_LITTLE_ENDIAN'}
+      if args.payload_rate > 0.0:
+         attribute['cycle_time'] = args.payload_rate
+      attributes.append( attribute )
+
+   scale_object = {'name': PUBLISHER_NAME + '.Scale{i}',
+                   'FOM_name': 'Test.ScaleTest',
+                   'count': args.objects,
+                   'create': is_publisher,
+                   'packing': 'S{i}',
+                   'lag_comp': 'S{i}',
+                   'lag_comp_type': LAG_COMP_TYPES[args.lag_comp],
+                   'deleted': 'S{i}',
+                   'attributes': 'scale'}
+   if args.conditional:
+      scale_object['conditional'] = 'S{i}'
+
+   parameters = [{'FOM_name': 'Message', 'trick_name': 'I.interaction_handler.message', 'rti_encoding': 'ENCODING_UNICODE_STRING'},
+                 {'FOM_name': 'time', 'trick_name': 'I.interaction_handler.time', 'rti_encoding': 'ENCODING_LITTLE_ENDIAN'},
+                 {'FOM_name': 'year', 'trick_name': 'I.interaction_handler.year', 'rti_encoding': 'ENCODING_LITTLE_ENDIAN'}]
+   communication = {'FOM_name': 'Communication',
+                    'publish': sends_interactions,
+                    'subscribe': True,
+                    'handler': 'I',
+                    'parameters': parameters}
+
+   manifest = {'attribute_sets': {'scale': attributes},
+               'objects': [scale_object],
+               'interactions': [communication]}
+
+   return json.dumps( manifest, indent = 2 ) + '\n'
+
+
+#
+# Call the main function.
+#
+main()
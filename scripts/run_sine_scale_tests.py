@@ -0,0 +1,338 @@
+#!/usr/bin/env python3
+# @file run_sine_scale_tests.py
+# @brief This program runs a sweep of sine scale-test federations and reports
+# how TrickHLA scales with the number of objects, attributes and their sizes.
+#
+# This is a Python program used to drive the generate_sine_scale_sim.py
+# generator. For each combination of object count, payload attribute count
+# and payload attribute size it generates the simulation, builds it with
+# trick-CP, runs the publisher and subscriber federates, samples the memory
+# of each federate from /proc, and reads the logged TrickHLA federate metrics.
+# The results are written to a CSV file and a Markdown table.
+#
+# The federates connect to the RTI specified by the local settings, so the
+# RTI (e.g. the Pitch CRC) must already be running.
+#
+# @revs_title
+# @revs_begin
+# @rev_entry{ TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial creation.}
+# @revs_end
+#
+import sys
+import os
+import csv
+import glob
+import time
+import argparse
+import textwrap
+import subprocess
+
+from trickhla_message import *
+
+# The federate run directories and the metrics log file the generator creates.
+RUN_DIRS = ['RUN_subscriber', 'RUN_publisher']
+METRICS_LOG_FILE = 'log_ScaleMetrics.csv'
+
+# Columns of the scaling report.
+REPORT_COLUMNS = ['objects', 'attributes', 'attribute_size', 'federate',
+                  'frame_time_ms', 'frame_time_max_ms', 'tag_wait_ms',
+                  'pack_ms', 'unpack_ms', 'send_KBps', 'receive_KBps',
+                  'max_reflection_queue', 'max_interaction_queue',
+                  'overruns', 'peak_rss_MB', 'config_time_s', 'wall_time_s', 'status']
+
+
+# Main routine.
+def main():
+
+   #
+   # Setup command line argument parsing.
+   #
+   parser = argparse.ArgumentParser( prog = 'run_sine_scale_tests', \
+                                     formatter_class = argparse.RawDescriptionHelpFormatter, \
+                                     description = 'Generate, build and run sine scale-test federations and write a scaling report.', \
+                                     epilog = textwrap.dedent( '''\n
+Examples:\n  run_sine_scale_tests -n 10,100,1000 -m 0,4 -s 64 -w /tmp/sine_scale
+  run_sine_scale_tests -n 100 -m 8 -s 8,256,4096 --interaction-rate 0.25 --interaction-burst 10 -w /tmp/sine_scale -r payload_sizes''' ) )
+
+   parser.add_argument( '-w', '--work-dir', required = True, dest = 'work_dir', \
+                        help = 'Directory to generate and run the simulations in.' )
+   parser.add_argument( '-n', '--objects', default = '10,100', \
+                        help = 'Comma separated list of object counts (default 10,100).' )
+   parser.add_argument( '-m', '--attributes', default = '0', \
+                        help = 'Comma separated list of payload attribute counts (default 0).' )
+   parser.add_argument( '-s', '--attribute-size', default = '8', dest = 'attribute_size', \
+                        help = 'Comma separated list of payload attribute sizes in bytes (default 8).' )
+   parser.add_argument( '-r', '--report', default = 'scale_report', \
+                        help = 'Report file name without extension, written to the work directory (default scale_report).' )
+   parser.add_argument( '--data-rate', default = '0.25', dest = 'data_rate', \
+                        help = 'HLA data cycle time in seconds (default 0.25).' )
+   parser.add_argument( '--payload-rate', default = '0.0', dest = 'payload_rate', \
+                        help = 'Send period of the payload attributes in seconds (default every data cycle).' )
+   parser.add_argument( '--interaction-rate', default = '0.0', dest = 'interaction_rate', \
+                        help = 'Period in seconds of the interaction sends (default 0, none).' )
+   parser.add_argument( '--interaction-burst', default = '1', dest = 'interaction_burst', \
+                        help = 'Number of interactions sent each interaction period (default 1).' )
+   parser.add_argument( '--interaction-both', action = 'store_true', dest = 'interaction_both', \
+                        help = 'Have the subscriber federate send interactions too.' )
+   parser.add_argument( '--lag-comp', default = 'none', dest = 'lag_comp', \
+                        help = 'Lag compensation type: none, send or receive (default none).' )
+   parser.add_argument( '--bulk-config', action = 'store_true', dest = 'bulk_config', \
+                        help = 'Configure the objects from a JSON manifest instead of the input file.' )
+   parser.add_argument( '--run-duration', default = '30.0', dest = 'run_duration', \
+                        help = 'Scenario run duration in seconds (default 30).' )
+   parser.add_argument( '--realtime', action = 'store_true', \
+                        help = 'Run the federates in real-time instead of as fast as possible.' )
+   parser.add_argument( '--local-settings', default = None, dest = 'local_settings', \
+                        help = 'RTI local settings designator passed to the generator.' )
+   parser.add_argument( '--timeout', type = float, default = 600.0, \
+                        help = 'Wall clock seconds to wait for a configuration to finish (default 600).' )
+   parser.add_argument( '--no-build', action = 'store_true', dest = 'no_build', \
+                        help = 'Do not generate or build, run the previously built simulations.' )
+   parser.add_argument( '-v', '--verbose', action = 'store_true', \
+                        help = 'Generate verbose output.' )
+
+   # Parse the command line arguments.
+   args = parser.parse_args()
+
+   if 'TRICKHLA_HOME' not in os.environ:
+      TrickHLAMessage.failure( 'You must set the TRICKHLA_HOME environment variable.' )
+
+   object_counts = parse_list( args.objects, 'objects' )
+   attribute_counts = parse_list( args.attributes, 'attributes' )
+   attribute_sizes = parse_list( args.attribute_size, 'attribute-size' )
+
+   if not os.path.isdir( args.work_dir ):
+      os.makedirs( args.work_dir )
+
+   rows = []
+   for objects in object_counts:
+      for attributes in attribute_counts:
+         for size in attribute_sizes:
+            rows.extend( run_configuration( args, objects, attributes, size ) )
+
+            # Write the report after each configuration so a long sweep that
+            # is interrupted still has the results so far.
+            write_report( args, rows )
+
+   TrickHLAMessage.success( 'Scaling report: ' + os.path.join( args.work_dir, args.report + '.md' ) )
+
+   return
+
+
+def parse_list( text, option ):
+   try:
+      values = [int( value ) for value in text.split( ',' ) if value.strip()]
+   except ValueError:
+      TrickHLAMessage.failure( 'Invalid --' + option + ' list: ' + text )
+   if not values:
+      TrickHLAMessage.failure( 'Empty --' + option + ' list!' )
+   return values
+
+
+def run_configuration( args, objects, attributes, size ):
+   config_name = 'SIM_sine_scale_N' + str( objects ) + '_M' + str( attributes ) + '_S' + str( size )
+   sim_dir = os.path.join( args.work_dir, config_name )
+
+   TrickHLAMessage.status( 'Configuration ' + config_name )
+
+   if not args.no_build:
+      if not generate( args, sim_dir, objects, attributes, size ) or not build( args, sim_dir ):
+         return [failed_row( objects, attributes, size, 'build failed' )]
+
+   executables = glob.glob( os.path.join( sim_dir, 'S_main_*.exe' ) )
+   if not executables:
+      return [failed_row( objects, attributes, size, 'no executable' )]
+   executable = os.path.abspath( executables[0] )
+
+   # Remove the metrics logs of a previous run.
+   for run_dir in RUN_DIRS:
+      log_file = os.path.join( sim_dir, run_dir, METRICS_LOG_FILE )
+      if os.path.isfile( log_file ):
+         os.remove( log_file )
+
+   # Start the subscriber first so it is joined when the publisher registers
+   # its objects, then the publisher.
+   processes = []
+   for run_dir in RUN_DIRS:
+      out_file = open( os.path.join( sim_dir, run_dir, 'scale_test.log' ), 'w' )
+      process = subprocess.Popen( [executable, os.path.join( run_dir, 'input.py' )],
+                                  cwd = sim_dir, stdout = out_file, stderr = subprocess.STDOUT )
+      processes.append( ( run_dir, process, out_file ) )
+
+   peak_rss = {run_dir: 0 for run_dir in RUN_DIRS}
+   start_time = time.time()
+   timed_out = False
+   while any( process.poll() is None for ( run_dir, process, out_file ) in processes ):
+      for ( run_dir, process, out_file ) in processes:
+         if process.poll() is None:
+            peak_rss[run_dir] = max( peak_rss[run_dir], read_peak_rss_kB( process.pid ) )
+      if ( time.time() - start_time ) > args.timeout:
+         timed_out = True
+         for ( run_dir, process, out_file ) in processes:
+            if process.poll() is None:
+               process.kill()
+         break
+      time.sleep( 0.25 )
+   wall_time = time.time() - start_time
+
+   rows = []
+   for ( run_dir, process, out_file ) in processes:
+      process.wait()
+      out_file.close()
+
+      if timed_out:
+         status = 'timed out'
+      elif process.returncode != 0:
+         status = 'exit ' + str( process.returncode )
+      else:
+         status = 'ok'
+
+      row = read_metrics( os.path.join( sim_dir, run_dir, METRICS_LOG_FILE ) )
+      row['config_time_s'] = read_config_time( os.path.join( sim_dir, run_dir, 'scale_test.log' ) )
+      row.update( {'objects': objects,
+                   'attributes': attributes,
+                   'attribute_size': size,
+                   'federate': run_dir.replace( 'RUN_', '' ),
+                   'peak_rss_MB': round( peak_rss[run_dir] / 1024.0, 1 ),
+                   'wall_time_s': round( wall_time, 1 ),
+                   'status': status} )
+      rows.append( row )
+
+      if args.verbose:
+         TrickHLAMessage.status( '  ' + run_dir + ': ' + status )
+
+   return rows
+
+
+def generate( args, sim_dir, objects, attributes, size ):
+   command = [sys.executable, os.path.join( os.path.dirname( os.path.abspath( __file__ ) ), 'generate_sine_scale_sim.py' ),
+              '-f', '-o', sim_dir,
+              '-n', str( objects ),
+              '-m', str( attributes ),
+              '-s', str( size ),
+              '--data-rate', args.data_rate,
+              '--payload-rate', args.payload_rate,
+              '--interaction-rate', args.interaction_rate,
+              '--interaction-burst', args.interaction_burst,
+              '--lag-comp', args.lag_comp,
+              '--run-duration', args.run_duration]
+   if args.interaction_both:
+      command.append( '--interaction-both' )
+   if args.realtime:
+      command.append( '--realtime' )
+   if args.bulk_config:
+      command.append( '--bulk-config' )
+   if args.local_settings is not None:
+      command.extend( ['--local-settings', args.local_settings] )
+
+   if subprocess.call( command ) != 0:
+      TrickHLAMessage.warning( 'Failed to generate ' + sim_dir )
+      return False
+   return True
+
+
+def build( args, sim_dir ):
+   with open( os.path.join( sim_dir, 'build.log' ), 'w' ) as build_log:
+      try:
+         status = subprocess.call( ['trick-CP'], cwd = sim_dir, stdout = build_log, stderr = subprocess.STDOUT )
+      except OSError:
+         TrickHLAMessage.failure( 'The trick-CP command was not found, make sure Trick is in your PATH.' )
+      if status != 0:
+         TrickHLAMessage.warning( 'Failed to build ' + sim_dir + ', see build.log' )
+         return False
+   return True
+
+
+def read_peak_rss_kB( pid ):
+   # Use the high water mark of the resident set size, which the kernel keeps
+   # for the life of the process, so short peaks between samples are seen.
+   try:
+      with open( '/proc/' + str( pid ) + '/status' ) as status_file:
+         for line in status_file:
+            if line.startswith( 'VmHWM:' ):
+               return int( line.split()[1] )
+   except ( IOError, OSError, ValueError ):
+      pass
+   return 0
+
+
+def read_config_time( out_file ):
+   # The generated input files print how long the object configuration took.
+   if os.path.isfile( out_file ):
+      with open( out_file ) as log:
+         for line in log:
+            if line.startswith( 'Object configuration time:' ):
+               return round( float( line.split()[3] ), 3 )
+   return ''
+
+
+def read_metrics( log_file ):
+   row = {}
+   if not os.path.isfile( log_file ):
+      return row
+
+   with open( log_file ) as csv_file:
+      reader = csv.reader( csv_file )
+      header = next( reader, None )
+      if header is None:
+         return row
+      # Trick column names look like 'THLA_METRICS.metrics.frame_time {s}'.
+      names = [column.split()[0].split( '.' )[-1] for column in header]
+      samples = []
+      for values in reader:
+         try:
+            samples.append( dict( zip( names, [float( value ) for value in values] ) ) )
+         except ValueError:
+            continue
+
+   # The first publish period includes the federation startup, skip it.
+   samples = [sample for sample in samples[1:] if sample.get( 'frame_time', 0.0 ) > 0.0]
+   if not samples:
+      return row
+
+   def mean( name ):
+      return sum( sample.get( name, 0.0 ) for sample in samples ) / len( samples )
+
+   def peak( name ):
+      return max( sample.get( name, 0.0 ) for sample in samples )
+
+   row['frame_time_ms'] = round( 1000.0 * mean( 'frame_time' ), 3 )
+   row['frame_time_max_ms'] = round( 1000.0 * peak( 'frame_time_max' ), 3 )
+   row['tag_wait_ms'] = round( 1000.0 * mean( 'tag_wait_time' ), 3 )
+   row['pack_ms'] = round( 1000.0 * mean( 'pack_time' ), 3 )
+   row['unpack_ms'] = round( 1000.0 * mean( 'unpack_time' ), 3 )
+   row['send_KBps'] = round( mean( 'send_rate' ) / 1024.0, 1 )
+   row['receive_KBps'] = round( mean( 'receive_rate' ) / 1024.0, 1 )
+   row['max_reflection_queue'] = int( peak( 'reflection_queue_depth' ) )
+   row['max_interaction_queue'] = int( peak( 'interaction_queue_depth' ) )
+   row['overruns'] = int( samples[-1].get( 'total_overrun_count', 0.0 ) )
+   return row
+
+
+def failed_row( objects, attributes, size, status ):
+   return {'objects': objects, 'attributes': attributes, 'attribute_size': size, 'status': status}
+
+
+def write_report( args, rows ):
+   with open( os.path.join( args.work_dir, args.report + '.csv' ), 'w' ) as csv_file:
+      writer = csv.DictWriter( csv_file, fieldnames = REPORT_COLUMNS, restval = '' )
+      writer.writeheader()
+      for row in rows:
+         writer.writerow( row )
+
+   with open( os.path.join( args.work_dir, args.report + '.md' ), 'w' ) as md_file:
+      md_file.write( '# Sine Scale-Test Report\n\n' )
+      md_file.write( 'Data rate ' + args.data_rate + ' s, run duration ' + args.run_duration
+                     + ' s, interaction rate ' + args.interaction_rate + ' s with bursts of '
+                     + args.interaction_burst + ', lag compensation ' + args.lag_comp + '.\n\n' )
+      md_file.write( '| ' + ' | '.join( REPORT_COLUMNS ) + ' |\n' )
+      md_file.write( '|' + '---|' * len( REPORT_COLUMNS ) + '\n' )
+      for row in rows:
+         md_file.write( '| ' + ' | '.join( str( row.get( column, '' ) ) for column in REPORT_COLUMNS ) + ' |\n' )
+   return
+
+
+#
+# Call the main function.
+#
+main()
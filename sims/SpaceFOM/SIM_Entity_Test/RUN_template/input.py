@@ -0,0 +1,311 @@
+##############################################################################
+# PURPOSE:
+#    (This is a Python input file for configuring a Space Reference FOM
+#     example federate that mirrors the PhysicalEntity, DynamicalEntity and
+#     ReferenceFrame objects of the other federates using object templates.)
+#
+# REFERENCE:
+#    (Trick 17 documentation.)
+#
+# ASSUMPTIONS AND LIMITATIONS:
+#    ((Uses the SpaceFOMFederateConfig Python class.)
+#     (Uses the SpaceFOMRefFrameObject Python class.)
+#     (Uses the SpaceFOMObjectTemplates Python class.)
+#     (The S_define entity and frame objects are only used as the template
+#      prototypes, they are not configured as HLA objects.))
+#
+# PROGRAMMERS:
+#    (((TrickHLA Team) (NASA/ER6) (Oct 2026) (--) (Initial version.)))
+##############################################################################
+import sys
+sys.path.append('../../../')
+
+# Load the SpaceFOM specific federate configuration object.
+from Modified_data.SpaceFOM.SpaceFOMFederateConfig import *
+
+# Load the SpaceFOM specific reference frame configuration object.
+from Modified_data.SpaceFOM.SpaceFOMRefFrameObject import *
+
+# Load the SpaceFOM object templates configuration object.
+from Modified_data.SpaceFOM.SpaceFOMObjectTemplates import *
+
+def print_usage_message( ):
+
+   print(' ')
+   print('TrickHLA SpaceFOM Entity Mirror Simulation Command Line Configuration Options:')
+   print('  -h --help            : Print this help message.')
+   print('  -f --fed_name [name] : Name of the Federate, default is EntityMirror.')
+   print('  -fe --fex_name [name]: Name of the Federation Execution, default is SpaceFOM_Roles_Test.')
+   print('  -p --pool [count]    : Number of objects in each template pool, default is 4.')
+   print('  --nostop             : Set no stop time on simulation.')
+   print('  -s --stop [time]     : Time to stop simulation, default is 10.0 seconds.')
+   print('  --verbose [on|off]   : on: Show verbose messages (Default), off: disable messages.')
+   print(' ')
+
+   trick.exec_terminate_with_return( -1,
+                                     sys._getframe(0).f_code.co_filename,
+                                     sys._getframe(0).f_lineno,
+                                     'Print usage message.')
+   return
+
+
+def parse_command_line( ) :
+
+   global print_usage
+   global run_duration
+   global verbose
+   global federate_name
+   global federation_name
+   global pool_size
+
+   # Get the Trick command line arguments.
+   argc = trick.command_line_args_get_argc()
+   argv = trick.command_line_args_get_argv()
+
+   # Process the command line arguments.
+   # argv[0]=S_main*.exe, argv[1]=RUN/input.py file
+   index = 2
+   while (index < argc) :
+
+      if ((str(argv[index]) == '-s') | (str(argv[index]) == '--stop')) :
+         index = index + 1
+         if (index < argc) :
+            run_duration = float(str(argv[index]))
+         else :
+            print('ERROR: Missing --stop [time] argument.')
+            print_usage = True
+
+      elif (str(argv[index]) == '--nostop') :
+         run_duration = None
+
+      elif ((str(argv[index]) == '-h') | (str(argv[index]) == '--help')) :
+         print_usage = True
+
+      elif ((str(argv[index]) == '-f') | (str(argv[index]) == '--fed_name')) :
+         index = index + 1
+         if (index < argc) :
+            federate_name = str(argv[index])
+         else :
+            print('ERROR: Missing --fed_name [name] argument.')
+            print_usage = True
+
+      elif ((str(argv[index]) == '-fe') | (str(argv[index]) == '--fex_name')) :
+         index = index + 1
+         if (index < argc) :
+            federation_name = str(argv[index])
+         else :
+            print('ERROR: Missing --fex_name [name] argument.')
+            print_usage = True
+
+      elif ((str(argv[index]) == '-p') | (str(argv[index]) == '--pool')) :
+         index = index + 1
+         if (index < argc) :
+            pool_size = int(str(argv[index]))
+         else :
+            print('ERROR: Missing --pool [count] argument.')
+            print_usage = True
+
+      elif (str(argv[index]) == '--verbose') :
+         index = index + 1
+         if (index < argc) :
+            if (str(argv[index]) == 'on') :
+               verbose = True
+            elif (str(argv[index]) == 'off') :
+               verbose = False
+            else :
+               print('ERROR: Unknown --verbose argument: ' + str(argv[index]))
+               print_usage = True
+         else :
+            print('ERROR: Missing --verbose [on|off] argument.')
+            print_usage = True
+
+      elif ((str(argv[index]) == '-d')) :
+         # Pass this on to Trick.
+         break
+
+      else :
+         print('ERROR: Unknown command line argument ' + str(argv[index]))
+         print_usage = True
+
+      index = index + 1
+   return
+
+# Default: Don't show usage.
+print_usage = False
+
+# Set the default run duration.
+run_duration = 10.0
+
+# Default is to NOT show verbose messages.
+verbose = False
+
+# Set the default Federate name.
+federate_name = 'EntityMirror'
+
+# Set the default Federation Execution name.
+federation_name = 'SpaceFOM_Roles_Test'
+
+# Set the default number of objects in each template pool.
+pool_size = 4
+
+
+parse_command_line()
+
+if (print_usage == True) :
+   print_usage_message()
+
+
+#---------------------------------------------
+# Set up Trick executive parameters.
+#---------------------------------------------
+#instruments.echo_jobs.echo_jobs_on()
+trick.exec_set_trap_sigfpe(True)
+
+trick.exec_set_enable_freeze(False)
+trick.exec_set_freeze_command(False)
+trick.sim_control_panel_set_enabled(False)
+trick.exec_set_stack_trace(False)
+
+#---------------------------------------------
+# Setup the integrators
+#---------------------------------------------
+pe_integloop.getIntegrator( trick.Euler, 13 )
+de_integloop.getIntegrator( trick.Euler, 13 )
+
+
+# =========================================================================
+# Set up the HLA interfaces.
+# =========================================================================
+# Instantiate the Python SpaceFOM configuration object.
+federate = SpaceFOMFederateConfig( THLA.federate,
+                                   THLA.manager,
+                                   THLA.execution_control,
+                                   THLA.ExCO,
+                                   federation_name,
+                                   federate_name,
+                                   True )
+
+# Set the debug output level.
+if (verbose == True) :
+   federate.set_debug_level( trick.TrickHLA.DEBUG_LEVEL_6_TRACE )
+   federate.set_debug_source( trick.TrickHLA.DEBUG_SOURCE_ALL_MODULES )
+else :
+   federate.set_debug_level( trick.TrickHLA.DEBUG_LEVEL_0_TRACE )
+
+#--------------------------------------------------------------------------
+# Configure this federate SpaceFOM roles for this federate.
+#--------------------------------------------------------------------------
+federate.set_master_role( False ) # This is NOT the Master federate.
+federate.set_pacing_role( False ) # This is NOT the Pacing federate.
+federate.set_RRFP_role( False )   # This is NOT the Root Reference Frame Publisher.
+
+#--------------------------------------------------------------------------
+# Add in known required federates.
+#--------------------------------------------------------------------------
+federate.add_known_federate( True, str(federate.federate.name) )
+federate.add_known_federate( True, 'MPR' )
+
+#--------------------------------------------------------------------------
+# Configure the CRC.
+#--------------------------------------------------------------------------
+# Pitch specific local settings designator:
+THLA.federate.local_settings = 'crcHost = localhost\n crcPort = 8989'
+
+#--------------------------------------------------------------------------
+# Set up federate related time related parameters.
+#--------------------------------------------------------------------------
+# Must specify a federate HLA lookahead value in seconds.
+federate.set_lookahead_time( 0.250 )
+
+# For SpaceFOM, we also need to specify the Trick software frame time.
+trick.exec_set_software_frame( 0.250 )
+
+# Setup Time Management parameters.
+federate.set_time_regulating( True )
+federate.set_time_constrained( True )
+
+
+#---------------------------------------------------------------------------
+# Set up the Root Reference Frame object for discovery.
+#---------------------------------------------------------------------------
+root_frame = SpaceFOMRefFrameObject( federate.is_RRFP,
+                                     'RootFrame',
+                                     root_ref_frame.frame_packing,
+                                     'root_ref_frame.frame_packing',
+                                     frame_conditional = root_ref_frame.conditional )
+
+# Set the debug flag for the root reference frame.
+root_ref_frame.frame_packing.debug = verbose
+
+# Set the root frame for the federate.
+federate.set_root_frame( root_frame )
+
+
+#---------------------------------------------------------------------------
+# Set up the object templates. An object is instantiated from a template
+# for each discovered PhysicalEntity, DynamicalEntity or ReferenceFrame
+# instance, other than the root frame, up to the pool size. The S_define
+# entity and frame objects serve as the prototypes, and each instance takes
+# the settings of its lag compensation prototype.
+#---------------------------------------------------------------------------
+physical_entity.entity_packing.set_name( 'PhysicalEntityPrototype' )
+physical_entity.lag_compensation.debug = verbose
+physical_entity.lag_compensation.set_integ_tolerance( 1.0e-6 )
+physical_entity.lag_compensation.set_integ_dt( 0.025 )
+
+dynamical_entity.entity_packing.set_name( 'DynamicalEntityPrototype' )
+dynamical_entity.lag_compensation.debug = verbose
+dynamical_entity.lag_compensation.set_integ_tolerance( 1.0e-6 )
+dynamical_entity.lag_compensation.set_integ_dt( 0.025 )
+
+ref_frame_A.frame_packing.set_name( 'RefFramePrototype' )
+ref_frame_A.frame_packing.set_parent_name( 'RootFrame' )
+ref_frame_A.frame_packing.debug = verbose
+ref_frame_A.lag_compensation.debug = verbose
+ref_frame_A.lag_compensation.set_integ_tolerance( 1.0e-6 )
+ref_frame_A.lag_compensation.set_integ_dt( 0.025 )
+
+templates = SpaceFOMObjectTemplates( THLA.manager )
+
+templates.add_physical_entity_template( 'mirror_pe',
+                                        pool_size,
+                                        physical_entity.entity_packing,
+                                        physical_entity.lag_compensation,
+                                        trick.TrickHLA.LAG_COMPENSATION_RECEIVE_SIDE )
+
+templates.add_dynamical_entity_template( 'mirror_de',
+                                         pool_size,
+                                         dynamical_entity.entity_packing,
+                                         dynamical_entity.lag_compensation,
+                                         trick.TrickHLA.LAG_COMPENSATION_RECEIVE_SIDE )
+
+templates.add_ref_frame_template( 'mirror_frame',
+                                  pool_size,
+                                  ref_frame_A.frame_packing,
+                                  ref_frame_A.lag_compensation,
+                                  trick.TrickHLA.LAG_COMPENSATION_RECEIVE_SIDE )
+
+# The templates must be configured before the federate is initialized,
+# which allocates room for the template pools in the manager objects.
+templates.initialize()
+
+
+#---------------------------------------------------------------------------
+# Add the HLA SimObjects associated with this federate.
+#---------------------------------------------------------------------------
+federate.add_sim_object( THLA )
+federate.add_sim_object( THLA_INIT )
+federate.add_sim_object( root_ref_frame )
+
+
+#---------------------------------------------------------------------------
+# Make sure that the Python federate configuration object is initialized.
+#---------------------------------------------------------------------------
+federate.initialize()
+
+
+#---------------------------------------------------------------------------
+# Set up simulation termination time.
+#---------------------------------------------------------------------------
+if run_duration:
+   trick.sim_services.exec_set_terminate_time( run_duration )
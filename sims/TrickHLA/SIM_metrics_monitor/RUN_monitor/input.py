@@ -0,0 +1,93 @@
+##############################################################################
+# PURPOSE:
+#    (This is a Python input file for configuring a federate that monitors
+#     the performance metrics published by the other federates, such as the
+#     RUN_publisher federate.)
+#
+# PROGRAMMERS:
+#    (((TrickHLA Team) (NASA/ER6) (Oct 2026) (--) (Initial version.)))
+##############################################################################
+import sys
+sys.path.append('../../../')
+
+# Load the TrickHLA federate performance metrics object configuration.
+from Modified_data.TrickHLA.TrickHLAFederateMetricsObject import *
+
+#---------------------------------------------
+# Set up Trick executive parameters.
+#---------------------------------------------
+#instruments.echo_jobs.echo_jobs_on()
+trick.exec_set_trap_sigfpe(True)
+
+# Realtime setup
+trick.real_time_enable()
+trick.exec_set_software_frame(0.25)
+trick.exec_set_enable_freeze(True)
+trick.exec_set_freeze_command(True)
+trick.sim_control_panel_set_enabled(False)
+trick.exec_set_stack_trace(False)
+
+run_duration = 15.0
+
+#---------------------------------------------
+# Configure the metrics monitor.
+#---------------------------------------------
+THLA_MONITOR.monitor.print_table  = True
+THLA_MONITOR.monitor.record_file  = 'federate_metrics.csv'
+THLA_MONITOR.monitor.stale_period = 5.0
+
+
+# =========================================================================
+# Set up HLA interoperability.
+# =========================================================================
+# Show or hide the TrickHLA debug messages.
+THLA.federate.debug_level = trick.DEBUG_LEVEL_1_TRACE
+
+# Configure the CRC.
+# Pitch specific local settings designator:
+THLA.federate.local_settings = 'crcHost = localhost\n crcPort = 8989'
+THLA.federate.lookahead_time = 0.250
+
+# Configure the federate. The monitor does not regulate or constrain the
+# federation time advancement, so the metrics are received in receive order.
+THLA.federate.name             = 'Metrics-Monitor-Federate'
+THLA.federate.FOM_modules      = 'FOMs/S_FOMfile.xml,FOMs/TrickHLAFreezeInteraction.xml,FOMs/TrickHLA/TrickHLAFederateMetrics.xml'
+THLA.federate.federation_name  = 'MetricsMonitorSim'
+THLA.federate.time_regulating  = False
+THLA.federate.time_constrained = False
+
+# Configure ExecutionControl.
+# Set the multiphase initialization synchronization points.
+THLA.execution_control.multiphase_init_sync_points = 'Phase1, Phase2'
+# Set the simulation timeline to be used for time computations.
+THLA.execution_control.sim_timeline = THLA_INIT.sim_timeline
+# Set the scenario timeline to be used for configuring federation freeze times.
+THLA.execution_control.scenario_timeline = THLA_INIT.scenario_timeline
+
+# The monitor is not required by the other federates, so it does not wait
+# for any known federates either.
+THLA.federate.enable_known_feds = False
+
+
+#---------------------------------------------
+# Set up for simulation configuration.
+#---------------------------------------------
+THLA.simple_sim_config.owner        = 'Metrics-Publisher-Federate'
+THLA.simple_sim_config.run_duration = run_duration
+
+
+# The monitor has no configured objects, instead an object is instantiated
+# from the object template for the metrics of each discovered federate.
+configure_federate_metrics_template( THLA.manager,
+                                     'THLA_MONITOR_metrics',
+                                     16,
+                                     THLA_MONITOR.metrics_prototype )
+
+THLA.manager.obj_count = 0
+THLA.manager.objects   = trick.sim_services.alloc_type( THLA.manager.get_object_template_pool_size(), 'TrickHLA::Object' )
+
+
+#---------------------------------------------
+# Set up simulation termination time.
+#---------------------------------------------
+trick.sim_services.exec_set_terminate_time( run_duration )
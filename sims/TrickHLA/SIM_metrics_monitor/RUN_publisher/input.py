@@ -0,0 +1,93 @@
+##############################################################################
+# PURPOSE:
+#    (This is a Python input file for configuring a federate that publishes
+#     its performance metrics for the RUN_monitor federate to display.)
+#
+# PROGRAMMERS:
+#    (((TrickHLA Team) (NASA/ER6) (Oct 2026) (--) (Initial version.)))
+##############################################################################
+import sys
+sys.path.append('../../../')
+
+# Load the TrickHLA federate performance metrics object configuration.
+from Modified_data.TrickHLA.TrickHLAFederateMetricsObject import *
+
+#---------------------------------------------
+# Set up Trick executive parameters.
+#---------------------------------------------
+#instruments.echo_jobs.echo_jobs_on()
+trick.exec_set_trap_sigfpe(True)
+
+# Realtime setup
+trick.real_time_enable()
+trick.exec_set_software_frame(0.25)
+trick.exec_set_enable_freeze(True)
+trick.exec_set_freeze_command(True)
+trick.sim_control_panel_set_enabled(False)
+trick.exec_set_stack_trace(False)
+
+run_duration = 15.0
+
+#---------------------------------------------
+# This federate only publishes its metrics, so do not print the table.
+#---------------------------------------------
+THLA_MONITOR.monitor.print_table = False
+
+
+# =========================================================================
+# Set up HLA interoperability.
+# =========================================================================
+# Show or hide the TrickHLA debug messages.
+THLA.federate.debug_level = trick.DEBUG_LEVEL_1_TRACE
+
+# Configure the CRC.
+# Pitch specific local settings designator:
+THLA.federate.local_settings = 'crcHost = localhost\n crcPort = 8989'
+THLA.federate.lookahead_time = 0.250
+
+# Configure the federate.
+THLA.federate.name             = 'Metrics-Publisher-Federate'
+THLA.federate.FOM_modules      = 'FOMs/S_FOMfile.xml,FOMs/TrickHLAFreezeInteraction.xml,FOMs/TrickHLA/TrickHLAFederateMetrics.xml'
+THLA.federate.federation_name  = 'MetricsMonitorSim'
+THLA.federate.time_regulating  = True
+THLA.federate.time_constrained = True
+
+# Configure ExecutionControl.
+# Set the multiphase initialization synchronization points.
+THLA.execution_control.multiphase_init_sync_points = 'Phase1, Phase2'
+# Set the simulation timeline to be used for time computations.
+THLA.execution_control.sim_timeline = THLA_INIT.sim_timeline
+# Set the scenario timeline to be used for configuring federation freeze times.
+THLA.execution_control.scenario_timeline = THLA_INIT.scenario_timeline
+
+# The monitor is optional, so only this federate is required.
+THLA.federate.enable_known_feds      = True
+THLA.federate.known_feds_count       = 1
+THLA.federate.known_feds             = trick.sim_services.alloc_type( THLA.federate.known_feds_count, 'TrickHLA::KnownFederate' )
+THLA.federate.known_feds[0].name     = 'Metrics-Publisher-Federate'
+THLA.federate.known_feds[0].required = True
+
+
+#---------------------------------------------
+# Set up for simulation configuration.
+#---------------------------------------------
+THLA.simple_sim_config.owner        = 'Metrics-Publisher-Federate'
+THLA.simple_sim_config.run_duration = run_duration
+
+
+# The Federate has one object, which publishes its performance metrics.
+THLA.manager.obj_count = 1
+THLA.manager.objects   = trick.sim_services.alloc_type( THLA.manager.obj_count, 'TrickHLA::Object' )
+
+metrics_object = TrickHLAFederateMetricsObject( True,
+                                                'Metrics-Publisher-Federate.Metrics',
+                                                THLA_METRICS.metrics,
+                                                'THLA_METRICS.metrics',
+                                                THLA.manager.objects[0] )
+metrics_object.initialize( THLA.manager.objects[0] )
+
+
+#---------------------------------------------
+# Set up simulation termination time.
+#---------------------------------------------
+trick.sim_services.exec_set_terminate_time( run_duration )
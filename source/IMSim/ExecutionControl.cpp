@@ -20,6 +20,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../TrickHLA/Federate.cpp}
 @trick_link_dependency{../TrickHLA/Int64BaseTime.cpp}
 @trick_link_dependency{../TrickHLA/Manager.cpp}
+@trick_link_dependency{../TrickHLA/MutexProtection.cpp}
 @trick_link_dependency{../TrickHLA/SleepTimeout.cpp}
 @trick_link_dependency{../TrickHLA/Types.cpp}
 @trick_link_dependency{../TrickHLA/Utilities.cpp}
@@ -54,6 +55,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Federate.hh"
 #include "TrickHLA/Int64BaseTime.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Parameter.hh"
 #include "TrickHLA/SleepTimeout.hh"
 #include "TrickHLA/StringUtilities.hh"
@@ -1210,8 +1212,16 @@ void ExecutionControl::wait_for_all_multiphase_init_sync_points()
             // Always check to see is a shutdown was received.
             federate->check_for_shutdown_with_termination();
 
-            // Pause and release the processor for short sleep value.
-            sleep_timer.sleep();
+            // Wait for a sync-point state change, which releases the
+            // processor until the FedAmb callback arrives or a short wait.
+            {
+               // When auto_unlock_mutex goes out of scope it automatically
+               // unlocks the mutex even if there is an exception.
+               MutexProtection auto_unlock_mutex( &mutex );
+               if ( !sp->is_achieved() ) {
+                  wait_for_sync_point_state_change();
+               }
+            }
 
             // Periodically check to make sure the federate is still part of
             // the federation execution.
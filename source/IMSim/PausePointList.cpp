@@ -93,6 +93,7 @@ bool PausePointList::clear_sync_point(
                this->state         = PAUSE_POINT_STATE_RECONFIG;
             }
 
+            erase_sync_point_label( sp );
             sync_point_list.erase( i );
             delete sp;
             i = sync_point_list.end();
@@ -56,6 +56,7 @@ NASA, Johnson Space Center\n
 
 // SpaceFOM include files.
 #include "JEOD/JEODRefFrameState.hh"
+#include "SpaceFOM/QuaternionData.hh"
 
 using namespace std;
 using namespace SpaceFOM;
@@ -68,8 +69,18 @@ using namespace SpaceFOM;
  */
 JEODRefFrameState::JEODRefFrameState()
    : RefFrameBase(),
+     send_changes_only( false ),
+     position_tolerance( 0.0 ),
+     attitude_tolerance( 0.0 ),
+     max_send_interval( 0.0 ),
+     skipped_pack_count( 0 ),
      time_tt( NULL ),
-     ref_frame_state( NULL )
+     ref_frame_state( NULL ),
+     state_version( 0 ),
+     sent_version( 0 ),
+     state_sent( false ),
+     observed_state(),
+     sent_state()
 {
    return;
 }
@@ -81,8 +92,18 @@ JEODRefFrameState::JEODRefFrameState(
    jeod::TimeTT        &time_tt_in,
    jeod::RefFrameState &ref_frame_state_ref )
    : RefFrameBase(),
+     send_changes_only( false ),
+     position_tolerance( 0.0 ),
+     attitude_tolerance( 0.0 ),
+     max_send_interval( 0.0 ),
+     skipped_pack_count( 0 ),
      time_tt( &time_tt_in ),
-     ref_frame_state( &ref_frame_state_ref )
+     ref_frame_state( &ref_frame_state_ref ),
+     state_version( 0 ),
+     sent_version( 0 ),
+     state_sent( false ),
+     observed_state(),
+     sent_state()
 {
    return;
 }
@@ -272,3 +293,156 @@ void JEODRefFrameState::unpack_into_working_data()
 
    return;
 }
+
+/*!
+ * @job_class{scheduled}
+ */
+void JEODRefFrameState::pack()
+{
+   // Track the JEOD state version so we know if the state has changed.
+   update_state_version();
+
+   if ( send_changes_only
+        && ( state_attr != NULL )
+        && is_attribute_in_mask( state_attr )
+        && !state_attr->is_update_requested()
+        && !is_send_due() ) {
+
+      // Keep the last sent state in the packing data so that the conditional
+      // sees no change, and skip the encode since the buffer already holds
+      // the last sent state.
+      packing_data.state = sent_state;
+      ++skipped_pack_count;
+      return;
+   }
+
+   // Pack and encode the data.
+   RefFrameBase::pack();
+
+   if ( ( state_attr != NULL ) && is_attribute_in_mask( state_attr ) ) {
+      sent_state   = packing_data.state;
+      sent_version = state_version;
+      state_sent   = true;
+   }
+
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void JEODRefFrameState::update_from_jeod(
+   jeod::RefFrame *target_frame,
+   jeod::RefFrame *parent_frame )
+{
+   // A root reference frame has no parent to compute the state against.
+   if ( ( target_frame != NULL ) && ( parent_frame != NULL ) ) {
+      target_frame->compute_relative_state( *parent_frame, *ref_frame_state );
+   }
+
+   // Set the time tag for this reference frame state.
+   set_time( time_tt->trunc_julian_time * 86400.0 );
+
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool const JEODRefFrameState::update_state_version()
+{
+   bool changed = false;
+
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      if ( ( observed_state.pos[iinc] != ref_frame_state->trans.position[iinc] )
+           || ( observed_state.vel[iinc] != ref_frame_state->trans.velocity[iinc] )
+           || ( observed_state.att.vector[iinc] != ref_frame_state->rot.Q_parent_this.vector[iinc] )
+           || ( observed_state.ang_vel[iinc] != ref_frame_state->rot.ang_vel_this[iinc] ) ) {
+         changed = true;
+         break;
+      }
+   }
+   if ( observed_state.att.scalar != ref_frame_state->rot.Q_parent_this.scalar ) {
+      changed = true;
+   }
+
+   if ( changed ) {
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         observed_state.pos[iinc]        = ref_frame_state->trans.position[iinc];
+         observed_state.vel[iinc]        = ref_frame_state->trans.velocity[iinc];
+         observed_state.att.vector[iinc] = ref_frame_state->rot.Q_parent_this.vector[iinc];
+         observed_state.ang_vel[iinc]    = ref_frame_state->rot.ang_vel_this[iinc];
+      }
+      observed_state.att.scalar = ref_frame_state->rot.Q_parent_this.scalar;
+      ++state_version;
+   }
+
+   return changed;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool const JEODRefFrameState::is_send_due()
+{
+   // Always send the first state.
+   if ( !state_sent ) {
+      return true;
+   }
+
+   // Time since the last send, which is what a receiver extrapolates over.
+   double const dt = get_scenario_time() - sent_state.time;
+
+   if ( ( max_send_interval > 0.0 ) && ( dt >= max_send_interval ) ) {
+      return true;
+   }
+
+   // Nothing to send if the state has not changed since the last send.
+   if ( state_version == sent_version ) {
+      return false;
+   }
+
+   // Position error of the linear extrapolation of the last sent state.
+   double pos_err_sq = 0.0;
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      double const err = observed_state.pos[iinc]
+                         - ( sent_state.pos[iinc] + ( sent_state.vel[iinc] * dt ) );
+      pos_err_sq += err * err;
+   }
+   if ( sqrt( pos_err_sq ) > position_tolerance ) {
+      return true;
+   }
+
+   // Attitude error of the first order extrapolation of the last sent
+   // attitude, using the same quaternion rate as the lag compensation.
+   QuaternionData q_dot;
+   q_dot.derivative_first( sent_state.att, sent_state.ang_vel );
+
+   QuaternionData q_pred;
+   q_pred.scalar = sent_state.att.scalar + ( q_dot.scalar * dt );
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      q_pred.vector[iinc] = sent_state.att.vector[iinc] + ( q_dot.vector[iinc] * dt );
+   }
+   q_pred.normalize();
+
+   double q_dot_product = q_pred.scalar * observed_state.att.scalar;
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      q_dot_product += q_pred.vector[iinc] * observed_state.att.vector[iinc];
+   }
+   q_dot_product = fabs( q_dot_product );
+   if ( q_dot_product > 1.0 ) {
+      q_dot_product = 1.0;
+   }
+   if ( ( 2.0 * acos( q_dot_product ) ) > attitude_tolerance ) {
+      return true;
+   }
+
+   // An angular velocity change is not visible in the attitude until later,
+   // so send it once it changes beyond the attitude tolerance per second.
+   double ang_vel_err_sq = 0.0;
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      double const err = observed_state.ang_vel[iinc] - sent_state.ang_vel[iinc];
+      ang_vel_err_sq += err * err;
+   }
+   return ( sqrt( ang_vel_err_sq ) > attitude_tolerance );
+}
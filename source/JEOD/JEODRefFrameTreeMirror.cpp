@@ -0,0 +1,196 @@
+/*!
+@file JEOD/JEODRefFrameTreeMirror.cpp
+@ingroup JEOD
+@brief This class mirrors a JEOD reference frame tree into a set of SpaceFOM
+Reference Frames.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{JEODRefFrameState.cpp}
+@trick_link_dependency{JEODRefFrameTreeMirror.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA model include files.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Types.hh"
+
+// SpaceFOM include files.
+#include "JEOD/JEODRefFrameState.hh"
+#include "JEOD/JEODRefFrameTreeMirror.hh"
+
+using namespace std;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+JEODRefFrameTreeMirror::JEODRefFrameTreeMirror()
+   : debug( false ),
+     send_changes_only( true ),
+     position_tolerance( 0.0 ),
+     attitude_tolerance( 0.0 ),
+     max_send_interval( 0.0 ),
+     built( false ),
+     root_frame( NULL ),
+     frames(),
+     jeod_frame_names(),
+     jeod_frames(),
+     jeod_parents()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+JEODRefFrameTreeMirror::~JEODRefFrameTreeMirror()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+bool JEODRefFrameTreeMirror::add_frame(
+   JEODRefFrameState *frame_ptr,
+   char const        *jeod_frame_name )
+{
+   if ( built ) {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::JEODRefFrameTreeMirror::add_frame():" << __LINE__
+             << " ERROR: The build() function has already been called" << THLA_ENDL;
+      // Print message and terminate.
+      TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( ( frame_ptr == NULL ) || ( jeod_frame_name == NULL ) || ( *jeod_frame_name == '\0' ) ) {
+      send_hs( stderr, "SpaceFOM::JEODRefFrameTreeMirror::add_frame():%d WARNING: Ignoring a NULL reference frame or JEOD frame name.%c",
+               __LINE__, THLA_NEWLINE );
+      return ( false );
+   }
+
+   frames.push_back( frame_ptr );
+   jeod_frame_names.push_back( string( jeod_frame_name ) );
+   jeod_frames.push_back( NULL );
+   jeod_parents.push_back( NULL );
+
+   return ( true );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void JEODRefFrameTreeMirror::build(
+   jeod::DynManager &dyn_manager )
+{
+   // Find and subscribe to the JEOD reference frames so that JEOD keeps
+   // their states up to date.
+   for ( unsigned int i = 0; i < frames.size(); ++i ) {
+      jeod_frames[i] = dyn_manager.find_ref_frame( jeod_frame_names[i].c_str() );
+      if ( jeod_frames[i] == NULL ) {
+         ostringstream errmsg;
+         errmsg << "SpaceFOM::JEODRefFrameTreeMirror::build():" << __LINE__
+                << " ERROR: Unexpected NULL JEOD reference frame: "
+                << jeod_frame_names[i] << THLA_ENDL;
+         // Print message and terminate.
+         TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+      }
+      jeod_frames[i]->subscribe();
+   }
+
+   // The SpaceFOM parent of each frame is the nearest JEOD ancestor that is
+   // also mirrored, and the frame without a mirrored ancestor is the root.
+   root_frame = NULL;
+   for ( unsigned int i = 0; i < frames.size(); ++i ) {
+
+      int parent_index = -1;
+
+      jeod::RefFrame const *ancestor = jeod_frames[i]->get_parent();
+      while ( ( ancestor != NULL ) && ( parent_index < 0 ) ) {
+         for ( unsigned int j = 0; j < frames.size(); ++j ) {
+            if ( ( j != i ) && ( jeod_frames[j] == ancestor ) ) {
+               parent_index = j;
+               break;
+            }
+         }
+         ancestor = ancestor->get_parent();
+      }
+
+      if ( parent_index >= 0 ) {
+         jeod_parents[i] = jeod_frames[parent_index];
+         frames[i]->set_parent_frame( frames[parent_index] );
+      } else {
+         if ( root_frame != NULL ) {
+            ostringstream errmsg;
+            errmsg << "SpaceFOM::JEODRefFrameTreeMirror::build():" << __LINE__
+                   << " ERROR: JEOD reference frames '" << jeod_frame_names[i]
+                   << "' and '" << root_frame->get_name()
+                   << "' do not have a common mirrored ancestor!" << THLA_ENDL;
+            // Print message and terminate.
+            TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+         }
+         jeod_parents[i] = NULL;
+         frames[i]->set_parent_frame( NULL );
+         frames[i]->set_parent_name( "" );
+         root_frame = frames[i];
+      }
+
+      // Only pack and send the frames that change.
+      frames[i]->send_changes_only  = send_changes_only;
+      frames[i]->position_tolerance = position_tolerance;
+      frames[i]->attitude_tolerance = attitude_tolerance;
+      frames[i]->max_send_interval  = max_send_interval;
+
+      if ( debug ) {
+         cout << "SpaceFOM::JEODRefFrameTreeMirror::build():" << __LINE__
+              << " JEOD frame '" << jeod_frame_names[i] << "' mirrored as '"
+              << ( ( frames[i]->get_name() != NULL ) ? frames[i]->get_name() : "" )
+              << "' with parent '"
+              << ( ( frames[i]->get_parent_name() != NULL ) ? frames[i]->get_parent_name() : "" )
+              << "'" << endl;
+      }
+   }
+
+   built = true;
+
+   // Compute the initial frame states.
+   update();
+
+   return;
+}
+
+/*!
+ * @job_class{environment}
+ */
+void JEODRefFrameTreeMirror::update()
+{
+   for ( unsigned int i = 0; i < frames.size(); ++i ) {
+      frames[i]->update_from_jeod( jeod_frames[i], jeod_parents[i] );
+   }
+   return;
+}
@@ -43,6 +43,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Attribute.hh"
 #include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Packing.hh"
 #include "TrickHLA/Types.hh"
 
 // SpaceFOM include files.
@@ -119,6 +120,44 @@ void DynamicalEntityLagComp::initialize()
    return;
 }
 
+/*!
+ * @details From the TrickHLA::LagCompensation class. The lag compensation
+ * instance is bound to the DynamicalEntity packing instance created for the same
+ * templated object and takes the integration settings of this prototype.
+ *
+ * @job_class{initialization}
+ */
+TrickHLA::LagCompensation *DynamicalEntityLagComp::create_template_instance(
+   char const        *instance_name,
+   TrickHLA::Packing *inst_packing )
+{
+   DynamicalEntityBase *inst_entity = dynamic_cast< DynamicalEntityBase * >( inst_packing );
+   if ( inst_entity == NULL ) {
+      send_hs( stderr, "SpaceFOM::DynamicalEntityLagComp::create_template_instance():%d ERROR: The packing for '%s' is not a SpaceFOM::DynamicalEntityBase!%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      return NULL;
+   }
+
+   // There is no default constructor, so construct the instance bound to the
+   // packing and then register it with the Trick Memory Manager by name.
+   DynamicalEntityLagComp *inst = new DynamicalEntityLagComp( *inst_entity );
+
+   string const decl_str = string( "SpaceFOM::DynamicalEntityLagComp " ) + instance_name;
+   if ( trick_MM->declare_extern_var( inst, decl_str.c_str() ) == NULL ) {
+      send_hs( stderr, "SpaceFOM::DynamicalEntityLagComp::create_template_instance():%d ERROR allocating Trick Memory for '%s'%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      delete inst;
+      return NULL;
+   }
+
+   inst->debug = this->debug;
+   inst->set_integ_dt( this->integ_dt );
+   inst->set_integ_tolerance( this->integ_tol );
+   inst->initialize();
+
+   return inst;
+}
+
 /*!
  * @job_class{integration}
  */
@@ -23,6 +23,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../TrickHLA/Int64Time.cpp}
 @trick_link_dependency{../TrickHLA/InteractionItem.cpp}
 @trick_link_dependency{../TrickHLA/Manager.cpp}
+@trick_link_dependency{../TrickHLA/MutexProtection.cpp}
 @trick_link_dependency{../TrickHLA/Parameter.cpp}
 @trick_link_dependency{../TrickHLA/SleepTimeout.cpp}
 @trick_link_dependency{../TrickHLA/Types.cpp}
@@ -63,6 +64,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Int64Time.hh"
 #include "TrickHLA/InteractionItem.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Parameter.hh"
 #include "TrickHLA/SleepTimeout.hh"
 #include "TrickHLA/StringUtilities.hh"
@@ -755,8 +757,14 @@ void ExecutionControl::role_determination_process()
             // Check for shutdown.
             federate->check_for_shutdown_with_termination();
 
-            // Short sleep to release process and not hog CPU.
-            sleep_timer.sleep();
+            // Wait for a sync-point state change, or a short wait, to give
+            // the sync-points time to come in and not hog CPU.
+            {
+               // When auto_unlock_mutex goes out of scope it automatically
+               // unlocks the mutex even if there is an exception.
+               MutexProtection auto_unlock_mutex( &mutex );
+               wait_for_sync_point_state_change();
+            }
 
             // Periodically check if we are still an execution member and
             // display sync-point status if needed as well.
@@ -2170,29 +2178,7 @@ bool ExecutionControl::run_mode_transition()
          }
 
          // Wait for the CTE go-to-run time.
-         double diff;
-         while ( this->get_cte_time() < go_to_run_time ) {
-
-            // Check for shutdown.
-            federate->check_for_shutdown_with_termination();
-
-            diff = go_to_run_time - this->get_cte_time();
-            if ( fmod( diff, 1.0 ) == 0.0 ) {
-               if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_EXECUTION_CONTROL ) ) {
-                  send_hs( stdout, "SpaceFOM::ExecutionControl::run_mode_transition():%d Going to run in %G seconds.%c",
-                           __LINE__, diff, THLA_NEWLINE );
-               }
-            }
-         }
-
-         // Print debug message if appropriate.
-         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_EXECUTION_CONTROL ) ) {
-            double curr_cte_time = this->get_cte_time();
-
-            diff = curr_cte_time - go_to_run_time;
-            send_hs( stdout, "SpaceFOM::ExecutionControl::run_mode_transition():%d \n  Going to run at CTE time %.18G seconds. \n  Current CTE time %.18G seconds. \n  Difference: %.9lf seconds.%c",
-                     __LINE__, go_to_run_time, curr_cte_time, diff, THLA_NEWLINE );
-         }
+         this->record_mode_transition_error( this->wait_for_cte_time( go_to_run_time, "run" ) );
       }
    }
    return true;
@@ -2232,6 +2218,13 @@ bool ExecutionControl::freeze_mode_transition()
       // Wait for 'mtr_freeze' sync-point synchronization.
       this->wait_for_synchronization( federate, sync_pnt );
 
+      // Enter freeze at the CTE freeze time the Master federate set. The
+      // recorded error only measures this federate's wait, not the skew.
+      if ( this->does_cte_timeline_exist()
+           && ( ExCO->get_next_execution_mode() == EXECUTION_MODE_FREEZE ) ) {
+         this->record_freeze_transition_error( this->wait_for_cte_time( ExCO->get_next_mode_cte_time(), "freeze" ) );
+      }
+
       // Set the current execution mode to freeze.
       this->current_execution_control_mode = EXECUTION_CONTROL_FREEZE;
       ExCO->set_current_execution_mode( EXECUTION_MODE_FREEZE );
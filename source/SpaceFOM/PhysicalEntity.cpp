@@ -129,6 +129,48 @@ void PhysicalEntity::initialize()
    return;
 }
 
+/*!
+ * @details From the TrickHLA::Packing class. The packing instance and its
+ * PhysicalEntity data are allocated as named Trick variables so that the
+ * object template attribute trick_names, which are relative to the packing
+ * instance, can be resolved.
+ *
+ * @job_class{initialization}
+ */
+TrickHLA::Packing *PhysicalEntity::create_template_instance(
+   char const *instance_name )
+{
+   string decl_str = string( "SpaceFOM::PhysicalEntity " ) + instance_name;
+
+   PhysicalEntity *inst = static_cast< PhysicalEntity * >( trick_MM->declare_var( decl_str.c_str() ) );
+   if ( inst == NULL ) {
+      send_hs( stderr, "SpaceFOM::PhysicalEntity::create_template_instance():%d ERROR allocating Trick Memory for '%s'%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      return NULL;
+   }
+
+   decl_str = string( "SpaceFOM::PhysicalEntityData " ) + instance_name + "_data";
+
+   PhysicalEntityData *inst_data = static_cast< PhysicalEntityData * >( trick_MM->declare_var( decl_str.c_str() ) );
+   if ( inst_data == NULL ) {
+      send_hs( stderr, "SpaceFOM::PhysicalEntity::create_template_instance():%d ERROR allocating Trick Memory for '%s_data'%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      return NULL;
+   }
+
+   // The entity name, type, status and parent frame are received from the
+   // owning federate, so start with empty strings.
+   inst->pe_packing_data.name         = trick_MM->mm_strdup( "" );
+   inst->pe_packing_data.type         = trick_MM->mm_strdup( "" );
+   inst->pe_packing_data.status       = trick_MM->mm_strdup( "" );
+   inst->pe_packing_data.parent_frame = trick_MM->mm_strdup( "" );
+
+   inst->configure( inst_data );
+   inst->initialize();
+
+   return inst;
+}
+
 /*!
  * @job_class{scheduled}
  */
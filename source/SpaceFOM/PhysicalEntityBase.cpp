@@ -488,6 +488,11 @@ void PhysicalEntityBase::pack()
                __LINE__, THLA_NEWLINE );
    }
 
+   // Nothing to pack if none of the attributes are due to be sent.
+   if ( attr_mask == 0 ) {
+      return;
+   }
+
    // Check for latency/lag compensation.
    if ( this->object->lag_comp == NULL ) {
       this->pack_from_working_data();
@@ -499,9 +504,14 @@ void PhysicalEntityBase::pack()
       this->debug_print( cout );
    }
 
-   // Encode the data into the buffer.
-   stc_encoder.encode();
-   quat_encoder.encode();
+   // Encode the data into the buffer, but only for the attributes that are
+   // due to be sent.
+   if ( is_attribute_in_mask( state_attr ) ) {
+      stc_encoder.encode();
+   }
+   if ( is_attribute_in_mask( body_frame_attr ) ) {
+      quat_encoder.encode();
+   }
 
    return;
 }
@@ -518,9 +528,14 @@ void PhysicalEntityBase::unpack()
                __LINE__, THLA_NEWLINE );
    }
 
-   // Use the HLA encoder helpers to decode the PhysicalEntity fixed record.
-   stc_encoder.decode();
-   quat_encoder.decode();
+   // Use the HLA encoder helpers to decode the PhysicalEntity fixed record,
+   // but only for the attributes that were received.
+   if ( is_attribute_in_mask( state_attr ) ) {
+      stc_encoder.decode();
+   }
+   if ( is_attribute_in_mask( body_frame_attr ) ) {
+      quat_encoder.decode();
+   }
 
    // Transfer the packing data into the working data.
    this->unpack_into_working_data();
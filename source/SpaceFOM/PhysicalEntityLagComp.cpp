@@ -43,6 +43,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Attribute.hh"
 #include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Packing.hh"
 #include "TrickHLA/Types.hh"
 
 // SpaceFOM include files.
@@ -119,6 +120,44 @@ void PhysicalEntityLagComp::initialize()
    return;
 }
 
+/*!
+ * @details From the TrickHLA::LagCompensation class. The lag compensation
+ * instance is bound to the PhysicalEntity packing instance created for the same
+ * templated object and takes the integration settings of this prototype.
+ *
+ * @job_class{initialization}
+ */
+TrickHLA::LagCompensation *PhysicalEntityLagComp::create_template_instance(
+   char const        *instance_name,
+   TrickHLA::Packing *inst_packing )
+{
+   PhysicalEntityBase *inst_entity = dynamic_cast< PhysicalEntityBase * >( inst_packing );
+   if ( inst_entity == NULL ) {
+      send_hs( stderr, "SpaceFOM::PhysicalEntityLagComp::create_template_instance():%d ERROR: The packing for '%s' is not a SpaceFOM::PhysicalEntityBase!%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      return NULL;
+   }
+
+   // There is no default constructor, so construct the instance bound to the
+   // packing and then register it with the Trick Memory Manager by name.
+   PhysicalEntityLagComp *inst = new PhysicalEntityLagComp( *inst_entity );
+
+   string const decl_str = string( "SpaceFOM::PhysicalEntityLagComp " ) + instance_name;
+   if ( trick_MM->declare_extern_var( inst, decl_str.c_str() ) == NULL ) {
+      send_hs( stderr, "SpaceFOM::PhysicalEntityLagComp::create_template_instance():%d ERROR allocating Trick Memory for '%s'%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      delete inst;
+      return NULL;
+   }
+
+   inst->debug = this->debug;
+   inst->set_integ_dt( this->integ_dt );
+   inst->set_integ_tolerance( this->integ_tol );
+   inst->initialize();
+
+   return inst;
+}
+
 /*!
  * @job_class{integration}
  */
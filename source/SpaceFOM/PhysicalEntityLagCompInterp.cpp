@@ -0,0 +1,398 @@
+/*!
+@file SpaceFOM/PhysicalEntityLagCompInterp.cpp
+@ingroup SpaceFOM
+@brief This class provides the implementation for a TrickHLA SpaceFOM
+PhysicalEntity latency/lag compensation class that interpolates a history of
+received states.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{PhysicalEntityLagCompInterp.cpp}
+@trick_link_dependency{QuaternionData.cpp}
+@trick_link_dependency{SpaceTimeCoordinateData.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/MemoryManager.hh"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h" // for send_hs
+
+// TrickHLA include files.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Packing.hh"
+#include "TrickHLA/Types.hh"
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalEntityLagCompInterp.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+PhysicalEntityLagCompInterp::PhysicalEntityLagCompInterp( PhysicalEntityBase &entity_ref ) // RETURN: -- None.
+   : PhysicalEntityLagCompBase( entity_ref ),
+     history_size( 8 ),
+     interp_delay( -1.0 ),
+     history( NULL ),
+     history_count( 0 ),
+     history_newest( 0 ),
+     state_locally_owned( false )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+PhysicalEntityLagCompInterp::~PhysicalEntityLagCompInterp() // RETURN: -- None.
+{
+   if ( this->history != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( this->history ) ) ) {
+         send_hs( stderr, "SpaceFOM::PhysicalEntityLagCompInterp::~PhysicalEntityLagCompInterp():%d ERROR deleting Trick Memory for 'this->history'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      this->history = NULL;
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void PhysicalEntityLagCompInterp::initialize()
+{
+   // Two states are needed to bracket a sample time.
+   if ( this->history_size < 2 ) {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::PhysicalEntityLagCompInterp::initialize():" << __LINE__
+             << " ERROR: The history_size (" << this->history_size
+             << ") must be at least 2 to interpolate between received states!"
+             << THLA_ENDL;
+      // Print message and terminate.
+      TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Allocate the history ring.
+   if ( this->history == NULL ) {
+      this->history = static_cast< SpaceTimeCoordinateData * >(
+         TMM_declare_var_1d( "SpaceFOM::SpaceTimeCoordinateData", this->history_size ) );
+      if ( this->history == NULL ) {
+         ostringstream errmsg;
+         errmsg << "SpaceFOM::PhysicalEntityLagCompInterp::initialize():" << __LINE__
+                << " ERROR: Could not allocate memory for 'history'"
+                << " for requested size " << this->history_size
+                << "!" << THLA_ENDL;
+         // Print message and terminate.
+         TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+   clear_history();
+
+   // Call the base class initialize routine.
+   PhysicalEntityLagCompBase::initialize();
+
+   // Return to calling routine.
+   return;
+}
+
+/*!
+ * @details From the TrickHLA::LagCompensation class. The lag compensation
+ * instance is bound to the PhysicalEntity packing instance created for the same
+ * templated object and takes the history and interpolation settings of
+ * this prototype.
+ *
+ * @job_class{initialization}
+ */
+TrickHLA::LagCompensation *PhysicalEntityLagCompInterp::create_template_instance(
+   char const        *instance_name,
+   TrickHLA::Packing *inst_packing )
+{
+   PhysicalEntityBase *inst_entity = dynamic_cast< PhysicalEntityBase * >( inst_packing );
+   if ( inst_entity == NULL ) {
+      send_hs( stderr, "SpaceFOM::PhysicalEntityLagCompInterp::create_template_instance():%d ERROR: The packing for '%s' is not a SpaceFOM::PhysicalEntityBase!%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      return NULL;
+   }
+
+   // There is no default constructor, so construct the instance bound to the
+   // packing and then register it with the Trick Memory Manager by name.
+   PhysicalEntityLagCompInterp *inst = new PhysicalEntityLagCompInterp( *inst_entity );
+
+   string const decl_str = string( "SpaceFOM::PhysicalEntityLagCompInterp " ) + instance_name;
+   if ( trick_MM->declare_extern_var( inst, decl_str.c_str() ) == NULL ) {
+      send_hs( stderr, "SpaceFOM::PhysicalEntityLagCompInterp::create_template_instance():%d ERROR allocating Trick Memory for '%s'%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      delete inst;
+      return NULL;
+   }
+
+   inst->debug        = this->debug;
+   inst->history_size = this->history_size;
+   inst->interp_delay = this->interp_delay;
+   inst->initialize();
+
+   return inst;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompInterp::send_lag_compensation()
+{
+   check_state_ownership();
+   PhysicalEntityLagCompBase::send_lag_compensation();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompInterp::bypass_send_lag_compensation()
+{
+   check_state_ownership();
+   PhysicalEntityLagCompBase::bypass_send_lag_compensation();
+}
+
+/*!
+ * @details Unlike the base class, the state is sampled from the history on
+ * every call and not only when new state data was received, so that the
+ * entity moves smoothly between the received states.
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompInterp::receive_lag_compensation()
+{
+   double const end_t = get_scenario_time();
+
+   check_state_ownership();
+
+   // Because of ownership transfers and attributes being sent at different
+   // rates we need to check to see if we received attribute data.
+   if ( this->state_attr->is_received() ) {
+
+      // Copy the received PhysicalEntity state over to the lag compensated
+      // state and remember it in the history.
+      this->load_lag_comp_data();
+      add_to_history( this->lag_comp_data );
+   }
+
+   double const sample_t = end_t - get_interp_delay();
+
+   // Use the inherited debug-handler to allow debug comments to be turned
+   // on and off from a setting in the input file.
+   if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+      ostringstream errmsg;
+      errmsg << "******* PhysicalEntityLagCompInterp::receive_lag_compensation():" << __LINE__ << endl
+             << "  scenario-time:" << end_t << endl
+             << "    sample-time:" << sample_t << endl
+             << "  history-count:" << this->history_count << endl;
+      if ( this->history_count > 0 ) {
+         errmsg << "   history-span:" << history_at( 0 ).time
+                << " to " << history_at( this->history_count - 1 ).time << endl;
+      }
+      send_hs( stderr, errmsg.str().c_str() );
+   }
+
+   if ( this->history_count > 0 ) {
+
+      // Print out debug information if desired.
+      if ( debug ) {
+         cout << "Receive data before interpolation: " << endl;
+         this->print_lag_comp_data();
+      }
+
+      // Interpolate the state at the sample time.
+      this->compensate( history_at( this->history_count - 1 ).time, sample_t );
+
+      // Print out debug information if desired.
+      if ( debug ) {
+         cout << "Receive data after interpolation: " << endl;
+         this->print_lag_comp_data();
+      }
+   }
+
+   // Copy the compensated state to the packing data.
+   this->unload_lag_comp_data();
+
+   // Move the unpacked data into the working data.
+   this->entity.unpack_into_working_data();
+
+   // Return to calling routine.
+   return;
+}
+
+/*!
+ * @details The send side has no received history, so the state is sent
+ * without compensation.
+ * @job_class{scheduled}
+ */
+int PhysicalEntityLagCompInterp::compensate(
+   const double t_begin,
+   const double t_end )
+{
+   this->compensate_dt = t_end - t_begin;
+
+   if ( this->history_count > 0 ) {
+      sample_state( t_end, this->lag_comp_data );
+      this->Q_dot.derivative_first( this->lag_comp_data.att,
+                                    this->lag_comp_data.ang_vel );
+   }
+   return ( 0 );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool PhysicalEntityLagCompInterp::sample_state(
+   double const             time,
+   SpaceTimeCoordinateData &state ) const
+{
+   if ( this->history_count <= 0 ) {
+      return false;
+   }
+
+   // Hold the oldest or newest state outside of the history.
+   SpaceTimeCoordinateData const &oldest = history_at( 0 );
+   if ( time <= oldest.time ) {
+      state = oldest;
+      return ( time == oldest.time );
+   }
+   SpaceTimeCoordinateData const &newest = history_at( this->history_count - 1 );
+   if ( time >= newest.time ) {
+      state = newest;
+      return ( time == newest.time );
+   }
+
+   // Find the two received states that bracket the time, searching back from
+   // the newest state since the sample time is usually near it.
+   int k = this->history_count - 2;
+   while ( ( k > 0 ) && ( history_at( k ).time > time ) ) {
+      --k;
+   }
+   SpaceTimeCoordinateData const &before = history_at( k );
+   SpaceTimeCoordinateData const &after  = history_at( k + 1 );
+
+   double const fraction = ( time - before.time ) / ( after.time - before.time );
+
+   // Linear interpolation of the vectors.
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      state.pos[iinc]     = before.pos[iinc] + ( fraction * ( after.pos[iinc] - before.pos[iinc] ) );
+      state.vel[iinc]     = before.vel[iinc] + ( fraction * ( after.vel[iinc] - before.vel[iinc] ) );
+      state.ang_vel[iinc] = before.ang_vel[iinc] + ( fraction * ( after.ang_vel[iinc] - before.ang_vel[iinc] ) );
+   }
+
+   // Spherical linear interpolation of the attitude.
+   state.att.slerp( before.att, after.att, fraction );
+   state.time = time;
+
+   return true;
+}
+
+/*!
+ * @details Without a configured interp_delay the sample time trails the
+ * scenario time by one data cycle of the object, measured between the two
+ * newest received states, so the sample is bracketed by received states.
+ * @job_class{scheduled}
+ */
+double PhysicalEntityLagCompInterp::get_interp_delay() const
+{
+   if ( this->interp_delay >= 0.0 ) {
+      return this->interp_delay;
+   }
+   if ( this->history_count >= 2 ) {
+      return ( history_at( this->history_count - 1 ).time
+               - history_at( this->history_count - 2 ).time );
+   }
+   return 0.0;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompInterp::clear_history()
+{
+   this->history_count  = 0;
+   this->history_newest = this->history_size - 1;
+}
+
+/*!
+ * @details The states received before this federate owned the state
+ * attribute, or while another federate owned it before a transfer, are not
+ * a continuous history of the current owner.
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompInterp::check_state_ownership()
+{
+   bool const owned = ( this->state_attr != NULL ) && this->state_attr->is_locally_owned();
+   if ( owned != this->state_locally_owned ) {
+      this->state_locally_owned = owned;
+      if ( this->history_count > 0 ) {
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+            send_hs( stdout, "SpaceFOM::PhysicalEntityLagCompInterp::check_state_ownership():%d The state attribute is now %s, clearing the history.%c",
+                     __LINE__, ( owned ? "locally owned" : "remotely owned" ), THLA_NEWLINE );
+         }
+         clear_history();
+      }
+   }
+}
+
+/*!
+ * @details A state with the same time as the newest state replaces it. A
+ * state older than the newest state, such as after a checkpoint restore or a
+ * publisher restart, clears the history since the states are no longer in
+ * time order.
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompInterp::add_to_history(
+   SpaceTimeCoordinateData const &state )
+{
+   if ( this->history == NULL ) {
+      return;
+   }
+
+   if ( this->history_count > 0 ) {
+      double const newest_time = history_at( this->history_count - 1 ).time;
+      if ( state.time == newest_time ) {
+         this->history[this->history_newest] = state;
+         return;
+      }
+      if ( state.time < newest_time ) {
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+            send_hs( stdout, "SpaceFOM::PhysicalEntityLagCompInterp::add_to_history():%d Received state time %.12G is older than the newest state time %.12G, clearing the history.%c",
+                     __LINE__, state.time, newest_time, THLA_NEWLINE );
+         }
+         clear_history();
+      }
+   }
+
+   this->history_newest                = ( this->history_newest + 1 ) % this->history_size;
+   this->history[this->history_newest] = state;
+   if ( this->history_count < this->history_size ) {
+      ++this->history_count;
+   }
+}
@@ -317,6 +317,11 @@ void PhysicalInterfaceBase::pack()
       send_hs( stderr, errmsg.str().c_str() );
    }
 
+   // Nothing to pack if none of the attributes are due to be sent.
+   if ( attr_mask == 0 ) {
+      return;
+   }
+
    // Check for latency/lag compensation.
    if ( this->object->lag_comp == NULL ) {
       this->pack_from_working_data();
@@ -328,8 +333,10 @@ void PhysicalInterfaceBase::pack()
       this->print_data();
    }
 
-   // Encode the data into the buffer.
-   quat_encoder.encode();
+   // Encode the data into the buffer if the attitude is due to be sent.
+   if ( is_attribute_in_mask( attitude_attr ) ) {
+      quat_encoder.encode();
+   }
 
    return;
 }
@@ -344,8 +351,11 @@ void PhysicalInterfaceBase::unpack()
            << " ERROR: The initialize() function has not been called!" << endl;
    }
 
-   // Use the HLA encoder helpers to decode the PhysicalInterface fixed record.
-   quat_encoder.decode();
+   // Use the HLA encoder helpers to decode the PhysicalInterface fixed record
+   // if the attitude was received.
+   if ( is_attribute_in_mask( attitude_attr ) ) {
+      quat_encoder.decode();
+   }
 
    // Transfer the packing data into the working data.
    this->unpack_into_working_data();
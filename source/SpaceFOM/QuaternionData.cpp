@@ -293,6 +293,50 @@ void QuaternionData::multiply(
    return;
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void QuaternionData::slerp(
+   QuaternionData const &q_begin,
+   QuaternionData const &q_end,
+   double const          fraction )
+{
+   // A quaternion and its negative represent the same attitude, so flip the
+   // end quaternion if needed to interpolate along the shortest path.
+   double cos_theta = ( q_begin.scalar * q_end.scalar )
+                      + V_DOT( q_begin.vector, q_end.vector );
+   double end_sign  = 1.0;
+   if ( cos_theta < 0.0 ) {
+      cos_theta = -cos_theta;
+      end_sign  = -1.0;
+   }
+
+   double begin_weight;
+   double end_weight;
+   if ( cos_theta > 0.9995 ) {
+      // The attitudes are nearly the same, so linear interpolation is
+      // accurate and avoids dividing by a vanishing sin(theta).
+      begin_weight = 1.0 - fraction;
+      end_weight   = fraction;
+   } else {
+      double const theta     = acos( cos_theta );
+      double const sin_theta = sin( theta );
+      begin_weight           = sin( ( 1.0 - fraction ) * theta ) / sin_theta;
+      end_weight             = sin( fraction * theta ) / sin_theta;
+   }
+   end_weight *= end_sign;
+
+   this->scalar = ( begin_weight * q_begin.scalar ) + ( end_weight * q_end.scalar );
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      this->vector[iinc] = ( begin_weight * q_begin.vector[iinc] )
+                           + ( end_weight * q_end.vector[iinc] );
+   }
+
+   // Remove any numerical drift from a unit quaternion.
+   normalize();
+   return;
+}
+
 /*!
  * @job_class{derivative}
  */
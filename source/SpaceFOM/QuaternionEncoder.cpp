@@ -19,6 +19,7 @@ NASA, Johnson Space Center\n
 
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, --, July 2018, NExSyS, Initial version}
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Encode with the generated SpaceFOM codec.}
 @revs_end
 */
 
@@ -33,54 +34,35 @@ NASA, Johnson Space Center\n
 
 // Model include files.
 #include "SpaceFOM/QuaternionEncoder.hh"
+#include "SpaceFOM/SpaceFOMCodec.hh"
 
-// C++11 deprecated dynamic exception specifications for a function so we need
-// to silence the warnings coming from the IEEE 1516 declared functions.
-// This should work for both GCC and Clang.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdeprecated"
-// HLA Encoder helper includes.
-#include "RTI/VariableLengthData.h"
-#pragma GCC diagnostic pop
-
-using namespace RTI1516_NAMESPACE;
 using namespace std;
 using namespace SpaceFOM;
+using namespace SpaceFOMCodec;
+
+// The generated AttitudeQuaternion layout must match the QuaternionData.
+static_assert( AttitudeQuaternion_ENCODED_SIZE == ( 4 * sizeof( double ) ),
+               "SpaceFOMCodec AttitudeQuaternion does not match QuaternionData." );
 
 /**
  * @job_class{initialization}
  */
 QuaternionEncoder::QuaternionEncoder(
    QuaternionData &quat_data )
-   : data( quat_data ),
-     scalar_encoder( &data.scalar ),
-     vector_encoder( HLAfloat64LE(), 3 ),
-     encoder()
+   : data( quat_data )
 {
-   // Build up the encoders.
    // ObjectClass: ReferenceFrame, FOM-Module: SISO_SpaceFOM_environment.xml
    //   Attribute-Name: attitude_quaternion, DataType: AttitudeQuaternion, encoding: HLAfixedRecord, FOM-Module: SISO_SpaceFOM_datatypes.xml
    //      field-name: scalar, dataType: Scalar, representation: HLAfloat64LE
    //      field-name: vector, dataType: Vector, dataType:(Scalar,representation:HLAfloat64LE), encoding:HLAfixedArray, cardinality: 3
    //
-
-   // Build up the attitude quaternion encoder.
-   // Quaternion:
-   // Quaternion scalar: The attitude quaternion scalar encoder was configured
-   // in the constructor initialization list above.
-   // Quaternion vector:
-   for ( int i = 0; i < 3; ++i ) {
-      vector[i].setDataPointer( &data.vector[i] );
-      vector_encoder.setElementPointer( i, &vector[i] );
-   }
-   // Add the scalar and vector encoders to the quaternion encoder.
-   encoder.appendElementPointer( &scalar_encoder );
-   encoder.appendElementPointer( &vector_encoder );
+   // The SpaceFOMCodec functions generated from the FOM encode the fixed
+   // record at constant offsets, so there are no encoder helpers to build.
 
    // Setup the TrickHLA buffer based on the size of the encoded fixed record.
    // We can do this here because the record is a fixed size all the time.
    set_byte_alignment( 1 );
-   ensure_buffer_capacity( encoder.getEncodedLength() );
+   ensure_buffer_capacity( AttitudeQuaternion_ENCODED_SIZE );
 }
 
 /**
@@ -88,18 +70,16 @@ QuaternionEncoder::QuaternionEncoder(
  */
 void QuaternionEncoder::encode() // Return: -- Nothing.
 {
-   // Encode the data into the reference frame buffer.
-   VariableLengthData encoded_data = encoder.encode();
-
-   // Copy the encoded data into the buffer.
-   if ( get_capacity() >= encoded_data.size() ) {
-      memcpy( buffer, encoded_data.data(), encoded_data.size() );
+   // Encode the data directly into the reference frame buffer.
+   if ( get_capacity() >= AttitudeQuaternion_ENCODED_SIZE ) {
+      put_Scalar( buffer + AttitudeQuaternion_scalar_OFFSET, data.scalar );
+      put_Vector( buffer + AttitudeQuaternion_vector_OFFSET, data.vector );
    } else {
       // Print message and terminate.
       ostringstream errmsg;
       errmsg << "SpaceFOM::QuaternionEncoder::encode():" << __LINE__
              << " Warning: Encoded data size does not match buffer!"
-             << "    Encoded size: " << encoded_data.size()
+             << "    Encoded size: " << AttitudeQuaternion_ENCODED_SIZE
              << " but Expected size: " << get_capacity();
       send_hs( stderr, errmsg.str().c_str() );
    }
@@ -112,12 +92,12 @@ void QuaternionEncoder::encode() // Return: -- Nothing.
  */
 void QuaternionEncoder::decode() // Return: -- Nothing.
 {
-   // The Encoder helps operate on VariableLengthData so create one using the
-   // buffered HLA data we received through the TrickHLA callback.
-   VariableLengthData encoded_data = VariableLengthData( buffer, capacity );
-
-   // Use the HLA encoder helpers to decode the reference frame fixed record.
-   encoder.decode( encoded_data );
+   // Decode the attitude quaternion fixed record directly from the buffered
+   // HLA data we received through the TrickHLA callback.
+   if ( capacity >= AttitudeQuaternion_ENCODED_SIZE ) {
+      get_Scalar( buffer + AttitudeQuaternion_scalar_OFFSET, data.scalar );
+      get_Vector( buffer + AttitudeQuaternion_vector_OFFSET, data.vector );
+   }
 
    return;
 }
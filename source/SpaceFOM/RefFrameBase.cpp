@@ -594,6 +594,11 @@ void RefFrameBase::pack()
       }
    }
 
+   // Nothing to pack if none of the attributes are due to be sent.
+   if ( attr_mask == 0 ) {
+      return;
+   }
+
    // Check for latency/lag compensation.
    if ( this->object->lag_comp == NULL ) {
       this->pack_from_working_data();
@@ -605,8 +610,10 @@ void RefFrameBase::pack()
       this->print_data();
    }
 
-   // Encode the data into the buffer.
-   stc_encoder.encode();
+   // Encode the data into the buffer if the state is due to be sent.
+   if ( is_attribute_in_mask( state_attr ) ) {
+      stc_encoder.encode();
+   }
 
    return;
 }
@@ -626,8 +633,11 @@ void RefFrameBase::unpack()
       }
    }
 
-   // Use the HLA encoder helpers to decode the PhysicalEntity fixed record.
-   stc_encoder.decode();
+   // Use the HLA encoder helpers to decode the PhysicalEntity fixed record
+   // if the state was received.
+   if ( is_attribute_in_mask( state_attr ) ) {
+      stc_encoder.decode();
+   }
 
    // Transfer the packing data into the working data.
    this->unpack_into_working_data();
@@ -139,6 +139,47 @@ void RefFrameState::initialize()
    return;
 }
 
+/*!
+ * @details From the TrickHLA::Packing class. The packing instance and its
+ * reference frame data are allocated as named Trick variables so that the
+ * object template attribute trick_names, which are relative to the packing
+ * instance, can be resolved.
+ *
+ * @job_class{initialization}
+ */
+TrickHLA::Packing *RefFrameState::create_template_instance(
+   char const *instance_name )
+{
+   string decl_str = string( "SpaceFOM::RefFrameState " ) + instance_name;
+
+   RefFrameState *inst = static_cast< RefFrameState * >( trick_MM->declare_var( decl_str.c_str() ) );
+   if ( inst == NULL ) {
+      send_hs( stderr, "SpaceFOM::RefFrameState::create_template_instance():%d ERROR allocating Trick Memory for '%s'%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      return NULL;
+   }
+
+   decl_str = string( "SpaceFOM::RefFrameData " ) + instance_name + "_data";
+
+   RefFrameData *inst_data = static_cast< RefFrameData * >( trick_MM->declare_var( decl_str.c_str() ) );
+   if ( inst_data == NULL ) {
+      send_hs( stderr, "SpaceFOM::RefFrameState::create_template_instance():%d ERROR allocating Trick Memory for '%s_data'%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      return NULL;
+   }
+
+   // The frame name and parent frame name are received from the owning
+   // federate, so start with empty strings.
+   inst->packing_data.name        = trick_MM->mm_strdup( "" );
+   inst->packing_data.parent_name = trick_MM->mm_strdup( "" );
+   inst->debug                    = this->debug;
+
+   inst->configure( inst_data );
+   inst->initialize();
+
+   return inst;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -23,6 +23,8 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{Conditional.cpp}
 @trick_link_dependency{DebugHandler.cpp}
 @trick_link_dependency{Int64BaseTime.cpp}
+@trick_link_dependency{MemoryAccounting.cpp}
+@trick_link_dependency{MemoryUsage.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{Utilities.cpp}
 
@@ -43,6 +45,7 @@ NASA, Johnson Space Center\n
 #include <limits>
 #include <sstream>
 #include <string>
+#include <unistd.h>
 
 // Trick include files.
 #include "trick/MemoryManager.hh"
@@ -56,6 +59,10 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Conditional.hh"
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/Int64BaseTime.hh"
+#include "TrickHLA/MemoryAccounting.hh"
+#include "TrickHLA/MemoryUsage.hh"
+#include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/SharedMemoryChannel.hh"
 #include "TrickHLA/StringUtilities.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
@@ -79,8 +86,13 @@ Attribute::Attribute()
      locally_owned( false ),
      rti_encoding( ENCODING_UNKNOWN ),
      cycle_time( -std::numeric_limits< double >::max() ),
+     send_priority( SEND_PRIORITY_OBJECT ),
+     shared_memory( false ),
+     shared_memory_FOM_name( NULL ),
+     shared_memory_capacity( 0 ),
      buffer( NULL ),
      buffer_capacity( 0 ),
+     memory_owner( NULL ),
      size_is_static( true ),
      size( 0 ),
      num_items( 0 ),
@@ -89,6 +101,15 @@ Attribute::Attribute()
      byteswap( false ),
      cycle_ratio( 1 ),
      cycle_cnt( 0 ),
+     cycle_ratio_scale( 1 ),
+     dropped_send_count( 0 ),
+     shm_writer(),
+     shm_reader(),
+     shm_segment_name(),
+     shm_segment_count( 0 ),
+     shared_memory_inline( false ),
+     shared_memory_inline_pending( false ),
+     shared_memory_stale_count( 0 ),
      ref2( NULL ),
      pull_requested( false ),
      push_requested( false ),
@@ -111,6 +132,7 @@ Attribute::~Attribute()
          send_hs( stderr, "Attribute::~Attribute():%d ERROR deleting Trick Memory for 'buffer'%c",
                   __LINE__, THLA_NEWLINE );
       }
+      MemoryAccounting::record( MEMORY_ATTRIBUTE_BUFFERS, -(int64_t)buffer_capacity, memory_owner );
       buffer          = NULL;
       buffer_capacity = 0;
    }
@@ -237,6 +259,10 @@ void Attribute::initialize(
 
    // Get the ref-attributes for the given trick-name.
    if ( ref2 == NULL ) {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &Utilities::trick_mm_mutex );
+
       ref2 = ref_attributes( trick_name );
    }
 
@@ -488,19 +514,56 @@ void Attribute::initialize(
    // Determine if we need to do a byteswap for data transmission.
    byteswap = Utilities::is_transmission_byteswap( rti_encoding );
 
+   if ( shared_memory ) {
+      // The descriptor is sent in its own attribute so that the value
+      // attribute always carries the FOM encoded value.
+      if ( ( shared_memory_FOM_name == NULL ) || ( *shared_memory_FOM_name == '\0' ) ) {
+         ostringstream errmsg;
+         errmsg << "Attribute::initialize():" << __LINE__
+                << " ERROR: FOM Object Attribute '"
+                << obj_FOM_name << "'->'" << FOM_name << "' with Trick name '"
+                << trick_name << "' has 'shared_memory' set but is missing the"
+                << " FOM name of the attribute that carries the shared-memory"
+                << " descriptor. Make sure THLA.manager.objects["
+                << object_index << "].attributes[" << attribute_index
+                << "].shared_memory_FOM_name' in either your input.py file or"
+                << " modified-data files is correctly specified." << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+
+      // Name the shared-memory segments after this process and the attribute
+      // indexes so the segment names are unique on the host.
+      ostringstream shm_name;
+      shm_name << "/TrickHLA." << getpid() << "." << object_index << "." << attribute_index;
+      this->shm_segment_name = shm_name.str();
+
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+         send_hs( stdout, "Attribute::initialize():%d FOM Object Attribute '%s'->'%s' \
+sends shared-memory descriptors in attribute '%s'.%c",
+                  __LINE__, obj_FOM_name, FOM_name, shared_memory_FOM_name, THLA_NEWLINE );
+      }
+   }
+
    // Determine if the size of this attribute is static or dynamic.
    size_is_static = is_static_in_size();
 
-   // Get the attribute size and number of items.
-   // However, do not re-initialize an attribute which was loaded
-   // from a checkpoint (already in an initialized state).
-   if ( !this->initialized ) {
-      calculate_size_and_number_of_items();
-      this->initialized = true;
-   }
+   {
+      // The size of a dynamic array and the buffer come from the Trick
+      // memory-manager. When auto_unlock_mutex goes out of scope it
+      // automatically unlocks the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &Utilities::trick_mm_mutex );
+
+      // Get the attribute size and number of items.
+      // However, do not re-initialize an attribute which was loaded
+      // from a checkpoint (already in an initialized state).
+      if ( !this->initialized ) {
+         calculate_size_and_number_of_items();
+         this->initialized = true;
+      }
 
-   // Ensure enough buffer capacity for the attribute.
-   ensure_buffer_capacity( size );
+      // Ensure enough buffer capacity for the attribute.
+      ensure_buffer_capacity( size );
+   }
 
    // Check to make sure the users simulation variable has memory allocated to
    // it. It could be that the users simulation variable happens to be pointing
@@ -636,13 +699,152 @@ void Attribute::determine_cycle_ratio(
 
 VariableLengthData Attribute::get_attribute_value()
 {
-   if ( rti_encoding == ENCODING_BOOLEAN ) {
-      // The size is the number of 1-byte bool values in c++ and we need to
-      // map to a 4-byte HLAboolean type. The buffer already holds the
-      // encoded HLAboolean type.
-      return VariableLengthData( buffer, ( 4 * size ) );
+   // The size is the number of 1-byte bool values in c++ and we need to
+   // map to a 4-byte HLAboolean type. The buffer already holds the
+   // encoded HLAboolean type.
+   size_t const value_size = ( rti_encoding == ENCODING_BOOLEAN ) ? ( 4 * size ) : size;
+
+   return VariableLengthData( buffer, value_size );
+}
+
+/*!
+ * @details The value does not own the data it points at, so unlike
+ * get_attribute_value() no copy of the buffer is made. The value must be
+ * pointed at the buffer again before each send because the buffer can be
+ * reallocated when it grows.
+ */
+void Attribute::get_attribute_value_pointer(
+   VariableLengthData &value )
+{
+   // The size is the number of 1-byte bool values in c++ and we need to
+   // map to a 4-byte HLAboolean type. The buffer already holds the
+   // encoded HLAboolean type.
+   size_t const value_size = ( rti_encoding == ENCODING_BOOLEAN ) ? ( 4 * size ) : size;
+
+   value.setDataPointer( buffer, value_size );
+}
+
+VariableLengthData Attribute::get_shared_memory_value()
+{
+   write_shared_memory();
+   return VariableLengthData( shm_writer.get_descriptor(), sizeof( SharedMemoryDescriptor ) );
+}
+
+void Attribute::get_shared_memory_value_pointer(
+   VariableLengthData &value )
+{
+   write_shared_memory();
+   value.setDataPointer( const_cast< SharedMemoryDescriptor * >( shm_writer.get_descriptor() ),
+                         sizeof( SharedMemoryDescriptor ) );
+}
+
+/*!
+ * @details Co-located subscribers only subscribe to the descriptor attribute,
+ * so every value is written to the side channel. A value that does not fit
+ * gets a new segment with twice its size under a new name, which the readers
+ * map when they see the new name in the descriptor.
+ */
+void Attribute::write_shared_memory()
+{
+   // The size is the number of 1-byte bool values in c++ and we need to
+   // map to a 4-byte HLAboolean type. The buffer already holds the
+   // encoded HLAboolean type.
+   size_t const value_size = ( rti_encoding == ENCODING_BOOLEAN ) ? ( 4 * size ) : size;
+
+   if ( shm_writer.is_open() && shm_writer.write( buffer, value_size ) ) {
+      return;
+   }
+
+   size_t capacity;
+   if ( !shm_writer.is_open() && ( shared_memory_capacity >= value_size ) ) {
+      capacity = shared_memory_capacity;
+   } else {
+      capacity = size_is_static ? value_size : ( 2 * value_size );
+   }
+   if ( capacity == 0 ) {
+      capacity = 1;
+   }
+
+   ostringstream shm_name;
+   shm_name << shm_segment_name << "." << shm_segment_count;
+   ++shm_segment_count;
+   shm_writer.set_segment_name( shm_name.str() );
+
+   if ( !shm_writer.create( capacity ) || !shm_writer.write( buffer, value_size ) ) {
+      ostringstream errmsg;
+      errmsg << "Attribute::write_shared_memory():" << __LINE__
+             << " ERROR: Could not write the value of Attribute '" << FOM_name
+             << "' with Trick name '" << trick_name << "' to the shared-memory"
+             << " segment '" << shm_name.str() << "'. Set 'shared_memory' to"
+             << " false for this attribute if shared memory is not available"
+             << " on this host." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+      send_hs( stdout, "Attribute::write_shared_memory():%d Attribute '%s' \
+created shared-memory segment '%s' with a capacity of %lu bytes.%c",
+               __LINE__, FOM_name, shm_name.str().c_str(), (unsigned long)capacity,
+               THLA_NEWLINE );
+   }
+}
+
+bool const Attribute::read_shared_memory(
+   VariableLengthData const *attr_value,
+   VariableLengthData       &value )
+{
+   switch ( shm_reader.read( attr_value->data(), attr_value->size() ) ) {
+      case SHARED_MEMORY_READ_OK: {
+         value.setDataPointer( shm_reader.get_read_data(), shm_reader.get_read_size() );
+         return true;
+      }
+      case SHARED_MEMORY_READ_REMOTE: {
+         if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+            send_hs( stdout, "Attribute::read_shared_memory():%d Attribute '%s' \
+with Trick name '%s' can not read the shared-memory side channel of the \
+publisher, subscribing to the FOM encoded value instead.%c",
+                     __LINE__, FOM_name, trick_name, THLA_NEWLINE );
+         }
+         fall_back_from_shared_memory();
+         return false;
+      }
+      case SHARED_MEMORY_READ_STALE:
+      default: {
+         ++shared_memory_stale_count;
+         send_hs( stderr, "Attribute::read_shared_memory():%d WARNING: Attribute \
+'%s' with Trick name '%s' lost a value because the publisher overwrote it in \
+the shared-memory side channel before it was read (%llu lost), subscribing to \
+the FOM encoded value instead.%c",
+                  __LINE__, FOM_name, trick_name, shared_memory_stale_count,
+                  THLA_NEWLINE );
+         fall_back_from_shared_memory();
+         return false;
+      }
+   }
+}
+
+void Attribute::fall_back_from_shared_memory()
+{
+   if ( !shared_memory_inline ) {
+      this->shared_memory_inline         = true;
+      this->shared_memory_inline_pending = true;
+      shm_reader.close();
+   }
+}
+
+bool Attribute::extract_shared_memory_data(
+   VariableLengthData const *attr_value )
+{
+   // Ignore the descriptors once this subscriber receives the FOM encoded value.
+   if ( ( attr_value == NULL ) || !is_shared_memory_enabled() ) {
+      return false;
+   }
+
+   VariableLengthData shm_value;
+   if ( !read_shared_memory( attr_value, shm_value ) ) {
+      return false;
    }
-   return VariableLengthData( buffer, size );
+   return extract_data( &shm_value );
 }
 
 bool Attribute::extract_data(             // RETURN: -- True if data successfully extracted, false otherwise.
@@ -830,9 +1032,25 @@ bool Attribute::extract_data(             // RETURN: -- True if data successfull
    return true;
 }
 
+void Attribute::set_memory_owner(
+   MemoryUsage *owner )
+{
+   if ( buffer != NULL ) {
+      if ( memory_owner != NULL ) {
+         memory_owner->record( -(int64_t)buffer_capacity );
+      }
+      if ( owner != NULL ) {
+         owner->record( (int64_t)buffer_capacity );
+      }
+   }
+   this->memory_owner = owner;
+}
+
 void Attribute::ensure_buffer_capacity(
    size_t capacity )
 {
+   size_t const prev_capacity = ( buffer != NULL ) ? buffer_capacity : 0;
+
    if ( capacity > buffer_capacity ) {
       buffer_capacity = capacity;
       if ( buffer == NULL ) {
@@ -858,6 +1076,8 @@ void Attribute::ensure_buffer_capacity(
              << "' with Trick name '" << trick_name << "'!" << THLA_ENDL;
       DebugHandler::terminate_with_message( errmsg.str() );
    }
+
+   MemoryAccounting::record( MEMORY_ATTRIBUTE_BUFFERS, (int64_t)buffer_capacity - (int64_t)prev_capacity, memory_owner );
 }
 
 void Attribute::calculate_size_and_number_of_items()
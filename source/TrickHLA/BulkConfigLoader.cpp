@@ -0,0 +1,906 @@
+/*!
+@file TrickHLA/BulkConfigLoader.cpp
+@ingroup TrickHLA
+@brief This class populates the TrickHLA Manager objects and interactions
+from a JSON manifest instead of setting every field through the Trick input
+processor.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Attribute.cpp}
+@trick_link_dependency{BulkConfigLoader.cpp}
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{Interaction.cpp}
+@trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MonotonicClock.cpp}
+@trick_link_dependency{Object.cpp}
+@trick_link_dependency{Parameter.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Trick include files.
+#include "trick/MemoryManager.hh"
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/BulkConfigLoader.hh"
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Interaction.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/MonotonicClock.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/Parameter.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+namespace
+{
+
+// Minimal JSON document model and parser for the manifest.
+class JSONValue
+{
+  public:
+   enum Type {
+      JSON_NULL,
+      JSON_BOOL,
+      JSON_NUMBER,
+      JSON_STRING,
+      JSON_ARRAY,
+      JSON_OBJECT
+   };
+
+   Type                type;
+   bool                boolean;
+   double              number;
+   string              str;
+   vector< string >    keys;  // Member names of an object.
+   vector< JSONValue > items; // Array elements or object member values.
+
+   JSONValue()
+      : type( JSON_NULL ),
+        boolean( false ),
+        number( 0.0 ),
+        str(),
+        keys(),
+        items()
+   {
+      return;
+   }
+
+   JSONValue const *find( char const *key ) const
+   {
+      for ( unsigned int i = 0; i < keys.size(); ++i ) {
+         if ( keys[i] == key ) {
+            return &items[i];
+         }
+      }
+      return NULL;
+   }
+};
+
+class JSONParser
+{
+  public:
+   explicit JSONParser( string const &json_text )
+      : text( json_text ),
+        pos( 0 ),
+        line( 1 ),
+        error()
+   {
+      return;
+   }
+
+   bool parse( JSONValue &value )
+   {
+      if ( !parse_value( value ) ) {
+         return false;
+      }
+      skip_space();
+      if ( pos < text.size() ) {
+         return fail( "unexpected data after the document" );
+      }
+      return true;
+   }
+
+   string const &get_error() const
+   {
+      return error;
+   }
+
+   int get_line() const
+   {
+      return line;
+   }
+
+  private:
+   string const &text;
+   size_t        pos;
+   int           line;
+   string        error;
+
+   bool fail( char const *msg )
+   {
+      if ( error.empty() ) {
+         error = msg;
+      }
+      return false;
+   }
+
+   void skip_space()
+   {
+      while ( pos < text.size() ) {
+         char c = text[pos];
+         if ( c == '\n' ) {
+            ++line;
+         } else if ( ( c != ' ' ) && ( c != '\t' ) && ( c != '\r' ) ) {
+            return;
+         }
+         ++pos;
+      }
+   }
+
+   bool match( char const *word )
+   {
+      size_t len = strlen( word );
+      if ( text.compare( pos, len, word ) == 0 ) {
+         pos += len;
+         return true;
+      }
+      return false;
+   }
+
+   bool parse_value( JSONValue &value )
+   {
+      skip_space();
+      if ( pos >= text.size() ) {
+         return fail( "unexpected end of the document" );
+      }
+      char c = text[pos];
+      if ( c == '{' ) {
+         return parse_object( value );
+      }
+      if ( c == '[' ) {
+         return parse_array( value );
+      }
+      if ( c == '"' ) {
+         value.type = JSONValue::JSON_STRING;
+         return parse_string( value.str );
+      }
+      if ( match( "true" ) ) {
+         value.type    = JSONValue::JSON_BOOL;
+         value.boolean = true;
+         return true;
+      }
+      if ( match( "false" ) ) {
+         value.type    = JSONValue::JSON_BOOL;
+         value.boolean = false;
+         return true;
+      }
+      if ( match( "null" ) ) {
+         value.type = JSONValue::JSON_NULL;
+         return true;
+      }
+      if ( ( c == '-' ) || ( ( c >= '0' ) && ( c <= '9' ) ) ) {
+         char const *start = text.c_str() + pos;
+         char       *end   = NULL;
+         value.type        = JSONValue::JSON_NUMBER;
+         value.number      = strtod( start, &end );
+         pos += ( end - start );
+         return true;
+      }
+      return fail( "unexpected character" );
+   }
+
+   bool parse_object( JSONValue &value )
+   {
+      value.type = JSONValue::JSON_OBJECT;
+      ++pos; // Skip the '{'.
+      skip_space();
+      if ( ( pos < text.size() ) && ( text[pos] == '}' ) ) {
+         ++pos;
+         return true;
+      }
+      while ( true ) {
+         skip_space();
+         if ( ( pos >= text.size() ) || ( text[pos] != '"' ) ) {
+            return fail( "expected an object member name" );
+         }
+         value.keys.push_back( string() );
+         if ( !parse_string( value.keys.back() ) ) {
+            return false;
+         }
+         skip_space();
+         if ( ( pos >= text.size() ) || ( text[pos] != ':' ) ) {
+            return fail( "expected ':' after an object member name" );
+         }
+         ++pos;
+         value.items.push_back( JSONValue() );
+         if ( !parse_value( value.items.back() ) ) {
+            return false;
+         }
+         skip_space();
+         if ( ( pos < text.size() ) && ( text[pos] == ',' ) ) {
+            ++pos;
+         } else if ( ( pos < text.size() ) && ( text[pos] == '}' ) ) {
+            ++pos;
+            return true;
+         } else {
+            return fail( "expected ',' or '}' in an object" );
+         }
+      }
+   }
+
+   bool parse_array( JSONValue &value )
+   {
+      value.type = JSONValue::JSON_ARRAY;
+      ++pos; // Skip the '['.
+      skip_space();
+      if ( ( pos < text.size() ) && ( text[pos] == ']' ) ) {
+         ++pos;
+         return true;
+      }
+      while ( true ) {
+         value.items.push_back( JSONValue() );
+         if ( !parse_value( value.items.back() ) ) {
+            return false;
+         }
+         skip_space();
+         if ( ( pos < text.size() ) && ( text[pos] == ',' ) ) {
+            ++pos;
+         } else if ( ( pos < text.size() ) && ( text[pos] == ']' ) ) {
+            ++pos;
+            return true;
+         } else {
+            return fail( "expected ',' or ']' in an array" );
+         }
+      }
+   }
+
+   bool parse_string( string &str )
+   {
+      ++pos; // Skip the opening quote.
+      while ( pos < text.size() ) {
+         char c = text[pos++];
+         if ( c == '"' ) {
+            return true;
+         }
+         if ( c == '\n' ) {
+            return fail( "unterminated string" );
+         }
+         if ( c != '\\' ) {
+            str += c;
+            continue;
+         }
+         if ( pos >= text.size() ) {
+            break;
+         }
+         c = text[pos++];
+         switch ( c ) {
+            case 'b':
+               str += '\b';
+               break;
+            case 'f':
+               str += '\f';
+               break;
+            case 'n':
+               str += '\n';
+               break;
+            case 'r':
+               str += '\r';
+               break;
+            case 't':
+               str += '\t';
+               break;
+            case 'u': {
+               if ( ( pos + 4 ) > text.size() ) {
+                  return fail( "invalid unicode escape" );
+               }
+               unsigned long code = strtoul( text.substr( pos, 4 ).c_str(), NULL, 16 );
+               pos += 4;
+               // Encode the Basic Multilingual Plane code point as UTF-8.
+               if ( code < 0x80 ) {
+                  str += static_cast< char >( code );
+               } else if ( code < 0x800 ) {
+                  str += static_cast< char >( 0xC0 | ( code >> 6 ) );
+                  str += static_cast< char >( 0x80 | ( code & 0x3F ) );
+               } else {
+                  str += static_cast< char >( 0xE0 | ( code >> 12 ) );
+                  str += static_cast< char >( 0x80 | ( ( code >> 6 ) & 0x3F ) );
+                  str += static_cast< char >( 0x80 | ( code & 0x3F ) );
+               }
+               break;
+            }
+            default:
+               // Covers the '"', '\\' and '/' escapes.
+               str += c;
+               break;
+         }
+      }
+      return fail( "unterminated string" );
+   }
+};
+
+// Enumeration names accepted in the manifest.
+struct EnumName {
+   char const *name;
+   int         value;
+};
+
+EnumName const encoding_names[] = {
+   { "ENCODING_UNKNOWN", ENCODING_UNKNOWN },
+   { "ENCODING_BIG_ENDIAN", ENCODING_BIG_ENDIAN },
+   { "ENCODING_LITTLE_ENDIAN", ENCODING_LITTLE_ENDIAN },
+   { "ENCODING_LOGICAL_TIME", ENCODING_LOGICAL_TIME },
+   { "ENCODING_C_STRING", ENCODING_C_STRING },
+   { "ENCODING_UNICODE_STRING", ENCODING_UNICODE_STRING },
+   { "ENCODING_ASCII_STRING", ENCODING_ASCII_STRING },
+   { "ENCODING_OPAQUE_DATA", ENCODING_OPAQUE_DATA },
+   { "ENCODING_BOOLEAN", ENCODING_BOOLEAN },
+   { "ENCODING_NONE", ENCODING_NONE },
+   { NULL, 0 } };
+
+EnumName const config_names[] = {
+   { "CONFIG_NONE", CONFIG_NONE },
+   { "CONFIG_INITIALIZE", CONFIG_INITIALIZE },
+   { "CONFIG_INTERMITTENT", CONFIG_INTERMITTENT },
+   { "CONFIG_CYCLIC", CONFIG_CYCLIC },
+   { "CONFIG_ZERO_LOOKAHEAD", CONFIG_ZERO_LOOKAHEAD },
+   { NULL, 0 } };
+
+EnumName const lag_comp_names[] = {
+   { "LAG_COMPENSATION_NONE", LAG_COMPENSATION_NONE },
+   { "LAG_COMPENSATION_SEND_SIDE", LAG_COMPENSATION_SEND_SIDE },
+   { "LAG_COMPENSATION_RECEIVE_SIDE", LAG_COMPENSATION_RECEIVE_SIDE },
+   { NULL, 0 } };
+
+EnumName const transport_names[] = {
+   { "TRANSPORT_SPECIFIED_IN_FOM", TRANSPORT_SPECIFIED_IN_FOM },
+   { "TRANSPORT_TIMESTAMP_ORDER", TRANSPORT_TIMESTAMP_ORDER },
+   { "TRANSPORT_RECEIVE_ORDER", TRANSPORT_RECEIVE_ORDER },
+   { NULL, 0 } };
+
+EnumName const send_priority_names[] = {
+   { "SEND_PRIORITY_CRITICAL", SEND_PRIORITY_CRITICAL },
+   { "SEND_PRIORITY_HIGH", SEND_PRIORITY_HIGH },
+   { "SEND_PRIORITY_NORMAL", SEND_PRIORITY_NORMAL },
+   { "SEND_PRIORITY_LOW", SEND_PRIORITY_LOW },
+   { "SEND_PRIORITY_OBJECT", SEND_PRIORITY_OBJECT },
+   { NULL, 0 } };
+
+EnumName const conflation_names[] = {
+   { "REFLECTION_CONFLATION_NONE", REFLECTION_CONFLATION_NONE },
+   { "REFLECTION_CONFLATION_LATEST_VALUE", REFLECTION_CONFLATION_LATEST_VALUE },
+   { "REFLECTION_CONFLATION_SAME_TIME", REFLECTION_CONFLATION_SAME_TIME },
+   { NULL, 0 } };
+
+EnumName const overflow_names[] = {
+   { "QUEUE_OVERFLOW_CONFLATE", QUEUE_OVERFLOW_CONFLATE },
+   { "QUEUE_OVERFLOW_DROP_OLDEST", QUEUE_OVERFLOW_DROP_OLDEST },
+   { "QUEUE_OVERFLOW_DROP_NEWEST", QUEUE_OVERFLOW_DROP_NEWEST },
+   { "QUEUE_OVERFLOW_BLOCK", QUEUE_OVERFLOW_BLOCK },
+   { NULL, 0 } };
+
+// Member names accepted for each manifest entry, used to catch typos.
+char const *const object_keys[] = {
+   "name", "FOM_name", "count", "create", "required", "name_required",
+   "blocking_cyclic_read", "thread_ids", "packing", "lag_comp", "lag_comp_type",
+   "conditional", "ownership", "deleted", "send_priority", "reflection_conflation",
+   "reflection_queue_max_depth", "reflection_queue_policy", "attributes", NULL };
+
+char const *const attribute_keys[] = {
+   "FOM_name", "trick_name", "config", "publish", "subscribe", "locally_owned",
+   "rti_encoding", "cycle_time", "preferred_order", "send_priority",
+   "shared_memory", NULL };
+
+char const *const interaction_keys[] = {
+   "FOM_name", "publish", "subscribe", "preferred_order", "handler",
+   "parameters", NULL };
+
+char const *const parameter_keys[] = {
+   "FOM_name", "trick_name", "rti_encoding", NULL };
+
+void terminate_in( string const &context, string const &msg )
+{
+   ostringstream errmsg;
+   errmsg << "BulkConfigLoader::load():" << __LINE__
+          << " ERROR: " << context << ": " << msg << THLA_ENDL;
+   DebugHandler::terminate_with_message( errmsg.str() );
+}
+
+void check_keys( JSONValue const &entry, char const *const *allowed, string const &context )
+{
+   if ( entry.type != JSONValue::JSON_OBJECT ) {
+      terminate_in( context, "Expected a JSON object." );
+   }
+   for ( unsigned int i = 0; i < entry.keys.size(); ++i ) {
+      bool found = false;
+      for ( int k = 0; ( allowed[k] != NULL ) && !found; ++k ) {
+         found = ( entry.keys[i] == allowed[k] );
+      }
+      if ( !found ) {
+         terminate_in( context, "Unknown member '" + entry.keys[i] + "'." );
+      }
+   }
+}
+
+// Replace every "{i}" in the string with the repeat index.
+string substitute_index( string const &str, int const index )
+{
+   size_t found = str.find( "{i}" );
+   if ( found == string::npos ) {
+      return str;
+   }
+   ostringstream index_str;
+   index_str << index;
+   string result = str;
+   while ( found != string::npos ) {
+      result.replace( found, 3, index_str.str() );
+      found = result.find( "{i}", found + index_str.str().length() );
+   }
+   return result;
+}
+
+bool get_bool( JSONValue const &entry, char const *key, bool const default_value, string const &context )
+{
+   JSONValue const *value = entry.find( key );
+   if ( value == NULL ) {
+      return default_value;
+   }
+   if ( value->type != JSONValue::JSON_BOOL ) {
+      terminate_in( context, string( "Member '" ) + key + "' must be true or false." );
+   }
+   return value->boolean;
+}
+
+double get_number( JSONValue const &entry, char const *key, double const default_value, string const &context )
+{
+   JSONValue const *value = entry.find( key );
+   if ( value == NULL ) {
+      return default_value;
+   }
+   if ( value->type != JSONValue::JSON_NUMBER ) {
+      terminate_in( context, string( "Member '" ) + key + "' must be a number." );
+   }
+   return value->number;
+}
+
+bool get_string( JSONValue const &entry, char const *key, int const index, string &str, string const &context )
+{
+   JSONValue const *value = entry.find( key );
+   if ( value == NULL ) {
+      return false;
+   }
+   if ( value->type != JSONValue::JSON_STRING ) {
+      terminate_in( context, string( "Member '" ) + key + "' must be a string." );
+   }
+   str = substitute_index( value->str, index );
+   return true;
+}
+
+string get_required_string( JSONValue const &entry, char const *key, int const index, string const &context )
+{
+   string str;
+   if ( !get_string( entry, key, index, str, context ) || str.empty() ) {
+      terminate_in( context, string( "Missing the required '" ) + key + "' member." );
+   }
+   return str;
+}
+
+// Look up an enumeration by name, where "config" values can combine names
+// with '+' or '|' such as "CONFIG_INITIALIZE+CONFIG_CYCLIC".
+int get_enum( JSONValue const &entry, char const *key, EnumName const *names, int const default_value, string const &context )
+{
+   JSONValue const *value = entry.find( key );
+   if ( value == NULL ) {
+      return default_value;
+   }
+   if ( value->type != JSONValue::JSON_STRING ) {
+      terminate_in( context, string( "Member '" ) + key + "' must be a string." );
+   }
+
+   int    result = 0;
+   string rest   = value->str;
+   while ( !rest.empty() ) {
+      size_t sep  = rest.find_first_of( "+|" );
+      string name = rest.substr( 0, sep );
+      rest        = ( sep == string::npos ) ? string() : rest.substr( sep + 1 );
+
+      // Trim the white space around the name.
+      size_t first = name.find_first_not_of( " \t" );
+      size_t last  = name.find_last_not_of( " \t" );
+      name         = ( first == string::npos ) ? string() : name.substr( first, last - first + 1 );
+
+      bool found = false;
+      for ( int k = 0; ( names[k].name != NULL ) && !found; ++k ) {
+         if ( name == names[k].name ) {
+            result |= names[k].value;
+            found = true;
+         }
+      }
+      if ( !found ) {
+         terminate_in( context, string( "Unknown '" ) + key + "' value '" + name + "'." );
+      }
+   }
+   return result;
+}
+
+template < class T >
+T *get_instance( JSONValue const &entry, char const *key, int const index,
+                 map< string, T * > const &registry, string const &context )
+{
+   string name;
+   if ( !get_string( entry, key, index, name, context ) ) {
+      return NULL;
+   }
+   typename map< string, T * >::const_iterator iter = registry.find( name );
+   if ( iter == registry.end() ) {
+      terminate_in( context, string( "The '" ) + key + "' instance '" + name
+                                + "' was not registered with the loader." );
+   }
+   return iter->second;
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+BulkConfigLoader::BulkConfigLoader()
+   : load_time( 0.0 ),
+     object_count( 0 ),
+     attribute_count( 0 ),
+     interaction_count( 0 ),
+     packings(),
+     lag_comps(),
+     conditionals(),
+     ownerships(),
+     deleteds(),
+     handlers(),
+     strings()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+BulkConfigLoader::~BulkConfigLoader()
+{
+   // The interned strings are owned by the Trick memory manager since the
+   // attributes keep pointing at them.
+   strings.clear();
+   return;
+}
+
+void BulkConfigLoader::register_packing(
+   char const *name,
+   Packing    *packing )
+{
+   if ( ( name != NULL ) && ( packing != NULL ) ) {
+      packings[name] = packing;
+   }
+}
+
+void BulkConfigLoader::register_lag_compensation(
+   char const      *name,
+   LagCompensation *lag_comp )
+{
+   if ( ( name != NULL ) && ( lag_comp != NULL ) ) {
+      lag_comps[name] = lag_comp;
+   }
+}
+
+void BulkConfigLoader::register_conditional(
+   char const  *name,
+   Conditional *conditional )
+{
+   if ( ( name != NULL ) && ( conditional != NULL ) ) {
+      conditionals[name] = conditional;
+   }
+}
+
+void BulkConfigLoader::register_ownership_handler(
+   char const       *name,
+   OwnershipHandler *ownership )
+{
+   if ( ( name != NULL ) && ( ownership != NULL ) ) {
+      ownerships[name] = ownership;
+   }
+}
+
+void BulkConfigLoader::register_object_deleted(
+   char const    *name,
+   ObjectDeleted *deleted )
+{
+   if ( ( name != NULL ) && ( deleted != NULL ) ) {
+      deleteds[name] = deleted;
+   }
+}
+
+void BulkConfigLoader::register_interaction_handler(
+   char const         *name,
+   InteractionHandler *handler )
+{
+   if ( ( name != NULL ) && ( handler != NULL ) ) {
+      handlers[name] = handler;
+   }
+}
+
+char *BulkConfigLoader::intern_string(
+   string const &str )
+{
+   map< string, char * >::const_iterator iter = strings.find( str );
+   if ( iter != strings.end() ) {
+      return iter->second;
+   }
+   char *trick_str = trick_MM->mm_strdup( str.c_str() );
+   strings[str]    = trick_str;
+   return trick_str;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void BulkConfigLoader::load(
+   char const *manifest_file,
+   Manager    &manager,
+   int const   extra_objects,
+   int const   extra_interactions )
+{
+   int64_t const start_time = MonotonicClock::get_time_micros();
+
+   load_time         = 0.0;
+   object_count      = 0;
+   attribute_count   = 0;
+   interaction_count = 0;
+
+   string const file_context = string( "Manifest '" )
+                               + ( ( manifest_file != NULL ) ? manifest_file : "NULL" ) + "'";
+
+   if ( ( manifest_file == NULL ) || ( *manifest_file == '\0' ) ) {
+      terminate_in( file_context, "No manifest file specified." );
+   }
+   if ( ( extra_objects < 0 ) || ( extra_interactions < 0 ) ) {
+      terminate_in( file_context, "The number of extra objects and interactions can not be negative." );
+   }
+
+   // Read and parse the whole manifest.
+   ifstream manifest( manifest_file );
+   if ( !manifest ) {
+      terminate_in( file_context, "Could not open the file." );
+   }
+   ostringstream contents;
+   contents << manifest.rdbuf();
+   string const text = contents.str();
+
+   JSONValue  root;
+   JSONParser parser( text );
+   if ( !parser.parse( root ) ) {
+      ostringstream msg;
+      msg << "JSON syntax error on line " << parser.get_line() << ", " << parser.get_error() << ".";
+      terminate_in( file_context, msg.str() );
+   }
+   if ( root.type != JSONValue::JSON_OBJECT ) {
+      terminate_in( file_context, "The manifest must be a JSON object." );
+   }
+
+   for ( unsigned int i = 0; i < root.keys.size(); ++i ) {
+      if ( ( root.keys[i] != "attribute_sets" )
+           && ( root.keys[i] != "objects" )
+           && ( root.keys[i] != "interactions" ) ) {
+         terminate_in( file_context, "Unknown member '" + root.keys[i] + "'." );
+      }
+   }
+
+   JSONValue const *attribute_sets = root.find( "attribute_sets" );
+   if ( ( attribute_sets != NULL ) && ( attribute_sets->type != JSONValue::JSON_OBJECT ) ) {
+      terminate_in( file_context, "The 'attribute_sets' member must be a JSON object." );
+   }
+
+   //
+   // Objects.
+   //
+   JSONValue const *objects = root.find( "objects" );
+   if ( objects != NULL ) {
+      if ( objects->type != JSONValue::JSON_ARRAY ) {
+         terminate_in( file_context, "The 'objects' member must be a JSON array." );
+      }
+      if ( ( manager.obj_count != 0 ) || ( manager.objects != NULL ) ) {
+         terminate_in( file_context, "The manager objects are already configured, "
+                                     "load() must be called before any objects are configured." );
+      }
+
+      // Count the objects including the repeated ones.
+      int total_objects = 0;
+      for ( unsigned int e = 0; e < objects->items.size(); ++e ) {
+         ostringstream context;
+         context << file_context << " objects[" << e << "]";
+         double count = get_number( objects->items[e], "count", 1.0, context.str() );
+         if ( ( count < 1.0 ) || ( count != static_cast< int >( count ) ) ) {
+            terminate_in( context.str(), "The 'count' must be a positive integer." );
+         }
+         total_objects += static_cast< int >( count );
+      }
+
+      manager.obj_count = total_objects + extra_objects;
+      manager.objects   = ( manager.obj_count > 0 )
+                             ? static_cast< Object * >( trick_MM->declare_var( "TrickHLA::Object", manager.obj_count ) )
+                             : NULL;
+
+      int obj_index = 0;
+      for ( unsigned int e = 0; e < objects->items.size(); ++e ) {
+         JSONValue const &entry = objects->items[e];
+
+         ostringstream entry_context;
+         entry_context << file_context << " objects[" << e << "]";
+         check_keys( entry, object_keys, entry_context.str() );
+
+         // The attributes are either inline or the name of an attribute set.
+         JSONValue const *attrs = entry.find( "attributes" );
+         if ( ( attrs != NULL ) && ( attrs->type == JSONValue::JSON_STRING ) ) {
+            JSONValue const *set = ( attribute_sets != NULL ) ? attribute_sets->find( attrs->str.c_str() ) : NULL;
+            if ( set == NULL ) {
+               terminate_in( entry_context.str(), "Unknown attribute set '" + attrs->str + "'." );
+            }
+            attrs = set;
+         }
+         if ( ( attrs != NULL ) && ( attrs->type != JSONValue::JSON_ARRAY ) ) {
+            terminate_in( entry_context.str(), "The 'attributes' must be a JSON array or an attribute set name." );
+         }
+
+         int const count = static_cast< int >( get_number( entry, "count", 1.0, entry_context.str() ) );
+         for ( int index = 0; index < count; ++index, ++obj_index ) {
+            Object &obj = manager.objects[obj_index];
+
+            string const context = entry_context.str();
+
+            obj.name                 = trick_MM->mm_strdup( get_required_string( entry, "name", index, context ).c_str() );
+            obj.FOM_name             = intern_string( get_required_string( entry, "FOM_name", index, context ) );
+            obj.create_HLA_instance  = get_bool( entry, "create", obj.create_HLA_instance, context );
+            obj.required             = get_bool( entry, "required", obj.required, context );
+            obj.name_required        = get_bool( entry, "name_required", obj.name_required, context );
+            obj.blocking_cyclic_read = get_bool( entry, "blocking_cyclic_read", obj.blocking_cyclic_read, context );
+
+            string thread_ids;
+            if ( get_string( entry, "thread_ids", index, thread_ids, context ) ) {
+               obj.thread_ids = intern_string( thread_ids );
+            }
+
+            obj.packing     = get_instance( entry, "packing", index, packings, context );
+            obj.lag_comp    = get_instance( entry, "lag_comp", index, lag_comps, context );
+            obj.conditional = get_instance( entry, "conditional", index, conditionals, context );
+            obj.ownership   = get_instance( entry, "ownership", index, ownerships, context );
+            obj.deleted     = get_instance( entry, "deleted", index, deleteds, context );
+
+            obj.lag_comp_type              = static_cast< LagCompensationEnum >( get_enum( entry, "lag_comp_type", lag_comp_names, obj.lag_comp_type, context ) );
+            obj.send_priority              = static_cast< SendPriorityEnum >( get_enum( entry, "send_priority", send_priority_names, obj.send_priority, context ) );
+            obj.reflection_conflation      = static_cast< ReflectionConflationEnum >( get_enum( entry, "reflection_conflation", conflation_names, obj.reflection_conflation, context ) );
+            obj.reflection_queue_policy    = static_cast< QueueOverflowPolicyEnum >( get_enum( entry, "reflection_queue_policy", overflow_names, obj.reflection_queue_policy, context ) );
+            obj.reflection_queue_max_depth = static_cast< int >( get_number( entry, "reflection_queue_max_depth", obj.reflection_queue_max_depth, context ) );
+
+            obj.attr_count = ( attrs != NULL ) ? attrs->items.size() : 0;
+            obj.attributes = ( obj.attr_count > 0 )
+                                ? static_cast< Attribute * >( trick_MM->declare_var( "TrickHLA::Attribute", obj.attr_count ) )
+                                : NULL;
+
+            for ( int a = 0; a < obj.attr_count; ++a ) {
+               JSONValue const &attr_entry = attrs->items[a];
+               Attribute       &attr       = obj.attributes[a];
+
+               ostringstream attr_context;
+               attr_context << context << " attributes[" << a << "]";
+               check_keys( attr_entry, attribute_keys, attr_context.str() );
+
+               attr.FOM_name        = intern_string( get_required_string( attr_entry, "FOM_name", index, attr_context.str() ) );
+               attr.trick_name      = trick_MM->mm_strdup( get_required_string( attr_entry, "trick_name", index, attr_context.str() ).c_str() );
+               attr.config          = static_cast< DataUpdateEnum >( get_enum( attr_entry, "config", config_names, attr.config, attr_context.str() ) );
+               attr.publish         = get_bool( attr_entry, "publish", attr.publish, attr_context.str() );
+               attr.subscribe       = get_bool( attr_entry, "subscribe", attr.subscribe, attr_context.str() );
+               attr.locally_owned   = get_bool( attr_entry, "locally_owned", attr.locally_owned, attr_context.str() );
+               attr.rti_encoding    = static_cast< EncodingEnum >( get_enum( attr_entry, "rti_encoding", encoding_names, attr.rti_encoding, attr_context.str() ) );
+               attr.cycle_time      = get_number( attr_entry, "cycle_time", attr.cycle_time, attr_context.str() );
+               attr.preferred_order = static_cast< TransportationEnum >( get_enum( attr_entry, "preferred_order", transport_names, attr.preferred_order, attr_context.str() ) );
+               attr.send_priority   = static_cast< SendPriorityEnum >( get_enum( attr_entry, "send_priority", send_priority_names, attr.send_priority, attr_context.str() ) );
+               attr.shared_memory   = get_bool( attr_entry, "shared_memory", attr.shared_memory, attr_context.str() );
+            }
+            attribute_count += obj.attr_count;
+         }
+      }
+      object_count = obj_index;
+   }
+
+   //
+   // Interactions.
+   //
+   JSONValue const *interactions = root.find( "interactions" );
+   if ( interactions != NULL ) {
+      if ( interactions->type != JSONValue::JSON_ARRAY ) {
+         terminate_in( file_context, "The 'interactions' member must be a JSON array." );
+      }
+      if ( ( manager.inter_count != 0 ) || ( manager.interactions != NULL ) ) {
+         terminate_in( file_context, "The manager interactions are already configured, "
+                                     "load() must be called before any interactions are configured." );
+      }
+
+      manager.inter_count  = interactions->items.size() + extra_interactions;
+      manager.interactions = ( manager.inter_count > 0 )
+                                ? static_cast< Interaction * >( trick_MM->declare_var( "TrickHLA::Interaction", manager.inter_count ) )
+                                : NULL;
+
+      for ( unsigned int e = 0; e < interactions->items.size(); ++e ) {
+         JSONValue const &entry = interactions->items[e];
+         Interaction     &inter = manager.interactions[e];
+
+         ostringstream context;
+         context << file_context << " interactions[" << e << "]";
+         check_keys( entry, interaction_keys, context.str() );
+
+         inter.FOM_name        = intern_string( get_required_string( entry, "FOM_name", 0, context.str() ) );
+         inter.publish         = get_bool( entry, "publish", inter.publish, context.str() );
+         inter.subscribe       = get_bool( entry, "subscribe", inter.subscribe, context.str() );
+         inter.preferred_order = static_cast< TransportationEnum >( get_enum( entry, "preferred_order", transport_names, inter.preferred_order, context.str() ) );
+         inter.handler         = get_instance( entry, "handler", 0, handlers, context.str() );
+
+         JSONValue const *params = entry.find( "parameters" );
+         if ( ( params != NULL ) && ( params->type != JSONValue::JSON_ARRAY ) ) {
+            terminate_in( context.str(), "The 'parameters' must be a JSON array." );
+         }
+         inter.param_count = ( params != NULL ) ? params->items.size() : 0;
+         inter.parameters  = ( inter.param_count > 0 )
+                                ? static_cast< Parameter * >( trick_MM->declare_var( "TrickHLA::Parameter", inter.param_count ) )
+                                : NULL;
+
+         for ( int p = 0; p < inter.param_count; ++p ) {
+            JSONValue const &param_entry = params->items[p];
+            Parameter       &param       = inter.parameters[p];
+
+            ostringstream param_context;
+            param_context << context.str() << " parameters[" << p << "]";
+            check_keys( param_entry, parameter_keys, param_context.str() );
+
+            param.FOM_name     = intern_string( get_required_string( param_entry, "FOM_name", 0, param_context.str() ) );
+            param.trick_name   = trick_MM->mm_strdup( get_required_string( param_entry, "trick_name", 0, param_context.str() ).c_str() );
+            param.rti_encoding = static_cast< EncodingEnum >( get_enum( param_entry, "rti_encoding", encoding_names, param.rti_encoding, param_context.str() ) );
+         }
+      }
+      interaction_count = interactions->items.size();
+   }
+
+   load_time = MonotonicClock::get_time_micros() - start_time;
+   load_time /= 1000000.0;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "BulkConfigLoader::load():%d Loaded %d objects with %d attributes and %d interactions from '%s' in %.6f seconds.%c",
+               __LINE__, object_count, attribute_count, interaction_count,
+               manifest_file, load_time, THLA_NEWLINE );
+   }
+}
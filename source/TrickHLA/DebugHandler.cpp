@@ -42,6 +42,12 @@ NASA, Johnson Space Center\n
 using namespace std;
 using namespace TrickHLA;
 
+namespace
+{
+// True for a thread that defers terminate_with_message() to another thread.
+thread_local bool defer_termination_on_thread = false;
+} // namespace
+
 // Initialize the DebugHandler level and code section values.
 DebugLevelEnum  DebugHandler::debug_level  = DEBUG_LEVEL_NO_TRACE;
 DebugSourceEnum DebugHandler::code_section = DEBUG_SOURCE_ALL_MODULES;
@@ -92,7 +98,17 @@ void DebugHandler::set(
 void DebugHandler::terminate_with_message(
    string const &message )
 {
+   if ( defer_termination_on_thread ) {
+      // Unwind the worker thread, which hands the message over.
+      throw DeferredTermination( message );
+   }
    send_hs( stderr, message.c_str() );
    exec_terminate( __FILE__, message.c_str() );
    exit( 1 );
 }
+
+void DebugHandler::set_defer_termination(
+   bool const defer )
+{
+   defer_termination_on_thread = defer;
+}
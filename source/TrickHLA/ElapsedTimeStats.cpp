@@ -17,6 +17,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{ElapsedTimeStats.cpp}
+@trick_link_dependency{MonotonicClock.cpp}
 
 @revs_title
 @revs_begin
@@ -31,11 +32,9 @@ NASA, Johnson Space Center\n
 #include <sstream>
 #include <string>
 
-// Trick include files.
-#include "trick/clock_proto.h"
-
 // TrickHLA include files.
 #include "TrickHLA/ElapsedTimeStats.hh"
+#include "TrickHLA/MonotonicClock.hh"
 
 using namespace std;
 using namespace TrickHLA;
@@ -69,7 +68,7 @@ ElapsedTimeStats::~ElapsedTimeStats()
  */
 void ElapsedTimeStats::measure()
 {
-   int64_t time = clock_wall_time(); // in microseconds
+   int64_t time = MonotonicClock::get_time_micros(); // in microseconds
    if ( first_pass ) {
       first_pass = false;
    } else {
@@ -34,6 +34,7 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <cerrno>
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
@@ -41,6 +42,7 @@ NASA, Johnson Space Center\n
 #include <math.h>
 #include <sstream>
 #include <string>
+#include <time.h>
 
 // Trick includes.
 #include "trick/Executive.hh"
@@ -91,6 +93,7 @@ ExecutionControlBase::ExecutionControlBase()
      use_preset_master( false ),
      master( false ),
      multiphase_init_sync_points( NULL ),
+     cte_spin_margin( 0.002 ),
      time_padding( 2.0 ),
      least_common_time_step_seconds( -1.0 ),
      least_common_time_step( -1 ),
@@ -104,6 +107,12 @@ ExecutionControlBase::ExecutionControlBase()
      next_mode_cte_time( -std::numeric_limits< double >::max() ),
      simulation_freeze_time( 0.0 ),
      scenario_freeze_time( 0.0 ),
+     mode_transition_error( 0.0 ),
+     mode_transition_error_max( 0.0 ),
+     mode_transition_count( 0 ),
+     freeze_transition_error( 0.0 ),
+     freeze_transition_error_max( 0.0 ),
+     freeze_transition_count( 0 ),
      late_joiner( false ),
      late_joiner_determined( false ),
      federate( NULL ),
@@ -125,6 +134,7 @@ ExecutionControlBase::ExecutionControlBase(
      use_preset_master( false ),
      master( false ),
      multiphase_init_sync_points( NULL ),
+     cte_spin_margin( 0.002 ),
      time_padding( 2.0 ),
      least_common_time_step_seconds( -1.0 ),
      least_common_time_step( -1 ),
@@ -138,6 +148,12 @@ ExecutionControlBase::ExecutionControlBase(
      next_mode_cte_time( -std::numeric_limits< double >::max() ),
      simulation_freeze_time( 0.0 ),
      scenario_freeze_time( 0.0 ),
+     mode_transition_error( 0.0 ),
+     mode_transition_error_max( 0.0 ),
+     mode_transition_count( 0 ),
+     freeze_transition_error( 0.0 ),
+     freeze_transition_error_max( 0.0 ),
+     freeze_transition_count( 0 ),
      late_joiner( false ),
      late_joiner_determined( false ),
      federate( NULL ),
@@ -886,6 +902,96 @@ double ExecutionControlBase::get_cte_time()
    return -std::numeric_limits< double >::max();
 }
 
+/*!
+ * @details The wait sleeps with clock_nanosleep() on an absolute monotonic
+ * deadline computed from the remaining CTE time, in steps of at most one
+ * second so that a shutdown is still detected, until cte_spin_margin before
+ * the transition time. It then spins on the CTE clock for the rest of the
+ * wait, which keeps the start error to the resolution of the CTE clock
+ * without burning a core for the whole wait.
+ */
+double ExecutionControlBase::wait_for_cte_time(
+   double const cte_time,
+   char const  *transition_name )
+{
+   double remaining = cte_time - get_cte_time();
+   double prev_secs = floor( remaining );
+
+   while ( remaining > this->cte_spin_margin ) {
+
+      // Check for shutdown.
+      federate->check_for_shutdown_with_termination();
+
+      if ( floor( remaining ) != prev_secs ) {
+         prev_secs = floor( remaining );
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_EXECUTION_CONTROL ) ) {
+            send_hs( stdout, "ExecutionControlBase::wait_for_cte_time():%d Going to %s in %G seconds.%c",
+                     __LINE__, transition_name, remaining, THLA_NEWLINE );
+         }
+      }
+
+      double sleep_time = remaining - this->cte_spin_margin;
+      if ( sleep_time > 1.0 ) {
+         sleep_time = 1.0;
+      }
+
+      struct timespec deadline;
+      clock_gettime( CLOCK_MONOTONIC, &deadline );
+      deadline.tv_sec += (time_t)sleep_time;
+      deadline.tv_nsec += (long)( ( sleep_time - floor( sleep_time ) ) * 1000000000.0 );
+      if ( deadline.tv_nsec >= 1000000000L ) {
+         deadline.tv_nsec -= 1000000000L;
+         ++deadline.tv_sec;
+      }
+      while ( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL ) == EINTR ) {
+         // Resume the sleep if interrupted by a signal.
+      }
+
+      remaining = cte_time - get_cte_time();
+   }
+
+   // Spin on the CTE clock for the last part of the wait.
+   double curr_cte_time = get_cte_time();
+   while ( curr_cte_time < cte_time ) {
+      curr_cte_time = get_cte_time();
+   }
+
+   double const start_error = curr_cte_time - cte_time;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_EXECUTION_CONTROL ) ) {
+      send_hs( stdout, "ExecutionControlBase::wait_for_cte_time():%d \n  Going to %s at CTE time %.18G seconds. \n  Current CTE time %.18G seconds. \n  Start error: %.3lf microseconds.%c",
+               __LINE__, transition_name, cte_time, curr_cte_time,
+               start_error * 1000000.0, THLA_NEWLINE );
+   }
+
+   return start_error;
+}
+
+void ExecutionControlBase::record_mode_transition_error(
+   double const error )
+{
+   this->mode_transition_error = error;
+   if ( fabs( this->mode_transition_error ) > fabs( this->mode_transition_error_max ) ) {
+      this->mode_transition_error_max = this->mode_transition_error;
+   }
+   ++this->mode_transition_count;
+}
+
+/*!
+ * @details Every federate waits for the same CTE freeze time on its own, so
+ * this error only measures how late this federate's wait ended. It does not
+ * control the skew between the federates entering freeze.
+ */
+void ExecutionControlBase::record_freeze_transition_error(
+   double const error )
+{
+   this->freeze_transition_error = error;
+   if ( fabs( this->freeze_transition_error ) > fabs( this->freeze_transition_error_max ) ) {
+      this->freeze_transition_error_max = this->freeze_transition_error;
+   }
+   ++this->freeze_transition_count;
+}
+
 void ExecutionControlBase::clear_mode_values()
 {
    this->mode_transition_requested        = false;
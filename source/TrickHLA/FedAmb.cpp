@@ -639,7 +639,10 @@ void FedAmb::reflectAttributeValues(
 
       // Pass the attribute values off to the object.
 #if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
-      trickhla_obj->enqueue_data( (AttributeHandleValueMap &)theAttributeValues );
+      Int64Time reflect_time;
+      reflect_time.set( theTime );
+      trickhla_obj->enqueue_data( (AttributeHandleValueMap &)theAttributeValues,
+                                  reflect_time.get_base_time() );
 #else
       trickhla_obj->extract_data( (AttributeHandleValueMap &)theAttributeValues );
 #endif
@@ -681,7 +684,10 @@ void FedAmb::reflectAttributeValues(
 
       // Pass the attribute values off to the object.
 #if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
-      trickhla_obj->enqueue_data( (AttributeHandleValueMap &)theAttributeValues );
+      Int64Time reflect_time;
+      reflect_time.set( theTime );
+      trickhla_obj->enqueue_data( (AttributeHandleValueMap &)theAttributeValues,
+                                  reflect_time.get_base_time() );
 #else
       trickhla_obj->extract_data( (AttributeHandleValueMap &)theAttributeValues );
 #endif
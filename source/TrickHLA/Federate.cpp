@@ -19,8 +19,10 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{ExecutionControlBase.cpp}
 @trick_link_dependency{FedAmb.cpp}
 @trick_link_dependency{Federate.cpp}
+@trick_link_dependency{GALTMonitor.cpp}
 @trick_link_dependency{Int64BaseTime.cpp}
 @trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MonotonicClock.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
@@ -76,8 +78,10 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/ExecutionControlBase.hh"
 #include "TrickHLA/FedAmb.hh"
 #include "TrickHLA/Federate.hh"
+#include "TrickHLA/GALTMonitor.hh"
 #include "TrickHLA/Int64BaseTime.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/MonotonicClock.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/SleepTimeout.hh"
@@ -186,6 +190,7 @@ Federate::Federate()
      time_adv_state_mutex(),
      granted_time( 0.0 ),
      requested_time( 0.0 ),
+     tag_wait_time( 0LL ),
      HLA_time( 0.0 ),
      start_to_save( false ),
      start_to_restore( false ),
@@ -210,6 +215,15 @@ Federate::Federate()
      joined_federate_name_map(),
      joined_federate_handles(),
      joined_federate_names(),
+     MOM_time_state_available( false ),
+     MOM_HLAtimeRegulating_handle(),
+     MOM_HLAtimeConstrained_handle(),
+     MOM_HLAtimeManagerState_handle(),
+     MOM_HLAlogicalTime_handle(),
+     MOM_HLAlookahead_handle(),
+     MOM_HLAGALT_handle(),
+     MOM_HLALITS_handle(),
+     galt_monitor( NULL ),
      thread_coordinator(),
      RTI_ambassador( NULL ),
      federate_ambassador( NULL ),
@@ -500,6 +514,10 @@ void Federate::initialize()
                __LINE__, name, type, THLA_NEWLINE );
    }
 
+   // Calibrate the monotonic clock now so that the first timed wait does
+   // not pay for the calibration.
+   MonotonicClock::initialize();
+
    // Determine if the Trick time Tic resolution can support the HLA base time.
    if ( exec_get_time_tic_value() < Int64BaseTime::get_base_time_multiplier() ) {
       ostringstream errmsg;
@@ -920,6 +938,11 @@ void Federate::set_MOM_HLAfederate_instance_attributes(
    ObjectInstanceHandle           id,
    AttributeHandleValueMap const &values )
 {
+   // Pass any time state on to the GALT monitor.
+   if ( galt_monitor != NULL ) {
+      set_MOM_HLAfederate_time_state( id, values );
+   }
+
    // Concurrency critical code section because joined-federate state used by
    // the blocking Federate::wait_for_required_federates_to_join() function.
    //
@@ -1953,6 +1976,43 @@ RTIinternalError for RTI_amb->getParameterHandle(MOM_HLAsetSwitches_class_handle
    if ( error_flag ) {
       DebugHandler::terminate_with_message( "Federate::initialize_MOM_handles() ERROR Detected!" );
    }
+
+   // The time state is optional and only used for the GALT monitor.
+   initialize_MOM_time_state_handles();
+}
+
+void Federate::initialize_MOM_time_state_handles()
+{
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   // Object: HLAmanager.HLAfederate
+   //   Attributes: HLAtimeConstrained and HLAtimeRegulating of type HLAboolean,
+   //   HLAtimeManagerState of type HLAtimeState, and HLAlogicalTime,
+   //   HLAlookahead, HLAGALT and HLALITS of type HLAmsec which are encoded
+   //   as HLAopaqueData holding the encoded logical time or interval.
+   try {
+      this->MOM_HLAtimeRegulating_handle   = RTI_ambassador->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAtimeRegulating" );
+      this->MOM_HLAtimeConstrained_handle  = RTI_ambassador->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAtimeConstrained" );
+      this->MOM_HLAtimeManagerState_handle = RTI_ambassador->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAtimeManagerState" );
+      this->MOM_HLAlogicalTime_handle      = RTI_ambassador->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAlogicalTime" );
+      this->MOM_HLAlookahead_handle        = RTI_ambassador->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAlookahead" );
+      this->MOM_HLAGALT_handle             = RTI_ambassador->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAGALT" );
+      this->MOM_HLALITS_handle             = RTI_ambassador->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLALITS" );
+      this->MOM_time_state_available       = true;
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      this->MOM_time_state_available = false;
+
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      send_hs( stderr, "Federate::initialize_MOM_time_state_handles():%d \
+WARNING: The MOM HLAfederate time state attributes are not available: %s%c",
+               __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
 void Federate::subscribe_attributes(
@@ -2205,6 +2265,217 @@ void Federate::unsubscribe_all_HLAfederate_class_attributes_from_MOM()
    // Macro to restore the saved FPU Control Word register value.
    TRICKHLA_RESTORE_FPU_CONTROL_WORD;
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   // The GALT monitor still needs the time state of the federates.
+   if ( galt_monitor != NULL ) {
+      subscribe_MOM_HLAfederate_time_state();
+   }
+}
+
+void Federate::subscribe_MOM_HLAfederate_time_state()
+{
+   // Make sure the MOM handles get initialized before we try to use them.
+   if ( !MOM_HLAfederateName_handle.isValid() ) {
+      initialize_MOM_handles();
+   }
+   if ( !MOM_time_state_available ) {
+      return;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::subscribe_MOM_HLAfederate_time_state():%d%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   // The federate name and handle are included so that the time state can be
+   // associated with a federate name after the required federates joined.
+   AttributeHandleSet fedMomAttributes;
+   fedMomAttributes.insert( MOM_HLAfederateName_handle );
+   fedMomAttributes.insert( MOM_HLAfederate_handle );
+   fedMomAttributes.insert( MOM_HLAtimeRegulating_handle );
+   fedMomAttributes.insert( MOM_HLAtimeConstrained_handle );
+   fedMomAttributes.insert( MOM_HLAtimeManagerState_handle );
+   fedMomAttributes.insert( MOM_HLAlogicalTime_handle );
+   fedMomAttributes.insert( MOM_HLAlookahead_handle );
+   fedMomAttributes.insert( MOM_HLAGALT_handle );
+   fedMomAttributes.insert( MOM_HLALITS_handle );
+   subscribe_attributes( MOM_HLAfederate_class_handle, fedMomAttributes );
+}
+
+void Federate::request_MOM_HLAfederate_time_state()
+{
+   // Do not request updates during a save or restore.
+   if ( !MOM_time_state_available || !should_publish_data() ) {
+      return;
+   }
+
+   AttributeHandleSet requestedAttributes;
+   requestedAttributes.insert( MOM_HLAtimeRegulating_handle );
+   requestedAttributes.insert( MOM_HLAtimeConstrained_handle );
+   requestedAttributes.insert( MOM_HLAtimeManagerState_handle );
+   requestedAttributes.insert( MOM_HLAlogicalTime_handle );
+   requestedAttributes.insert( MOM_HLAlookahead_handle );
+   requestedAttributes.insert( MOM_HLAGALT_handle );
+   requestedAttributes.insert( MOM_HLALITS_handle );
+   request_attribute_update( MOM_HLAfederate_class_handle, requestedAttributes );
+}
+
+/*!
+ * @details The tables change in many places as federates join and resign,
+ * so they are sized when sampled instead of tracked per allocation. The
+ * estimate is the entries, their names and the map node overhead.
+ * @job_class{logging}
+ */
+size_t Federate::get_MOM_memory_size(
+   int64_t &entries )
+{
+   size_t const node_size = 4 * sizeof( void * );
+   size_t       bytes     = 0;
+
+   TrickHLAObjInstanceNameMap const *const name_maps[] = {
+      &mom_HLAfederation_instance_name_map,
+      &mom_HLAfederate_inst_name_map,
+      &joined_federate_name_map };
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &joined_federate_mutex );
+
+   entries = 0;
+   for ( size_t m = 0; m < ( sizeof( name_maps ) / sizeof( name_maps[0] ) ); ++m ) {
+      TrickHLAObjInstanceNameMap::const_iterator iter;
+      for ( iter = name_maps[m]->begin(); iter != name_maps[m]->end(); ++iter ) {
+         bytes += sizeof( TrickHLAObjInstanceNameMap::value_type ) + node_size
+                  + ( iter->second.capacity() * sizeof( wchar_t ) );
+      }
+      entries += (int64_t)name_maps[m]->size();
+   }
+
+   bytes += joined_federate_handles.size() * ( sizeof( FederateHandle ) + node_size );
+   entries += (int64_t)joined_federate_handles.size();
+
+   for ( size_t i = 0; i < joined_federate_names.size(); ++i ) {
+      bytes += sizeof( wstring ) + ( joined_federate_names[i].capacity() * sizeof( wchar_t ) );
+   }
+   entries += (int64_t)joined_federate_names.size();
+
+   return bytes;
+}
+
+/*!
+ * @details The HLAboolean and HLAtimeState values are HLAinteger32BE
+ * enumerations, and the logical time values are HLAopaqueData holding the
+ * HLAinteger64BE encoded HLAinteger64Time or HLAinteger64Interval.
+ */
+void Federate::set_MOM_HLAfederate_time_state(
+   ObjectInstanceHandle           instance_hndl,
+   AttributeHandleValueMap const &values )
+{
+   if ( ( galt_monitor == NULL ) || !MOM_time_state_available ) {
+      return;
+   }
+
+   GALTFederateState state;
+
+   AttributeHandleValueMap::const_iterator attr_iter;
+   for ( attr_iter = values.begin(); attr_iter != values.end(); ++attr_iter ) {
+
+      unsigned char const *data = static_cast< unsigned char const * >( attr_iter->second.data() );
+      size_t const         size = attr_iter->second.size();
+
+      if ( ( attr_iter->first == MOM_HLAtimeRegulating_handle )
+           || ( attr_iter->first == MOM_HLAtimeConstrained_handle )
+           || ( attr_iter->first == MOM_HLAtimeManagerState_handle ) ) {
+
+         if ( size != 4 ) {
+            continue;
+         }
+         int32_t const value = ( (int32_t)data[0] << 24 ) | ( (int32_t)data[1] << 16 )
+                               | ( (int32_t)data[2] << 8 ) | (int32_t)data[3];
+
+         if ( attr_iter->first == MOM_HLAtimeRegulating_handle ) {
+            state.time_regulating = ( value != 0 );
+            state.fields |= THLA_GALT_REGULATING;
+         } else if ( attr_iter->first == MOM_HLAtimeConstrained_handle ) {
+            state.time_constrained = ( value != 0 );
+            state.fields |= THLA_GALT_CONSTRAINED;
+         } else {
+            // HLAtimeGranted = 0, HLAtimeAdvancing = 1
+            state.time_advancing = ( value == 1 );
+            state.fields |= THLA_GALT_ADVANCING;
+         }
+
+      } else if ( ( attr_iter->first == MOM_HLAlogicalTime_handle )
+                  || ( attr_iter->first == MOM_HLAlookahead_handle )
+                  || ( attr_iter->first == MOM_HLAGALT_handle )
+                  || ( attr_iter->first == MOM_HLALITS_handle ) ) {
+
+         // Skip the HLAopaqueData element count if present. An empty value
+         // means the time is not defined, such as GALT for a federate that
+         // is not time constrained.
+         if ( size == 12 ) {
+            data += 4;
+         } else if ( size != 8 ) {
+            continue;
+         }
+         int64_t value = 0;
+         for ( int i = 0; i < 8; ++i ) {
+            value = ( value << 8 ) | (int64_t)data[i];
+         }
+
+         if ( attr_iter->first == MOM_HLAlogicalTime_handle ) {
+            state.logical_time = value;
+            state.fields |= THLA_GALT_LOGICAL_TIME;
+         } else if ( attr_iter->first == MOM_HLAlookahead_handle ) {
+            state.lookahead = value;
+            state.fields |= THLA_GALT_LOOKAHEAD;
+         } else if ( attr_iter->first == MOM_HLAGALT_handle ) {
+            state.GALT = value;
+            state.fields |= THLA_GALT_GALT;
+         } else {
+            state.LITS = value;
+            state.fields |= THLA_GALT_LITS;
+         }
+      }
+   }
+
+   if ( state.fields != 0 ) {
+      galt_monitor->update_federate_state( get_MOM_HLAfederate_name( instance_hndl ), state );
+   }
+}
+
+string Federate::get_MOM_HLAfederate_name(
+   ObjectInstanceHandle instance_hndl )
+{
+   string name;
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &joined_federate_mutex );
+
+   TrickHLAObjInstanceNameMap::const_iterator iter = joined_federate_name_map.find( instance_hndl );
+   if ( ( iter != joined_federate_name_map.end() ) && !iter->second.empty() ) {
+      StringUtilities::to_string( name, iter->second );
+      return name;
+   }
+
+   // Fall back to the MOM instance name, which the running federates map to
+   // the federate name.
+   iter = mom_HLAfederate_inst_name_map.find( instance_hndl );
+   if ( iter != mom_HLAfederate_inst_name_map.end() ) {
+      StringUtilities::to_string( name, iter->second );
+      for ( int i = 0; i < running_feds_count; ++i ) {
+         if ( ( running_feds[i].MOM_instance_name != NULL )
+              && ( running_feds[i].name != NULL )
+              && ( name == running_feds[i].MOM_instance_name ) ) {
+            return string( running_feds[i].name );
+         }
+      }
+      return name;
+   }
+
+   StringUtilities::to_string( name, instance_hndl );
+   return name;
 }
 
 void Federate::unsubscribe_all_HLAfederation_class_attributes_from_MOM()
@@ -4653,6 +4924,10 @@ void Federate::perform_time_advance_request()
       return;
    }
 
+   // The updates queued for the sender thread must reach the RTI before we
+   // request the time advance, otherwise they would be sent late (TSO).
+   this->manager->flush_async_send();
+
    // -- start of checkpoint additions --
    this->save_completed = false; // reset ONLY at the bottom of the frame...
    // -- end of checkpoint additions --
@@ -4815,6 +5090,10 @@ void Federate::wait_for_zero_lookahead_TARA_TAG()
       return;
    }
 
+   // The updates queued for the sender thread must reach the RTI before we
+   // request the time advance, otherwise they would be sent late (TSO).
+   this->manager->flush_async_send();
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -4988,6 +5267,30 @@ void Federate::verify_trick_child_thread_associations()
    this->thread_coordinator.verify_trick_thread_associations();
 }
 
+/*!
+ * @brief Enable the Trick child threads to pack and send the data for the
+ * objects they own.
+ */
+void Federate::enable_child_thread_send(
+   bool const enable )
+{
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::enable_child_thread_send():%d Child thread send:%s%c",
+               __LINE__, ( enable ? "Yes" : "No" ), THLA_NEWLINE );
+   }
+
+   // Delegate to the Trick thread coordinator.
+   this->thread_coordinator.enable_child_thread_send( enable );
+}
+
+/*! @brief Get the ID of the Trick thread that sends the data for the object. */
+unsigned int Federate::get_send_thread_id_for_obj(
+   unsigned int const obj_index ) const
+{
+   // Delegate to the Trick thread coordinator.
+   return this->thread_coordinator.get_send_thread_id_for_obj( obj_index );
+}
+
 /*!
  * @brief Announce all the HLA data was sent.
  */
@@ -5217,6 +5520,8 @@ void Federate::wait_for_time_advance_grant()
       SleepTimeout print_timer( this->wait_status_time );
       SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
 
+      int64_t const wait_start_time = sleep_timer.time();
+
       // This spin lock waits for the time advance grant from the RTI.
       do {
          // Check for shutdown.
@@ -5258,6 +5563,8 @@ void Federate::wait_for_time_advance_grant()
             }
          }
       } while ( state != TIME_ADVANCE_GRANTED );
+
+      this->tag_wait_time += sleep_timer.time() - wait_start_time;
    }
 
    // Add the line number for a higher trace level.
@@ -5305,6 +5612,19 @@ void Federate::shutdown()
          send_hs( stdout, "Federate::shutdown():%d %c", __LINE__, THLA_NEWLINE );
       }
 
+      // Send any interactions still queued in the Trick thread outboxes.
+      this->manager->flush_interaction_outboxes();
+      if ( this->manager->get_outbox_overflow_count() > 0 ) {
+         send_hs( stderr, "Federate::shutdown():%d WARNING: %llu interaction \
+sends were dropped because an outbox was full, consider increasing the \
+'interaction_outbox_size' of %d.%c",
+                  __LINE__, this->manager->get_outbox_overflow_count(),
+                  this->manager->interaction_outbox_size, THLA_NEWLINE );
+      }
+
+      // Send any updates still queued for the sender thread before we resign.
+      this->manager->stop_async_send();
+
 #ifdef THLA_CHECK_SEND_AND_RECEIVE_COUNTS
       for ( unsigned int i = 0; i < this->manager->obj_count; ++i ) {
          ostringstream msg;
@@ -5317,6 +5637,33 @@ void Federate::shutdown()
       }
 #endif
 
+#if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
+      for ( unsigned int i = 0; i < this->manager->obj_count; ++i ) {
+         if ( this->manager->objects[i].get_reflection_conflated_count() > 0 ) {
+            ostringstream msg;
+            msg << "Federate::shutdown():" << __LINE__
+                << " Object[" << i << "]:'" << this->manager->objects[i].get_name() << "'"
+                << " conflated reflections:" << this->manager->objects[i].get_reflection_conflated_count()
+                << " replaced attribute values:" << this->manager->objects[i].get_reflection_conflated_attribute_count()
+                << endl;
+            send_hs( stdout, msg.str().c_str() );
+         }
+      }
+#endif
+
+      if ( this->manager->is_send_degradation_enabled() ) {
+         for ( unsigned int i = 0; i < this->manager->obj_count; ++i ) {
+            if ( this->manager->objects[i].get_dropped_send_count() > 0 ) {
+               ostringstream msg;
+               msg << "Federate::shutdown():" << __LINE__
+                   << " Object[" << i << "]:'" << this->manager->objects[i].get_name() << "'"
+                   << " attribute sends dropped by send rate degradation:"
+                   << this->manager->objects[i].get_dropped_send_count() << endl;
+               send_hs( stdout, msg.str().c_str() );
+            }
+         }
+      }
+
 #ifdef THLA_CYCLIC_READ_TIME_STATS
       for ( unsigned int i = 0; i < this->manager->obj_count; ++i ) {
          ostringstream msg;
@@ -0,0 +1,280 @@
+/*!
+@file TrickHLA/FederateMetrics.cpp
+@ingroup TrickHLA
+@brief This class samples the performance metrics of this federate and packs
+them into a TrickHLA Object so they can be published to the federation.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{Federate.cpp}
+@trick_link_dependency{FederateMetrics.cpp}
+@trick_link_dependency{Int64Time.cpp}
+@trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MonotonicClock.cpp}
+@trick_link_dependency{Object.cpp}
+@trick_link_dependency{Packing.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/MemoryManager.hh"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/ExecutionControlBase.hh"
+#include "TrickHLA/Federate.hh"
+#include "TrickHLA/FederateMetrics.hh"
+#include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/MonotonicClock.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/Packing.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+FederateMetrics::FederateMetrics()
+   : Packing(),
+     federate_name( NULL ),
+     granted_time( 0.0 ),
+     frame_time( 0.0 ),
+     frame_time_max( 0.0 ),
+     tag_wait_time( 0.0 ),
+     pack_time( 0.0 ),
+     unpack_time( 0.0 ),
+     send_rate( 0.0 ),
+     receive_rate( 0.0 ),
+     reflection_queue_depth( 0 ),
+     interaction_queue_depth( 0 ),
+     total_overrun_count( 0 ),
+     mode_transition_error( 0.0 ),
+     federate( NULL ),
+     manager( NULL ),
+     data_cycle( 0.0 ),
+     frame_start_wall_time( 0 ),
+     period_start_wall_time( 0 ),
+     period_frame_time( 0 ),
+     period_frame_time_max( 0 ),
+     period_frame_count( 0 ),
+     prev_tag_wait_time( 0 ),
+     prev_pack_time( 0 ),
+     prev_unpack_time( 0 ),
+     prev_bytes_sent( 0 ),
+     prev_bytes_received( 0 ),
+     update_wall_time( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+FederateMetrics::~FederateMetrics()
+{
+   if ( federate_name != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( federate_name ) ) ) {
+         send_hs( stderr, "TrickHLA::FederateMetrics::~FederateMetrics():%d ERROR deleting Trick Memory for 'federate_name'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      federate_name = NULL;
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void FederateMetrics::configure(
+   Federate    *fed,
+   Manager     *mgr,
+   double const data_cycle )
+{
+   this->federate   = fed;
+   this->manager    = mgr;
+   this->data_cycle = data_cycle;
+
+   // Have the objects collect their pack, unpack and byte count metrics.
+   if ( this->manager != NULL ) {
+      this->manager->set_collect_metrics( true );
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void FederateMetrics::initialize()
+{
+   // Only the locally published metrics are sampled, and those instantiated
+   // from an ObjectTemplate for remote federates will not be configured.
+   if ( this->federate != NULL ) {
+      if ( ( this->federate->get_federate_name() == NULL )
+           || ( *( this->federate->get_federate_name() ) == '\0' ) ) {
+         ostringstream errmsg;
+         errmsg << "FederateMetrics::initialize():" << __LINE__
+                << " ERROR: Unexpected NULL federate name!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+      if ( this->data_cycle <= 0.0 ) {
+         ostringstream errmsg;
+         errmsg << "FederateMetrics::initialize():" << __LINE__
+                << " ERROR: The data cycle time (" << this->data_cycle
+                << " seconds) must be greater than zero!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+      this->federate_name = allocate_input_string( this->federate->get_federate_name() );
+   }
+
+   // Mark this as initialized.
+   Packing::initialize();
+}
+
+/*!
+ * @details The frame time is measured as the wall clock time between
+ * successive calls, so it includes the time waiting for the Time Advance
+ * Grant as well as any time the executive spent waiting for real-time.
+ * @job_class{scheduled}
+ */
+void FederateMetrics::sample()
+{
+   int64_t const wall_time = MonotonicClock::get_time_micros();
+
+   if ( this->frame_start_wall_time != 0 ) {
+      int64_t const frame_wall_time = wall_time - this->frame_start_wall_time;
+
+      this->period_frame_time += frame_wall_time;
+      if ( frame_wall_time > this->period_frame_time_max ) {
+         this->period_frame_time_max = frame_wall_time;
+      }
+      ++this->period_frame_count;
+
+      if ( (double)frame_wall_time > ( this->data_cycle * 1000000.0 ) ) {
+         ++this->total_overrun_count;
+      }
+   } else {
+      this->period_start_wall_time = wall_time;
+   }
+   this->frame_start_wall_time = wall_time;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void FederateMetrics::pack()
+{
+   if ( !initialized ) {
+      send_hs( stderr, "TrickHLA::FederateMetrics::pack():%d ERROR: The initialize() function has not been called!%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   if ( ( this->federate == NULL ) || ( this->manager == NULL ) ) {
+      return;
+   }
+
+   int64_t const wall_time    = MonotonicClock::get_time_micros();
+   double const  period_time  = (double)( wall_time - this->period_start_wall_time ) / 1000000.0;
+   double const  frame_count  = ( this->period_frame_count > 0 ) ? (double)this->period_frame_count : 1.0;
+   int64_t const fed_tag_wait = this->federate->get_tag_wait_time();
+
+   // Sum the metrics across all the objects.
+   int64_t            obj_pack_time      = 0;
+   int64_t            obj_unpack_time    = 0;
+   unsigned long long obj_bytes_sent     = 0;
+   unsigned long long obj_bytes_received = 0;
+   int                rfl_queue_depth    = 0;
+
+   Object *objects   = this->manager->get_objects();
+   int     obj_count = this->manager->get_object_count();
+   for ( int n = 0; n < obj_count; ++n ) {
+      obj_pack_time += objects[n].pack_time;
+      obj_unpack_time += objects[n].unpack_time;
+      obj_bytes_sent += objects[n].bytes_sent;
+      obj_bytes_received += objects[n].get_bytes_received();
+      rfl_queue_depth += objects[n].get_reflection_queue_depth();
+   }
+
+   this->granted_time   = this->federate->get_granted_time().get_time_in_seconds();
+   this->frame_time     = (double)this->period_frame_time / ( frame_count * 1000000.0 );
+   this->frame_time_max = (double)this->period_frame_time_max / 1000000.0;
+   this->tag_wait_time  = (double)( fed_tag_wait - this->prev_tag_wait_time ) / ( frame_count * 1000000.0 );
+   this->pack_time      = (double)( obj_pack_time - this->prev_pack_time ) / ( frame_count * 1000000.0 );
+   this->unpack_time    = (double)( obj_unpack_time - this->prev_unpack_time ) / ( frame_count * 1000000.0 );
+   if ( period_time > 0.0 ) {
+      this->send_rate    = (double)( obj_bytes_sent - this->prev_bytes_sent ) / period_time;
+      this->receive_rate = (double)( obj_bytes_received - this->prev_bytes_received ) / period_time;
+   }
+   this->reflection_queue_depth  = rfl_queue_depth;
+   this->interaction_queue_depth = this->manager->get_interactions_queue_size();
+   if ( this->federate->get_execution_control() != NULL ) {
+      this->mode_transition_error = this->federate->get_execution_control()->get_mode_transition_error();
+   }
+
+   // Start the next period.
+   this->period_start_wall_time = wall_time;
+   this->period_frame_time      = 0;
+   this->period_frame_time_max  = 0;
+   this->period_frame_count     = 0;
+   this->prev_tag_wait_time     = fed_tag_wait;
+   this->prev_pack_time         = obj_pack_time;
+   this->prev_unpack_time       = obj_unpack_time;
+   this->prev_bytes_sent        = obj_bytes_sent;
+   this->prev_bytes_received    = obj_bytes_received;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void FederateMetrics::unpack()
+{
+   if ( !initialized ) {
+      send_hs( stderr, "TrickHLA::FederateMetrics::unpack():%d ERROR: The initialize() function has not been called!%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   // The metrics are unpacked directly into the published variables, so
+   // just record when the last update was received.
+   this->update_wall_time = MonotonicClock::get_time_micros();
+}
+
+/*!
+ * @job_class{initialization}
+ */
+Packing *FederateMetrics::create_template_instance(
+   char const *instance_name )
+{
+   string decl_str = string( "TrickHLA::FederateMetrics " ) + instance_name;
+
+   FederateMetrics *inst = static_cast< FederateMetrics * >( trick_MM->declare_var( decl_str.c_str() ) );
+   if ( inst == NULL ) {
+      send_hs( stderr, "TrickHLA::FederateMetrics::create_template_instance():%d ERROR allocating Trick Memory for '%s'%c",
+               __LINE__, instance_name, THLA_NEWLINE );
+      return NULL;
+   }
+
+   inst->initialize();
+
+   return inst;
+}
@@ -0,0 +1,222 @@
+/*!
+@file TrickHLA/FederateMetricsMonitor.cpp
+@ingroup TrickHLA
+@brief This class prints and optionally records a live table of the
+performance metrics published by the federates in the federation.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{FederateMetrics.cpp}
+@trick_link_dependency{FederateMetricsMonitor.cpp}
+@trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MonotonicClock.cpp}
+@trick_link_dependency{Object.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/exec_proto.h"
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/FederateMetrics.hh"
+#include "TrickHLA/FederateMetricsMonitor.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/MonotonicClock.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+FederateMetricsMonitor::FederateMetricsMonitor()
+   : print_table( true ),
+     record_file( NULL ),
+     stale_period( 5.0 ),
+     manager( NULL ),
+     record_fp( NULL ),
+     print_count( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+FederateMetricsMonitor::~FederateMetricsMonitor()
+{
+   shutdown();
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void FederateMetricsMonitor::configure(
+   Manager *mgr )
+{
+   this->manager = mgr;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void FederateMetricsMonitor::initialize()
+{
+   if ( this->manager == NULL ) {
+      ostringstream errmsg;
+      errmsg << "FederateMetricsMonitor::initialize():" << __LINE__
+             << " ERROR: Unexpected NULL TrickHLA::Manager, make sure the"
+             << " configure() function is called!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( ( this->record_file != NULL ) && ( *( this->record_file ) != '\0' ) ) {
+      this->record_fp = fopen( this->record_file, "w" );
+      if ( this->record_fp == NULL ) {
+         ostringstream errmsg;
+         errmsg << "FederateMetricsMonitor::initialize():" << __LINE__
+                << " ERROR: Could not open the record file '"
+                << this->record_file << "'!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+      fprintf( this->record_fp, "sim_time,federate,granted_time,frame_time,frame_time_max,"
+                                "tag_wait_time,pack_time,unpack_time,send_rate,receive_rate,"
+                                "reflection_queue_depth,interaction_queue_depth,total_overrun_count,"
+                                "mode_transition_error\n" );
+   }
+}
+
+/*!
+ * @details The federate with the lowest granted time is flagged since it is
+ * the one most likely holding back the time advancement of the federation.
+ * @job_class{scheduled}
+ */
+void FederateMetricsMonitor::update()
+{
+   if ( this->manager == NULL ) {
+      return;
+   }
+
+   int64_t const wall_time  = MonotonicClock::get_time_micros();
+   double const  sim_time   = exec_get_sim_time();
+   Object       *objects    = this->manager->get_objects();
+   int const     obj_count  = this->manager->get_object_count();
+   int           slowest    = -1;
+   double        lowest_tag = 0.0;
+
+   // Find the federate with the lowest granted time.
+   for ( int n = 0; n < obj_count; ++n ) {
+      FederateMetrics const *metrics = dynamic_cast< FederateMetrics * >( objects[n].packing );
+      if ( ( metrics != NULL ) && ( metrics->get_update_wall_time() != 0 )
+           && ( ( slowest < 0 ) || ( metrics->granted_time < lowest_tag ) ) ) {
+         slowest    = n;
+         lowest_tag = metrics->granted_time;
+      }
+   }
+
+   ostringstream msg;
+   if ( this->print_table ) {
+      msg << "FederateMetricsMonitor::update() Sim-time:" << sim_time
+          << " Table:" << ++this->print_count << THLA_ENDL
+          << setw( 24 ) << left << "Federate" << right
+          << setw( 12 ) << "Granted(s)"
+          << setw( 10 ) << "Frame(ms)"
+          << setw( 10 ) << "Max(ms)"
+          << setw( 10 ) << "TAG(ms)"
+          << setw( 10 ) << "Pack(ms)"
+          << setw( 11 ) << "Unpack(ms)"
+          << setw( 12 ) << "Send(B/s)"
+          << setw( 12 ) << "Recv(B/s)"
+          << setw( 6 ) << "RflQ"
+          << setw( 6 ) << "IntQ"
+          << setw( 9 ) << "Overruns"
+          << setw( 10 ) << "Skew(us)" << THLA_ENDL;
+   }
+
+   for ( int n = 0; n < obj_count; ++n ) {
+      FederateMetrics const *metrics = dynamic_cast< FederateMetrics * >( objects[n].packing );
+      if ( ( metrics == NULL ) || ( metrics->get_update_wall_time() == 0 ) ) {
+         continue;
+      }
+
+      char const *fed_name = ( metrics->federate_name != NULL ) ? metrics->federate_name
+                                                                 : objects[n].get_name();
+      bool const  stale    = ( (double)( wall_time - metrics->get_update_wall_time() )
+                           > ( this->stale_period * 1000000.0 ) );
+
+      if ( this->print_table ) {
+         msg << setw( 24 ) << left << fed_name << right << fixed
+             << setw( 12 ) << setprecision( 3 ) << metrics->granted_time
+             << setw( 10 ) << setprecision( 3 ) << ( metrics->frame_time * 1000.0 )
+             << setw( 10 ) << setprecision( 3 ) << ( metrics->frame_time_max * 1000.0 )
+             << setw( 10 ) << setprecision( 3 ) << ( metrics->tag_wait_time * 1000.0 )
+             << setw( 10 ) << setprecision( 3 ) << ( metrics->pack_time * 1000.0 )
+             << setw( 11 ) << setprecision( 3 ) << ( metrics->unpack_time * 1000.0 )
+             << setw( 12 ) << setprecision( 0 ) << metrics->send_rate
+             << setw( 12 ) << setprecision( 0 ) << metrics->receive_rate
+             << setw( 6 ) << metrics->reflection_queue_depth
+             << setw( 6 ) << metrics->interaction_queue_depth
+             << setw( 9 ) << metrics->total_overrun_count
+             << setw( 10 ) << setprecision( 1 ) << ( metrics->mode_transition_error * 1000000.0 );
+         if ( stale ) {
+            msg << "  STALE";
+         } else if ( n == slowest ) {
+            msg << "  <-- lowest granted time";
+         }
+         msg << THLA_ENDL;
+      }
+
+      if ( this->record_fp != NULL ) {
+         fprintf( this->record_fp, "%.6f,%s,%.6f,%.9f,%.9f,%.9f,%.9f,%.9f,%.1f,%.1f,%d,%d,%d,%.9f\n",
+                  sim_time, fed_name, metrics->granted_time, metrics->frame_time,
+                  metrics->frame_time_max, metrics->tag_wait_time, metrics->pack_time,
+                  metrics->unpack_time, metrics->send_rate, metrics->receive_rate,
+                  metrics->reflection_queue_depth, metrics->interaction_queue_depth,
+                  metrics->total_overrun_count, metrics->mode_transition_error );
+      }
+   }
+
+   if ( this->print_table ) {
+      send_hs( stdout, msg.str().c_str() );
+   }
+   if ( this->record_fp != NULL ) {
+      fflush( this->record_fp );
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void FederateMetricsMonitor::shutdown()
+{
+   if ( this->record_fp != NULL ) {
+      fclose( this->record_fp );
+      this->record_fp = NULL;
+   }
+}
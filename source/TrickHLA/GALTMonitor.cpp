@@ -0,0 +1,342 @@
+/*!
+@file TrickHLA/GALTMonitor.cpp
+@ingroup TrickHLA
+@brief This class reports which federate is holding back the Greatest
+Available Logical Time (GALT) of the federation, using the time state that
+the Management Object Model (MOM) reports for each federate.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{Federate.cpp}
+@trick_link_dependency{GALTMonitor.cpp}
+@trick_link_dependency{Int64BaseTime.cpp}
+@trick_link_dependency{MonotonicClock.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdio>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/exec_proto.h"
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Federate.hh"
+#include "TrickHLA/GALTMonitor.hh"
+#include "TrickHLA/Int64BaseTime.hh"
+#include "TrickHLA/MonotonicClock.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+GALTMonitor::GALTMonitor()
+   : print_table( true ),
+     record_file( NULL ),
+     stale_period( 5.0 ),
+     federate( NULL ),
+     record_fp( NULL ),
+     print_count( 0 ),
+     prev_wall_time( 0 ),
+     total_wall_time( 0 ),
+     unblamed_time( 0 ),
+     sample_count( 0 ),
+     holder_changes( 0 ),
+     holding_federate(),
+     state_mutex(),
+     states()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+GALTMonitor::~GALTMonitor()
+{
+   shutdown();
+   state_mutex.destroy();
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void GALTMonitor::configure(
+   Federate *fed )
+{
+   this->federate = fed;
+   if ( this->federate != NULL ) {
+      this->federate->set_GALT_monitor( this );
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void GALTMonitor::initialize()
+{
+   if ( this->federate == NULL ) {
+      ostringstream errmsg;
+      errmsg << "GALTMonitor::initialize():" << __LINE__
+             << " ERROR: Unexpected NULL TrickHLA::Federate, make sure the"
+             << " configure() function is called!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( ( this->record_file != NULL ) && ( *( this->record_file ) != '\0' ) ) {
+      this->record_fp = fopen( this->record_file, "w" );
+      if ( this->record_fp == NULL ) {
+         ostringstream errmsg;
+         errmsg << "GALTMonitor::initialize():" << __LINE__
+                << " ERROR: Could not open the record file '"
+                << this->record_file << "'!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+      fprintf( this->record_fp, "sim_time,federate,regulating,constrained,advancing,"
+                                "logical_time,lookahead,LITS,GALT,blame_time,holding\n" );
+   }
+
+   // Subscribe to the MOM time state and ask for the first sample.
+   this->federate->subscribe_MOM_HLAfederate_time_state();
+   this->federate->request_MOM_HLAfederate_time_state();
+}
+
+/*!
+ * @details GALT of a time constrained federate is bounded by the least
+ * logical time plus lookahead of the time regulating federates. The
+ * regulating federate with that least bound holds back the federation if
+ * it has not asked to advance. If it is already advancing, the RTI is
+ * propagating the grant and the time is not charged to any federate.
+ * @job_class{scheduled}
+ */
+void GALTMonitor::update()
+{
+   if ( this->federate == NULL ) {
+      return;
+   }
+
+   int64_t const wall_time = MonotonicClock::get_time_micros();
+   int64_t const dt        = ( this->prev_wall_time != 0 ) ? ( wall_time - this->prev_wall_time ) : 0;
+   double const  sim_time  = exec_get_sim_time();
+
+   this->prev_wall_time = wall_time;
+
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &state_mutex );
+
+      // Find the regulating federate with the least logical time plus lookahead.
+      map< string, GALTFederateState >::iterator holder = states.end();
+      int64_t                                    min_bound = 0;
+
+      map< string, GALTFederateState >::iterator iter;
+      for ( iter = states.begin(); iter != states.end(); ++iter ) {
+         GALTFederateState const &state = iter->second;
+         bool const stale = ( (double)( wall_time - state.update_wall_time ) > ( this->stale_period * 1000000.0 ) );
+         if ( stale || !state.time_regulating
+              || ( ( state.fields & THLA_GALT_LOGICAL_TIME ) == 0 ) ) {
+            continue;
+         }
+         int64_t const bound = state.logical_time
+                               + ( ( ( state.fields & THLA_GALT_LOOKAHEAD ) != 0 ) ? state.lookahead : 0 );
+         if ( ( holder == states.end() ) || ( bound < min_bound ) ) {
+            holder    = iter;
+            min_bound = bound;
+         }
+      }
+
+      string holder_name;
+      if ( ( holder != states.end() ) && !holder->second.time_advancing ) {
+         holder->second.blame_time += dt;
+         ++holder->second.blame_count;
+         holder_name = holder->first;
+      } else {
+         this->unblamed_time += dt;
+      }
+      if ( holder_name != this->holding_federate ) {
+         ++this->holder_changes;
+         this->holding_federate = holder_name;
+      }
+      this->total_wall_time += dt;
+      ++this->sample_count;
+
+      ostringstream msg;
+      if ( this->print_table ) {
+         msg << "GALTMonitor::update() Sim-time:" << sim_time
+             << " Report:" << ++this->print_count
+             << " Holding GALT:" << ( holder_name.empty() ? "none" : holder_name.c_str() )
+             << THLA_ENDL
+             << setw( 24 ) << left << "Federate" << right
+             << setw( 5 ) << "Reg"
+             << setw( 5 ) << "Con"
+             << setw( 11 ) << "State"
+             << setw( 14 ) << "Time(s)"
+             << setw( 14 ) << "Lookahead(s)"
+             << setw( 14 ) << "LITS(s)"
+             << setw( 14 ) << "GALT(s)"
+             << setw( 12 ) << "Blame(s)"
+             << setw( 10 ) << "Blame(%)" << THLA_ENDL;
+      }
+
+      for ( iter = states.begin(); iter != states.end(); ++iter ) {
+         GALTFederateState const &state = iter->second;
+         bool const stale = ( (double)( wall_time - state.update_wall_time ) > ( this->stale_period * 1000000.0 ) );
+
+         double const logical_time = Int64BaseTime::to_seconds( state.logical_time );
+         double const lookahead    = Int64BaseTime::to_seconds( state.lookahead );
+         double const LITS         = Int64BaseTime::to_seconds( state.LITS );
+         double const GALT         = Int64BaseTime::to_seconds( state.GALT );
+         double const blame_time   = (double)state.blame_time / 1000000.0;
+         double const blame_pct    = ( this->total_wall_time > 0 )
+                                        ? ( 100.0 * (double)state.blame_time / (double)this->total_wall_time )
+                                        : 0.0;
+
+         if ( this->print_table ) {
+            msg << setw( 24 ) << left << iter->first << right << fixed
+                << setw( 5 ) << ( state.time_regulating ? "yes" : "no" )
+                << setw( 5 ) << ( state.time_constrained ? "yes" : "no" )
+                << setw( 11 ) << ( state.time_advancing ? "ADVANCING" : "GRANTED" )
+                << setw( 14 ) << setprecision( 6 ) << logical_time
+                << setw( 14 ) << setprecision( 6 ) << lookahead;
+            if ( ( state.fields & THLA_GALT_LITS ) != 0 ) {
+               msg << setw( 14 ) << setprecision( 6 ) << LITS;
+            } else {
+               msg << setw( 14 ) << "--";
+            }
+            if ( ( state.fields & THLA_GALT_GALT ) != 0 ) {
+               msg << setw( 14 ) << setprecision( 6 ) << GALT;
+            } else {
+               msg << setw( 14 ) << "--";
+            }
+            msg << setw( 12 ) << setprecision( 3 ) << blame_time
+                << setw( 10 ) << setprecision( 1 ) << blame_pct;
+            if ( stale ) {
+               msg << "  STALE";
+            } else if ( iter == holder ) {
+               msg << ( holder_name.empty() ? "  <-- lowest bound, advancing" : "  <-- holding GALT" );
+            }
+            msg << THLA_ENDL;
+         }
+
+         if ( this->record_fp != NULL ) {
+            fprintf( this->record_fp, "%.6f,%s,%d,%d,%d,%.9f,%.9f,%.9f,%.9f,%.6f,%d\n",
+                     sim_time, iter->first.c_str(), (int)state.time_regulating,
+                     (int)state.time_constrained, (int)state.time_advancing,
+                     logical_time, lookahead, LITS, GALT, blame_time,
+                     (int)( ( iter == holder ) && !holder_name.empty() ) );
+         }
+      }
+
+      if ( this->print_table ) {
+         send_hs( stdout, msg.str().c_str() );
+      }
+      if ( this->record_fp != NULL ) {
+         fflush( this->record_fp );
+      }
+   }
+
+   // Ask the MOM for the time state to use in the next sample.
+   this->federate->request_MOM_HLAfederate_time_state();
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void GALTMonitor::shutdown()
+{
+   if ( ( this->sample_count > 0 ) && this->print_table ) {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &state_mutex );
+
+      ostringstream msg;
+      msg << "GALTMonitor::shutdown() Samples:" << this->sample_count
+          << " Wall-time:" << fixed << setprecision( 3 )
+          << ( (double)this->total_wall_time / 1000000.0 ) << " s"
+          << " Holder-changes:" << this->holder_changes
+          << " Not-held:" << ( (double)this->unblamed_time / 1000000.0 ) << " s"
+          << THLA_ENDL;
+
+      map< string, GALTFederateState >::const_iterator iter;
+      for ( iter = states.begin(); iter != states.end(); ++iter ) {
+         msg << "  " << setw( 24 ) << left << iter->first << right
+             << " held GALT " << setw( 10 ) << setprecision( 3 )
+             << ( (double)iter->second.blame_time / 1000000.0 ) << " s in "
+             << iter->second.blame_count << " samples" << THLA_ENDL;
+      }
+      send_hs( stdout, msg.str().c_str() );
+
+      // Only print the summary once.
+      this->sample_count = 0;
+   }
+
+   if ( this->record_fp != NULL ) {
+      fclose( this->record_fp );
+      this->record_fp = NULL;
+   }
+}
+
+void GALTMonitor::update_federate_state(
+   string const            &federate_name,
+   GALTFederateState const &state )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &state_mutex );
+
+   // Only merge the fields reported in this update.
+   GALTFederateState &fed_state = states[federate_name];
+   if ( ( state.fields & THLA_GALT_REGULATING ) != 0 ) {
+      fed_state.time_regulating = state.time_regulating;
+   }
+   if ( ( state.fields & THLA_GALT_CONSTRAINED ) != 0 ) {
+      fed_state.time_constrained = state.time_constrained;
+   }
+   if ( ( state.fields & THLA_GALT_ADVANCING ) != 0 ) {
+      fed_state.time_advancing = state.time_advancing;
+   }
+   if ( ( state.fields & THLA_GALT_LOGICAL_TIME ) != 0 ) {
+      fed_state.logical_time = state.logical_time;
+   }
+   if ( ( state.fields & THLA_GALT_LOOKAHEAD ) != 0 ) {
+      fed_state.lookahead = state.lookahead;
+   }
+   if ( ( state.fields & THLA_GALT_GALT ) != 0 ) {
+      fed_state.GALT = state.GALT;
+   }
+   if ( ( state.fields & THLA_GALT_LITS ) != 0 ) {
+      fed_state.LITS = state.LITS;
+   }
+   fed_state.fields |= state.fields;
+   fed_state.update_wall_time = MonotonicClock::get_time_micros();
+}
@@ -23,6 +23,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{Interaction.cpp}
 @trick_link_dependency{InteractionHandler.cpp}
 @trick_link_dependency{InteractionItem.cpp}
+@trick_link_dependency{InteractionOutbox.cpp}
 @trick_link_dependency{Manager.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
@@ -60,6 +61,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Interaction.hh"
 #include "TrickHLA/InteractionHandler.hh"
 #include "TrickHLA/InteractionItem.hh"
+#include "TrickHLA/InteractionOutbox.hh"
 #include "TrickHLA/Manager.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
@@ -92,6 +94,7 @@ Interaction::Interaction()
      param_count( 0 ),
      parameters( NULL ),
      handler( NULL ),
+     memory_usage(),
      mutex(),
      changed( false ),
      received_as_TSO( false ),
@@ -197,6 +200,11 @@ void Interaction::initialize(
       param_count = 0;
    }
 
+   // Account the parameter buffers to this interaction.
+   for ( unsigned int i = 0; i < param_count; ++i ) {
+      parameters[i].set_memory_owner( &memory_usage );
+   }
+
    // Verify parameter FOM names and also check for duplicate parameter FOM names.
    for ( unsigned int i = 0; i < param_count; ++i ) {
       // Validate the FOM-name to make sure we don't have a problem with the
@@ -1072,6 +1080,149 @@ Interaction '%s' is time-regulating:%s, preferred-order:%s.%c",
    return ( successfuly_sent );
 }
 
+bool Interaction::enqueue_send(
+   RTI1516_USERDATA const &the_user_supplied_tag )
+{
+   // RTI must be ready and the flag must be set to publish.
+   if ( !is_publish() ) {
+      return ( false );
+   }
+
+   // Send directly if the interaction outboxes are not configured or the
+   // calling thread, such as the RTI callback thread, is not a Trick thread.
+   InteractionOutbox *outbox = manager->get_interaction_outbox();
+   if ( outbox == NULL ) {
+      return send( the_user_supplied_tag );
+   }
+
+   if ( !outbox->enqueue( *this, false, 0.0, the_user_supplied_tag ) ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+         send_hs( stderr, "Interaction::enqueue_send():%d As Receive-Order: Interaction '%s' dropped, the outbox for thread %d is full.%c",
+                  __LINE__, get_FOM_name(), exec_get_process_id(), THLA_NEWLINE );
+      }
+      return ( false );
+   }
+   return ( true );
+}
+
+bool Interaction::enqueue_send(
+   double                  send_HLA_time,
+   RTI1516_USERDATA const &the_user_supplied_tag )
+{
+   // RTI must be ready and the flag must be set to publish.
+   if ( !is_publish() ) {
+      return ( false );
+   }
+
+   // Send directly if the interaction outboxes are not configured or the
+   // calling thread, such as the RTI callback thread, is not a Trick thread.
+   InteractionOutbox *outbox = manager->get_interaction_outbox();
+   if ( outbox == NULL ) {
+      return send( send_HLA_time, the_user_supplied_tag );
+   }
+
+   if ( !outbox->enqueue( *this, true, send_HLA_time, the_user_supplied_tag ) ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+         send_hs( stderr, "Interaction::enqueue_send():%d Interaction '%s' for time %lf seconds dropped, the outbox for thread %d is full.%c",
+                  __LINE__, get_FOM_name(), send_HLA_time, exec_get_process_id(), THLA_NEWLINE );
+      }
+      return ( false );
+   }
+   return ( true );
+}
+
+/*!
+ * @details The parameter values point into the pooled buffer of the outbox
+ * item, which stays valid until the item is released after this call.
+ */
+bool Interaction::send_outbox_item(
+   InteractionOutboxItem &item )
+{
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   RTIambassador *rti_amb = get_RTI_ambassador();
+   if ( rti_amb == NULL ) {
+      send_hs( stderr, "Interaction::send_outbox_item():%d Unexpected NULL RTIambassador.%c",
+               __LINE__, THLA_NEWLINE );
+      return ( false );
+   }
+
+   // Map the encoded parameter values without copying them.
+   ParameterHandleValueMap param_values_map;
+   size_t                  offset = 0;
+   for ( int i = 0; ( i < param_count ) && ( i < (int)item.param_sizes.size() ); ++i ) {
+      param_values_map[parameters[i].get_parameter_handle()].setDataPointer(
+         ( item.param_sizes[i] > 0 ) ? &item.data[offset] : NULL, item.param_sizes[i] );
+      offset += item.param_sizes[i];
+   }
+   RTI1516_USERDATA const tag( ( item.tag_size > 0 ) ? &item.data[offset] : NULL, item.tag_size );
+
+   // Get the Trick-Federate.
+   Federate const *federate = get_federate();
+
+   // Same as send(), the interaction is only sent with a timestamp if the
+   // federate is time-regulating and the interaction prefers timestamp order.
+   bool const send_with_timestamp = item.timestamp_order
+                                    && federate->in_time_regulating_state()
+                                    && ( preferred_order != TRANSPORT_RECEIVE_ORDER );
+   if ( item.timestamp_order ) {
+      time.set( item.send_time );
+   }
+
+   bool successfuly_sent = false;
+   try {
+      // Do not send any interactions if federate save or restore has begun (see
+      // IEEE-1516.1-2000 sections 4.12, 4.20)
+      if ( federate->should_publish_data() ) {
+         if ( send_with_timestamp ) {
+            if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+               send_hs( stdout, "Interaction::send_outbox_item():%d As Timestamp-Order: Interaction '%s' sent for time %lf seconds.%c",
+                        __LINE__, get_FOM_name(), time.get_time_in_seconds(), THLA_NEWLINE );
+            }
+            rti_amb->sendInteraction( this->class_handle,
+                                      param_values_map,
+                                      tag,
+                                      time.get() );
+         } else {
+            if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+               send_hs( stdout, "Interaction::send_outbox_item():%d As Receive-Order: Interaction '%s'%c",
+                        __LINE__, get_FOM_name(), THLA_NEWLINE );
+            }
+            rti_amb->sendInteraction( this->class_handle,
+                                      param_values_map,
+                                      tag );
+         }
+         successfuly_sent = true;
+      }
+   } catch ( RTI1516_NAMESPACE::InvalidLogicalTime const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Interaction::send_outbox_item():" << __LINE__
+             << " As Timestamp Order, InvalidLogicalTime exception for "
+             << get_FOM_name() << "  time=" << time.get_time_in_seconds()
+             << " (" << time.get_base_time() << " " << Int64BaseTime::get_units()
+             << " error message:'" << rti_err_msg << "'" << THLA_ENDL;
+      send_hs( stderr, errmsg.str().c_str() );
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Interaction::send_outbox_item():" << __LINE__ << " As "
+             << ( send_with_timestamp ? "Timestamp Order" : "Receive Order" )
+             << ", Interaction '" << get_FOM_name() << "' with exception '"
+             << rti_err_msg << "'" << THLA_ENDL;
+      send_hs( stderr, errmsg.str().c_str() );
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   return ( successfuly_sent );
+}
+
 void Interaction::process_interaction()
 {
    // The Interaction data must have changed and the RTI must be ready.
@@ -106,6 +106,34 @@ bool InteractionHandler::send_interaction(
                                     : false );
 }
 
+bool InteractionHandler::enqueue_send_interaction()
+{
+   return ( ( interaction != NULL ) ? interaction->enqueue_send( RTI1516_USERDATA( 0, 0 ) )
+                                    : false );
+}
+
+bool InteractionHandler::enqueue_send_interaction(
+   RTI1516_USERDATA const &the_user_supplied_tag )
+{
+   return ( ( interaction != NULL ) ? interaction->enqueue_send( the_user_supplied_tag )
+                                    : false );
+}
+
+bool InteractionHandler::enqueue_send_interaction(
+   double send_HLA_time )
+{
+   return ( ( interaction != NULL ) ? interaction->enqueue_send( send_HLA_time, RTI1516_USERDATA( 0, 0 ) )
+                                    : false );
+}
+
+bool InteractionHandler::enqueue_send_interaction(
+   double                  send_HLA_time,
+   RTI1516_USERDATA const &the_user_supplied_tag )
+{
+   return ( ( interaction != NULL ) ? interaction->enqueue_send( send_HLA_time, the_user_supplied_tag )
+                                    : false );
+}
+
 void InteractionHandler::receive_interaction(
    RTI1516_USERDATA const &the_user_supplied_tag )
 {
@@ -18,6 +18,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{DebugHandler.cpp}
 @trick_link_dependency{InteractionItem.cpp}
+@trick_link_dependency{MemoryAccounting.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
 @trick_link_dependency{Parameter.cpp}
@@ -47,6 +48,7 @@ NASA, Johnson Space Center\n
 // TrickHLA include files.
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/InteractionItem.hh"
+#include "TrickHLA/MemoryAccounting.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Parameter.hh"
@@ -78,7 +80,10 @@ InteractionItem::InteractionItem() // RETURN: -- None.
      user_supplied_tag_size( 0 ),
      user_supplied_tag( NULL ),
      order_is_TSO( false ),
-     time()
+     time(),
+     memory_bytes( sizeof( InteractionItem ) ),
+     memory_owner( NULL ),
+     memory_accounted( false )
 {
    return;
 }
@@ -99,7 +104,10 @@ InteractionItem::InteractionItem(
      parm_items_count( 0 ),
      parm_items( NULL ),
      order_is_TSO( false ),
-     time()
+     time(),
+     memory_bytes( sizeof( InteractionItem ) ),
+     memory_owner( NULL ),
+     memory_accounted( false )
 {
    // Decode the Interaction values into this Item.
    initialize( interaction_type, param_count, parameters, theParameterValues, theUserSuppliedTag );
@@ -122,7 +130,10 @@ InteractionItem::InteractionItem(
      parm_items_count( 0 ),
      parm_items( NULL ),
      order_is_TSO( true ),
-     time()
+     time(),
+     memory_bytes( sizeof( InteractionItem ) ),
+     memory_owner( NULL ),
+     memory_accounted( false )
 {
    time.set( theTime );
 
@@ -144,6 +155,10 @@ InteractionItem::~InteractionItem()
       user_supplied_tag_size = 0;
    }
    clear_parm_items();
+
+   if ( memory_accounted ) {
+      MemoryAccounting::record( MEMORY_INTERACTION_ITEMS, -memory_bytes, memory_owner );
+   }
 }
 
 /*!
@@ -171,6 +186,8 @@ void InteractionItem::initialize(
          ParameterItem *item;
          item = new ParameterItem( p, &( param_iter->second ) );
          parameter_queue.push( item );
+
+         memory_bytes += (int64_t)( sizeof( ParameterItem ) + item->size );
       }
    }
 
@@ -188,6 +205,8 @@ void InteractionItem::initialize(
    if ( user_supplied_tag_size != 0 ) {
       user_supplied_tag = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", user_supplied_tag_size ) );
       memcpy( user_supplied_tag, theUserSuppliedTag.data(), user_supplied_tag_size );
+
+      memory_bytes += (int64_t)user_supplied_tag_size;
    }
 }
 
@@ -265,6 +284,18 @@ void InteractionItem::restore_queue()
          }
 
          parameter_queue.push( item );
+
+         memory_bytes += (int64_t)( sizeof( ParameterItem ) + item->size );
       }
    }
 }
+
+void InteractionItem::account_memory(
+   MemoryUsage *owner )
+{
+   if ( !memory_accounted ) {
+      this->memory_owner     = owner;
+      this->memory_accounted = true;
+      MemoryAccounting::record( MEMORY_INTERACTION_ITEMS, memory_bytes, memory_owner );
+   }
+}
@@ -0,0 +1,190 @@
+/*!
+@file TrickHLA/InteractionOutbox.cpp
+@ingroup TrickHLA
+@brief This class provides a per-thread outbox of interaction sends that a
+Trick thread fills without locking and the Trick main thread flushes to the
+RTI once per frame.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Interaction.cpp}
+@trick_link_dependency{InteractionOutbox.cpp}
+@trick_link_dependency{MonotonicClock.cpp}
+@trick_link_dependency{Parameter.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// TrickHLA include files.
+#include "TrickHLA/Interaction.hh"
+#include "TrickHLA/InteractionOutbox.hh"
+#include "TrickHLA/MonotonicClock.hh"
+#include "TrickHLA/Parameter.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+using namespace std;
+using namespace RTI1516_NAMESPACE;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+InteractionOutbox::InteractionOutbox()
+   : items( NULL ),
+     size( 0 ),
+     head( 0 ),
+     tail( 0 ),
+     overflow_count( 0 ),
+     max_depth( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+InteractionOutbox::~InteractionOutbox()
+{
+   if ( items != NULL ) {
+      delete[] items;
+      items = NULL;
+   }
+   size = 0;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void InteractionOutbox::initialize(
+   unsigned int const outbox_size )
+{
+   if ( items != NULL ) {
+      delete[] items;
+   }
+
+   // One item of the ring is always left free so that a full ring can be
+   // told apart from an empty one using only the head and tail.
+   this->size  = ( ( outbox_size > 0 ) ? outbox_size : 1 ) + 1;
+   this->items = new InteractionOutboxItem[size];
+   this->head  = 0;
+   this->tail  = 0;
+}
+
+/*!
+ * @details The parameters are encoded from the Trick simulation variables
+ * without taking the interaction mutex, so an interaction must only be
+ * enqueued from one thread at a time, which is the thread that owns the
+ * simulation variables of its parameters.
+ * @job_class{scheduled}
+ */
+bool InteractionOutbox::enqueue(
+   Interaction            &inter,
+   bool const              timestamp_order,
+   double const            send_time,
+   RTI1516_USERDATA const &tag )
+{
+   if ( items == NULL ) {
+      return false;
+   }
+
+   unsigned int const slot      = tail;
+   unsigned int const next_tail = ( slot + 1 ) % size;
+   unsigned int const cur_head  = __atomic_load_n( &head, __ATOMIC_ACQUIRE );
+   if ( next_tail == cur_head ) {
+      ++overflow_count;
+      return false;
+   }
+
+   InteractionOutboxItem &item = items[slot];
+   item.interaction            = &inter;
+   item.timestamp_order        = timestamp_order;
+   item.send_time              = send_time;
+
+   // Pack the encoded parameter values back to back into the pooled buffer,
+   // which only grows if this send is bigger than any before it. The values
+   // are copied straight from the parameter buffers to avoid allocating.
+   int const  param_count = inter.get_parameter_count();
+   Parameter *params      = inter.get_parameters();
+   item.param_sizes.resize( param_count );
+   item.data.clear();
+   for ( int i = 0; i < param_count; ++i ) {
+      params[i].pack_parameter_buffer();
+      size_t const value_size = params[i].get_encoded_size();
+      item.param_sizes[i]     = value_size;
+      if ( value_size > 0 ) {
+         unsigned char const *bytes = params[i].get_encoded_buffer();
+         item.data.insert( item.data.end(), bytes, bytes + value_size );
+      }
+   }
+   item.tag_size = tag.size();
+   if ( item.tag_size > 0 ) {
+      unsigned char const *bytes = static_cast< unsigned char const * >( tag.data() );
+      item.data.insert( item.data.end(), bytes, bytes + item.tag_size );
+   }
+
+   item.enqueue_wall_time = MonotonicClock::get_time_micros();
+
+   // Publish the packed item to the consumer.
+   __atomic_store_n( &tail, next_tail, __ATOMIC_RELEASE );
+
+   unsigned int const depth = ( next_tail + size - cur_head ) % size;
+   if ( depth > max_depth ) {
+      this->max_depth = depth;
+   }
+   return true;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+unsigned int InteractionOutbox::collect(
+   vector< InteractionOutboxItem * > &pending )
+{
+   if ( items == NULL ) {
+      return 0;
+   }
+
+   unsigned int const cur_tail = __atomic_load_n( &tail, __ATOMIC_ACQUIRE );
+   unsigned int       count    = 0;
+   for ( unsigned int slot = head; slot != cur_tail; slot = ( slot + 1 ) % size ) {
+      pending.push_back( &items[slot] );
+      ++count;
+   }
+   return count;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void InteractionOutbox::release(
+   unsigned int const count )
+{
+   if ( ( items == NULL ) || ( count == 0 ) ) {
+      return;
+   }
+
+   // Hand the items back to the producer only after they are sent.
+   __atomic_store_n( &head, ( head + count ) % size, __ATOMIC_RELEASE );
+}
@@ -174,6 +174,46 @@ void ItemQueue::push( // RETURN: -- None.
    ++count;
 }
 
+/*!
+ * @brief Remove the item from anywhere in the queue and delete it.
+ * @param item Item to remove from the queue.
+ * @return True if the item was found and removed, false otherwise.
+ */
+bool ItemQueue::remove(
+   Item *item )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   // Find the item and the item before it in the linked-list.
+   Item *prev = NULL;
+   Item *curr = head;
+   while ( ( curr != NULL ) && ( curr != item ) ) {
+      prev = curr;
+      curr = curr->next;
+   }
+   if ( curr == NULL ) {
+      return false;
+   }
+
+   // Unlink the item from the linked-list.
+   if ( prev == NULL ) {
+      head = curr->next;
+   } else {
+      prev->next = curr->next;
+   }
+   if ( tail == curr ) {
+      tail = prev;
+   }
+
+   // Make sure we delete the Item we created when it was pushed on the queue.
+   delete curr;
+   --count;
+
+   return true;
+}
+
 /*!
  * @brief Re-established original 'head' queue pointer after the queue has
  *  been walked.
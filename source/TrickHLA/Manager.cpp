@@ -25,10 +25,13 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{Int64Time.cpp}
 @trick_link_dependency{Interaction.cpp}
 @trick_link_dependency{InteractionItem.cpp}
+@trick_link_dependency{InteractionOutbox.cpp}
 @trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MonotonicClock.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
 @trick_link_dependency{Object.cpp}
+@trick_link_dependency{ObjectTemplate.cpp}
 @trick_link_dependency{Parameter.cpp}
 @trick_link_dependency{ParameterItem.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
@@ -45,13 +48,21 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <float.h>
+#include <map>
+#include <pthread.h>
 #include <string>
+#include <unistd.h>
+#include <vector>
 
 // Trick include files.
 #include "trick/Executive.hh"
 #include "trick/MemoryManager.hh"
+#include "trick/exec_proto.h"
+#include "trick/memorymanager_c_intf.h"
 #include "trick/message_proto.h"
 
 // TrickHLA include files.
@@ -66,10 +77,13 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Int64Time.hh"
 #include "TrickHLA/Interaction.hh"
 #include "TrickHLA/InteractionItem.hh"
+#include "TrickHLA/InteractionOutbox.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/MonotonicClock.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Object.hh"
+#include "TrickHLA/ObjectTemplate.hh"
 #include "TrickHLA/Parameter.hh"
 #include "TrickHLA/ParameterItem.hh"
 #include "TrickHLA/SleepTimeout.hh"
@@ -106,18 +120,295 @@ extern ATTRIBUTES attrTrickHLA__Parameter[];
 }
 #endif
 
+namespace
+{
+
+/*!
+@struct RefAttributeSetupTime
+@brief Time spent setting up the instances of an object or interaction class.
+*/
+typedef struct {
+   int     instance_count; ///< Number of instances set up.
+   int     item_count;     ///< Number of attributes or parameters set up.
+   int64_t wall_time;      ///< Wall clock time spent on the setup in microseconds.
+} RefAttributeSetupTime;
+
+typedef std::map< std::string, RefAttributeSetupTime > RefAttributeSetupTimeMap;
+
+/*!
+@class RefAttributeSetup
+@brief The objects or interactions to set up the Trick ref-attributes for,
+which the setup threads take one at a time by index.
+*/
+class RefAttributeSetup
+{
+  public:
+   RefAttributeSetup( Object      *data_objects,
+                      Interaction *data_interactions,
+                      int const    data_count )
+      : objects( data_objects ),
+        interactions( data_interactions ),
+        count( ( data_count > 0 ) ? (unsigned int)data_count : 0 ),
+        next_index( 0 ),
+        mutex(),
+        times(),
+        errors()
+   {
+      return;
+   }
+
+   ~RefAttributeSetup()
+   {
+      mutex.destroy();
+   }
+
+   Object      *objects;      ///< Objects to set up the attributes for.
+   Interaction *interactions; ///< Interactions to set up the parameters for.
+   unsigned int count;        ///< Number of objects or interactions.
+   unsigned int next_index;   ///< Index of the next object or interaction to set up.
+
+   MutexLock                mutex;  ///< Mutex to lock the next index, setup times and errors.
+   RefAttributeSetupTimeMap times;  ///< Setup times by object or interaction class.
+   std::string              errors; ///< Collected setup error messages.
+
+   /*! @brief Add setup time for an object or interaction class.
+    *  @param class_name     FOM name of the object or interaction class.
+    *  @param instance_count Number of instances set up.
+    *  @param item_count     Number of attributes or parameters set up.
+    *  @param wall_time      Wall clock time spent in microseconds. */
+   void add_time( char const *class_name,
+                  int const   instance_count,
+                  int const   item_count,
+                  int64_t     wall_time )
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      RefAttributeSetupTimeMap::iterator iter = times.find( class_name );
+      if ( iter == times.end() ) {
+         RefAttributeSetupTime time;
+         time.instance_count = 0;
+         time.item_count     = 0;
+         time.wall_time      = 0LL;
+         iter                = times.insert( std::make_pair( std::string( class_name ), time ) ).first;
+      }
+      iter->second.instance_count += instance_count;
+      iter->second.item_count += item_count;
+      iter->second.wall_time += wall_time;
+   }
+
+   /*! @brief Add the error message of a failed setup.
+    *  @param message Error message. */
+   void add_error( std::string const &message )
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+      errors += message;
+   }
+
+   /*! @brief Get the index of the next object or interaction to set up.
+    *  @return True if there was one left to set up.
+    *  @param index The index of the object or interaction. */
+   bool const take_next( unsigned int &index )
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      if ( next_index >= count ) {
+         return false;
+      }
+      index = next_index++;
+      return true;
+   }
+
+   /*! @brief Set up the attributes of the object or the parameters of the
+    * interaction at the given index.
+    *  @param n Index of the object or interaction. */
+   void setup( unsigned int const n )
+   {
+      int64_t const start_time = MonotonicClock::get_time_micros();
+      ostringstream msg;
+
+      if ( objects != NULL ) {
+         int const  attr_count = objects[n].get_attribute_count();
+         Attribute *attrs      = objects[n].get_attributes();
+
+         if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            msg << "Manager::setup_object_ref_attributes()" << __LINE__ << endl
+                << "--------------- Trick REF-Attributes ---------------" << endl
+                << " Object:'" << objects[n].get_name() << "'"
+                << " FOM-Name:'" << objects[n].get_FOM_name() << "'"
+                << " Create HLA Instance:"
+                << ( objects[n].is_create_HLA_instance() ? "Yes" : "No" )
+                << " Attribute count:" << attr_count << endl;
+         }
+
+         // Process the attributes for this object.
+         for ( unsigned int i = 0; i < attr_count; ++i ) {
+
+            // Initialize the TrickHLA-Attribute before we use it.
+            attrs[i].initialize( objects[n].get_FOM_name(), n, i );
+
+            if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+               msg << "   " << ( i + 1 ) << "/" << attr_count
+                   << " FOM-Attribute:'" << attrs[i].get_FOM_name() << "'"
+                   << " Trick-Name:'" << attrs[i].get_trick_name() << "'"
+                   << endl;
+            }
+         }
+         add_time( objects[n].get_FOM_name(), 0, attr_count,
+                   MonotonicClock::get_time_micros() - start_time );
+      } else {
+         int const  param_count = interactions[n].get_parameter_count();
+         Parameter *params      = interactions[n].get_parameters();
+
+         if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            msg << "Manager::setup_interaction_ref_attributes():" << __LINE__ << endl
+                << "--------------- Trick REF-Attributes ---------------" << endl
+                << " FOM-Interaction:'" << interactions[n].get_FOM_name() << "'"
+                << endl;
+         }
+
+         // Process the parameters for this interaction.
+         for ( unsigned int i = 0; i < param_count; ++i ) {
+
+            if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+               msg << "   " << ( i + 1 ) << "/" << param_count
+                   << " FOM-Parameter:'" << params[i].get_FOM_name() << "'"
+                   << " Trick-Name:'" << params[i].get_trick_name() << "'"
+                   << endl;
+            }
+
+            // Initialize the TrickHLA Parameter.
+            params[i].initialize( interactions[n].get_FOM_name(), n, i );
+         }
+         add_time( interactions[n].get_FOM_name(), 0, param_count,
+                   MonotonicClock::get_time_micros() - start_time );
+      }
+
+      if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         send_hs( stdout, msg.str().c_str() );
+      }
+   }
+
+   /*! @brief The pthread start routine of the setup threads. A setup error
+    * is collected instead of terminating the simulation off the main thread.
+    *  @return Always NULL.
+    *  @param arg Pointer to the RefAttributeSetup instance. */
+   static void *setup_thread( void *arg )
+   {
+      RefAttributeSetup *ref_setup = static_cast< RefAttributeSetup * >( arg );
+
+      DebugHandler::set_defer_termination( true );
+
+      unsigned int n;
+      while ( ref_setup->take_next( n ) ) {
+         try {
+            ref_setup->setup( n );
+         } catch ( DeferredTermination const &termination ) {
+            ref_setup->add_error( termination.get_message() );
+         }
+      }
+
+      DebugHandler::set_defer_termination( false );
+      return NULL;
+   }
+
+   /*! @brief Set up all the objects or interactions using up to the given
+    * number of threads, where the calling thread is one of them. The calling
+    * thread terminates with the collected errors once all threads joined.
+    *  @param thread_count Number of threads to use. */
+   void run( unsigned int thread_count )
+   {
+      if ( thread_count > count ) {
+         thread_count = count;
+      }
+
+      std::vector< pthread_t > threads;
+      for ( unsigned int t = 1; t < thread_count; ++t ) {
+         pthread_t thread;
+         if ( pthread_create( &thread, NULL, setup_thread, this ) == 0 ) {
+            threads.push_back( thread );
+         } else {
+            // Carry on with the threads we have.
+            break;
+         }
+      }
+
+      // The calling thread sets up objects or interactions too.
+      setup_thread( this );
+
+      for ( unsigned int t = 0; t < threads.size(); ++t ) {
+         pthread_join( threads[t], NULL );
+      }
+
+      if ( !errors.empty() ) {
+         DebugHandler::terminate_with_message( errors );
+      }
+   }
+
+   /*! @brief Show the setup time by object or interaction class.
+    *  @param method Name of the calling method for the message. */
+   void report( char const *method ) const
+   {
+      ostringstream msg;
+      msg << method << " Setup time by class:" << endl;
+      RefAttributeSetupTimeMap::const_iterator iter;
+      for ( iter = times.begin(); iter != times.end(); ++iter ) {
+         msg << "  '" << iter->first << "'"
+             << " instances:" << iter->second.instance_count
+             << " items:" << iter->second.item_count
+             << " time:" << ( (double)iter->second.wall_time / 1000.0 ) << " ms"
+             << endl;
+      }
+      send_hs( stdout, msg.str().c_str() );
+   }
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   RefAttributeSetup( RefAttributeSetup const &rhs );
+   RefAttributeSetup &operator=( RefAttributeSetup const &rhs );
+};
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
 Manager::Manager()
    : obj_count( 0 ),
      objects( NULL ),
+     obj_template_count( 0 ),
+     obj_templates( NULL ),
      inter_count( 0 ),
      interactions( NULL ),
+     send_receive_budget( 0.0 ),
+     degrade_factor( 2 ),
+     degrade_cycle_count( 2 ),
+     recover_cycle_count( 20 ),
+     recover_budget_fraction( 0.75 ),
+     async_send( false ),
+     async_send_queue_limit( 256 ),
+     interaction_outbox_size( 0 ),
+     catch_up_cycle_count( 0 ),
+     catch_up_bytes_per_cycle( 0 ),
+     catch_up_timeout( 60.0 ),
+     setup_thread_count( 1 ),
+     interactions_queue_max_depth( 0 ),
+     interactions_queue_policy( QUEUE_OVERFLOW_CONFLATE ),
+     queue_block_timeout( 1.0 ),
      restore_federation( 0 ),
      restore_file_name( NULL ),
      initiated_a_federation_save( false ),
      interactions_queue(),
+     interactions_queue_peak_depth( 0 ),
+     interactions_dropped_count( 0LL ),
+     interactions_conflated_count( 0LL ),
+     interactions_blocked_count( 0LL ),
+     interactions_queue_overflowed( false ),
      check_interactions_count( 0 ),
      check_interactions( NULL ),
      job_cycle_base_time( 0LL ),
@@ -125,9 +416,54 @@ Manager::Manager()
      restore_determined( false ),
      restore_federate( false ),
      mgr_initialized( false ),
+     collect_metrics( false ),
      obj_discovery_mutex(),
      object_map(),
      obj_name_index_map(),
+     discovery_index_initialized( false ),
+     discovery_name_index_map(),
+     discovery_free_index_map(),
+     discovery_obj_names(),
+     active_sets_initialized( false ),
+     send_schedule_initialized( false ),
+     active_set_mutex(),
+     changed_obj_set(),
+     deleted_obj_set(),
+     requested_obj_set(),
+     reschedule_obj_set(),
+     catch_up_queue(),
+     catch_up_queued_obj_set(),
+     catch_up_objs_per_cycle( 0 ),
+     catch_up_pending_obj_set(),
+     catch_up_expected_count( 0 ),
+     catch_up_remaining_count( 0 ),
+     catch_up_start_wall_time( 0LL ),
+     blocking_read_obj_list(),
+     always_send_obj_list(),
+     send_cycle_count( 0LL ),
+     send_schedule(),
+     obj_next_send_cycle(),
+     obj_last_send_cycle(),
+     thread_requested_obj_set(),
+     thread_reschedule_obj_set(),
+     thread_always_send_obj_list(),
+     thread_send_cycle_count(),
+     thread_send_schedule(),
+     thread_obj_next_send_cycle(),
+     thread_obj_last_send_cycle(),
+     send_degradation_level( 0 ),
+     over_budget_cycles( 0 ),
+     under_budget_cycles( 0 ),
+     receive_wall_time( 0LL ),
+     send_receive_wall_time( 0LL ),
+     sender_thread(),
+     interaction_outboxes( NULL ),
+     interaction_outbox_count( 0 ),
+     outbox_pending(),
+     outbox_collected(),
+     outbox_sent_count( 0 ),
+     outbox_latency_sum( 0LL ),
+     outbox_latency_max( 0LL ),
      federate_has_been_restored( false ),
      federate( NULL ),
      execution_control( NULL )
@@ -141,12 +477,23 @@ Manager::Manager()
  */
 Manager::~Manager()
 {
+   stop_async_send();
+
+   if ( interaction_outboxes != NULL ) {
+      delete[] interaction_outboxes;
+      interaction_outboxes     = NULL;
+      interaction_outbox_count = 0;
+   }
+
    object_map.clear();
    obj_name_index_map.clear();
+   clear_discovery_indexes();
+   clear_active_sets();
    clear_interactions();
 
    // Make sure we destroy the mutex.
    obj_discovery_mutex.destroy();
+   active_set_mutex.destroy();
 }
 
 /*!
@@ -205,6 +552,16 @@ void Manager::initialize()
       DebugHandler::terminate_with_message( errmsg.str() );
    }
 
+   verify_send_degradation_settings();
+
+   verify_interactions_queue_settings();
+
+   start_async_send();
+
+   setup_interaction_outboxes();
+
+   setup_thread_send_schedules();
+
    // The manager is now initialized.
    this->mgr_initialized = true;
 
@@ -290,6 +647,12 @@ void Manager::restart_initialization()
    // Restore checkpointed interactions.
    restore_interactions();
 
+   start_async_send();
+
+   setup_interaction_outboxes();
+
+   setup_thread_send_schedules();
+
    // The manager is now initialized.
    this->mgr_initialized = true;
 }
@@ -310,8 +673,9 @@ void Manager::verify_object_and_interaction_arrays()
    }
 
    // If we have a non-NULL objects array but the object-count is invalid
-   // then let the user know.
-   if ( ( obj_count <= 0 ) && ( objects != NULL ) ) {
+   // then let the user know, unless the array only holds the objects
+   // instantiated from the object templates.
+   if ( ( obj_count <= 0 ) && ( objects != NULL ) && ( get_object_template_pool_size() <= 0 ) ) {
       ostringstream errmsg;
       errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
              << " ERROR: Unexpected " << ( ( obj_count == 0 ) ? "zero" : "negative" )
@@ -383,6 +747,225 @@ void Manager::verify_object_and_interaction_arrays()
    if ( inter_count < 0 ) {
       inter_count = 0;
    }
+
+   // Verify the object templates now that the objects have been verified.
+   initialize_object_templates();
+}
+
+/*!
+ * @details Objects instantiated from a template use the unused elements at
+ * the end of the 'objects' array, which must be allocated with room for the
+ * configured objects plus the pool size of all the object templates. Only the
+ * first object of each template is instantiated here, the other objects are
+ * instantiated as instances are discovered.
+ * @job_class{initialization}
+ */
+void Manager::initialize_object_templates()
+{
+   // Check for the error condition of a valid template count but a null
+   // templates array.
+   if ( ( obj_template_count > 0 ) && ( obj_templates == NULL ) ) {
+      ostringstream errmsg;
+      errmsg << "Manager::initialize_object_templates():" << __LINE__
+             << " ERROR: Unexpected NULL 'obj_templates' array for a non zero"
+             << " obj_template_count:" << obj_template_count << ". Please check"
+             << " your input or modified-data files to make sure the"
+             << " 'Manager::obj_templates' array is correctly configured."
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Reset the TrickHLA Object Template count if negative or no templates.
+   if ( ( obj_template_count < 0 ) || ( obj_templates == NULL ) ) {
+      obj_template_count = 0;
+   }
+   if ( obj_template_count == 0 ) {
+      return;
+   }
+
+   // Number of configured objects, excluding any already instantiated from a
+   // template such as for a checkpoint restore.
+   int instantiated_count = 0;
+   for ( int t = 0; t < obj_template_count; ++t ) {
+      obj_templates[t].initialize();
+      instantiated_count += obj_templates[t].get_instance_count();
+   }
+   int const required_capacity = ( obj_count - instantiated_count ) + get_object_template_pool_size();
+
+   if ( (int)get_object_capacity() < required_capacity ) {
+      ostringstream errmsg;
+      errmsg << "Manager::initialize_object_templates():" << __LINE__
+             << " ERROR: The 'objects' array has " << get_object_capacity()
+             << " elements but " << required_capacity << " are needed for the "
+             << ( obj_count - instantiated_count ) << " configured objects plus"
+             << " the object template pool size of "
+             << get_object_template_pool_size() << ". Please check your input"
+             << " or modified-data files to make sure the 'Manager::objects'"
+             << " array is allocated with room for the object templates."
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Instantiate the first object of each template so that the object class
+   // handles are resolved and the class subscribed to along with all the
+   // other objects.
+   for ( int t = 0; t < obj_template_count; ++t ) {
+      if ( obj_templates[t].get_instance_count() == 0 ) {
+         obj_templates[t].instantiate( objects[obj_count], obj_count );
+
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &active_set_mutex );
+         ++obj_count;
+      }
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::initialize_object_templates():%d Templates:%d Objects:%d Capacity:%d%c",
+               __LINE__, obj_template_count, obj_count, get_object_capacity(),
+               THLA_NEWLINE );
+   }
+}
+
+int Manager::get_object_template_pool_size() const
+{
+   int pool_size = 0;
+   if ( obj_templates != NULL ) {
+      for ( int t = 0; t < obj_template_count; ++t ) {
+         if ( obj_templates[t].pool_size > 0 ) {
+            pool_size += obj_templates[t].pool_size;
+         }
+      }
+   }
+   return pool_size;
+}
+
+unsigned int Manager::get_object_capacity() const
+{
+   int capacity = ( objects != NULL ) ? get_size( static_cast< void * >( objects ) ) : 0;
+   return ( capacity > obj_count ) ? capacity : ( ( obj_count > 0 ) ? obj_count : 0 );
+}
+
+/*!
+ * @details The RTI callback thread only queues the discovered instances that
+ * had no free object to bind to, since the Trick memory allocations are not
+ * thread safe. The objects are instantiated here on the Trick main thread, so
+ * the memory used grows with the discovered instances up to the pool size.
+ * @job_class{scheduled}
+ */
+void Manager::instantiate_pending_template_objects()
+{
+   for ( int t = 0; t < obj_template_count; ++t ) {
+
+      int const proto_index = obj_templates[t].get_prototype_index();
+      if ( proto_index < 0 ) {
+         continue;
+      }
+      ObjectClassHandle const class_handle = objects[proto_index].get_class_handle();
+
+      ObjectInstanceHandle instance_hdl;
+      wstring              instance_name;
+      while ( true ) {
+         Object *trickhla_obj = NULL;
+         {
+            // When auto_unlock_mutex goes out of scope it automatically
+            // unlocks the mutex even if there is an exception.
+            MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+            if ( !obj_templates[t].get_pending_instance( instance_hdl, instance_name ) ) {
+               break;
+            }
+
+            // A deleted instance may have freed an object of the class.
+            trickhla_obj = get_unregistered_remote_object( class_handle );
+            if ( trickhla_obj != NULL ) {
+               obj_templates[t].pop_pending_instance();
+               bind_discovered_object( trickhla_obj, instance_hdl, instance_name );
+            }
+         }
+
+         if ( trickhla_obj == NULL ) {
+            // Instantiate without holding the discovery mutex so the RTI
+            // callback thread is not blocked by the Trick allocations.
+            trickhla_obj = instantiate_object_from_template( t );
+
+            // When auto_unlock_mutex goes out of scope it automatically
+            // unlocks the mutex even if there is an exception.
+            MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+            ObjectInstanceHandle pending_hdl;
+            wstring              pending_name;
+            if ( obj_templates[t].get_pending_instance( pending_hdl, pending_name )
+                 && ( pending_hdl == instance_hdl ) ) {
+               obj_templates[t].pop_pending_instance();
+               bind_discovered_object( trickhla_obj, instance_hdl, instance_name );
+            } else {
+               // The instance was deleted while the object was instantiated,
+               // so the object is left free for the next discovered instance.
+               unsigned int obj_index;
+               if ( this->discovery_index_initialized
+                    && get_object_index( trickhla_obj, obj_index ) ) {
+                  update_discovery_indexes( obj_index );
+               }
+               continue;
+            }
+         }
+
+         // Ask the owner for the values reflected before the object was bound.
+         trickhla_obj->request_attribute_value_update();
+      }
+   }
+}
+
+/*!
+ * @details The object is configured from the template and then initialized
+ * the same way as the objects configured at initialization, using the RTI
+ * handles resolved for the first object instantiated from the template. The
+ * object count is only incremented once the object is fully set up.
+ * @job_class{scheduled}
+ */
+Object *Manager::instantiate_object_from_template(
+   int const template_index )
+{
+   ObjectTemplate &obj_template = obj_templates[template_index];
+
+   if ( !obj_template.is_pool_available()
+        || ( (unsigned int)obj_count >= get_object_capacity() ) ) {
+      ostringstream errmsg;
+      errmsg << "Manager::instantiate_object_from_template():" << __LINE__
+             << " ERROR: The pool of " << obj_template.pool_size << " objects"
+             << " for Object Template '" << obj_template.name << "' is"
+             << " exhausted!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   unsigned int const obj_index = obj_count;
+   Object            &obj       = objects[obj_index];
+
+   obj_template.instantiate( obj, obj_index );
+
+   // Initialize the TrickHLA-Object and resolve its Trick Ref-Attributes.
+   obj.initialize( this );
+
+   Object const &proto = objects[obj_template.get_prototype_index()];
+   obj.set_class_handle( proto.get_class_handle() );
+
+   Attribute *attrs = obj.get_attributes();
+   for ( unsigned int i = 0; i < obj.get_attribute_count(); ++i ) {
+      attrs[i].initialize( obj.get_FOM_name(), obj_index, i );
+      attrs[i].set_attribute_handle( proto.attributes[i].get_attribute_handle() );
+      attrs[i].set_shared_memory_attribute_handle( proto.attributes[i].get_shared_memory_attribute_handle() );
+   }
+   obj.build_attribute_map();
+
+   // Make the object visible to the frame jobs now it is fully set up.
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+      ++obj_count;
+   }
+
+   return ( &obj );
 }
 
 /*!
@@ -851,6 +1434,78 @@ void Manager::request_data_update(
    return request_data_update( ws_obj_instance_name );
 }
 
+/*!
+ * @details Requesting the update per object class instead of per object
+ * instance lets a late joining federate catch up with a request per class,
+ * and the owners can pace the updates they send in response with the
+ * catch_up_cycle_count and catch_up_bytes_per_cycle settings.
+ * @job_class{initialization}
+ */
+void Manager::request_class_data_update()
+{
+   RTIambassador *rti_amb = get_RTI_ambassador();
+   if ( rti_amb == NULL ) {
+      send_hs( stderr, "Manager::request_class_data_update():%d Unexpected NULL RTIambassador!%c",
+               __LINE__, THLA_NEWLINE );
+      return;
+   }
+
+   // Merge the attributes to request for the discovered objects of each class.
+   map< ObjectClassHandle, AttributeHandleSet > class_attr_map;
+   ObjectIndexSet                               pending_obj_set;
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      if ( !objects[n].is_instance_handle_valid() ) {
+         continue;
+      }
+      AttributeHandleSet attr_handle_set;
+      objects[n].get_remotely_owned_subscribed_attributes( attr_handle_set );
+      if ( !attr_handle_set.empty() ) {
+         class_attr_map[objects[n].get_class_handle()].insert( attr_handle_set.begin(), attr_handle_set.end() );
+         pending_obj_set.insert( n );
+      }
+   }
+
+   {
+      // Track the objects before the request since the updates can be
+      // reflected before the request returns.
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+      catch_up_pending_obj_set = pending_obj_set;
+   }
+   this->catch_up_expected_count  = pending_obj_set.size();
+   this->catch_up_remaining_count = pending_obj_set.size();
+   this->catch_up_start_wall_time = MonotonicClock::get_time_micros();
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::request_class_data_update():%d Requesting %d objects of %d object classes.%c",
+               __LINE__, catch_up_expected_count, (int)class_attr_map.size(), THLA_NEWLINE );
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   map< ObjectClassHandle, AttributeHandleSet >::const_iterator iter;
+   for ( iter = class_attr_map.begin(); iter != class_attr_map.end(); ++iter ) {
+      try {
+         rti_amb->requestAttributeValueUpdate( iter->first,
+                                               iter->second,
+                                               RTI1516_USERDATA( 0, 0 ) );
+      } catch ( RTI1516_EXCEPTION const &e ) {
+         string id_str;
+         StringUtilities::to_string( id_str, iter->first );
+         string rti_err_msg;
+         StringUtilities::to_string( rti_err_msg, e.what() );
+         send_hs( stderr, "Manager::request_class_data_update():%d Exception for class_id=%s: '%s'%c",
+                  __LINE__, id_str.c_str(), rti_err_msg.c_str(), THLA_NEWLINE );
+      }
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -951,6 +1606,62 @@ void Manager::add_object_to_map(
    }
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void Manager::mark_object_as_changed(
+   Object const *object )
+{
+   unsigned int obj_index;
+   if ( get_object_index( object, obj_index ) ) {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+      changed_obj_set.insert( obj_index );
+
+      // Received data for an object requested when catching up.
+      if ( !catch_up_pending_obj_set.empty() ) {
+         catch_up_pending_obj_set.erase( obj_index );
+      }
+   }
+}
+
+/*!
+ * @details An object that publishes no cyclic attributes is not on the send
+ * schedule, so it has to be put back on it when that changes.
+ * @job_class{scheduled}
+ */
+void Manager::mark_object_send_schedule_changed(
+   Object const *object )
+{
+   unsigned int obj_index;
+   if ( get_object_index( object, obj_index ) ) {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+
+      unsigned int const thread_id = federate->get_send_thread_id_for_obj( obj_index );
+      if ( ( thread_id != 0 ) && ( thread_id < thread_reschedule_obj_set.size() ) ) {
+         thread_reschedule_obj_set[thread_id].insert( obj_index );
+      } else {
+         reschedule_obj_set.insert( obj_index );
+      }
+   }
+}
+
+bool Manager::get_object_index(
+   Object const *object,
+   unsigned int &obj_index ) const
+{
+   // The ExecutionConfiguration object is not part of the objects array.
+   if ( ( object == NULL ) || ( objects == NULL )
+        || ( object < objects ) || ( object >= ( objects + obj_count ) ) ) {
+      return false;
+   }
+   obj_index = (unsigned int)( object - objects );
+   return true;
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -970,6 +1681,12 @@ void Manager::setup_all_ref_attributes()
    // Make sure the object-map is empty/clear before we continue.
    object_map.clear();
 
+   // The active sets are rebuilt from the object states on the next data cycle.
+   clear_active_sets();
+
+   // The discovery indexes are rebuilt on the next object discovery.
+   clear_discovery_indexes();
+
    if ( is_execution_configuration_used() ) {
       if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
          send_hs( stdout, "Manager::setup_all_ref_attributes():%d Execution-Configuration %c",
@@ -991,7 +1708,23 @@ void Manager::setup_all_ref_attributes()
    setup_interaction_ref_attributes();
 }
 
+unsigned int Manager::get_setup_thread_count() const
+{
+   if ( this->setup_thread_count > 0 ) {
+      return (unsigned int)this->setup_thread_count;
+   }
+   if ( this->setup_thread_count == 0 ) {
+      long const cpu_count = sysconf( _SC_NPROCESSORS_ONLN );
+      return ( cpu_count > 1 ) ? (unsigned int)cpu_count : 1;
+   }
+   return 1;
+}
+
 /*!
+ * @details The objects are initialized in order on the calling thread since
+ * their packing, lag-compensation and ownership callbacks are user code. The
+ * attributes of the objects are then initialized on up to setup_thread_count
+ * threads, which take one object at a time.
  * @job_class{initialization}
  */
 void Manager::setup_object_ref_attributes(
@@ -1010,45 +1743,22 @@ void Manager::setup_object_ref_attributes(
                __LINE__, THLA_NEWLINE );
    }
 
-   // Resolve all the Ref-Attributes for all the simulation initialization
-   // objects and attributes.
-   for ( unsigned int n = 0; n < data_obj_count; ++n ) {
+   RefAttributeSetup ref_setup( data_objects, NULL, data_obj_count );
 
-      // Initialize the TrickHLA-Object before we use it.
+   // Initialize the TrickHLA-Objects before we use them.
+   for ( unsigned int n = 0; n < data_obj_count; ++n ) {
+      int64_t const start_time = MonotonicClock::get_time_micros();
       data_objects[n].initialize( this );
+      ref_setup.add_time( data_objects[n].get_FOM_name(), 1, 0,
+                          MonotonicClock::get_time_micros() - start_time );
+   }
 
-      ostringstream msg;
+   // Resolve all the Ref-Attributes for all the simulation initialization
+   // objects and attributes.
+   ref_setup.run( get_setup_thread_count() );
 
-      int const  attr_count = data_objects[n].get_attribute_count();
-      Attribute *attrs      = data_objects[n].get_attributes();
-
-      if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-         msg << "Manager::setup_object_ref_attributes()" << __LINE__ << endl
-             << "--------------- Trick REF-Attributes ---------------" << endl
-             << " Object:'" << data_objects[n].get_name() << "'"
-             << " FOM-Name:'" << data_objects[n].get_FOM_name() << "'"
-             << " Create HLA Instance:"
-             << ( data_objects[n].is_create_HLA_instance() ? "Yes" : "No" )
-             << " Attribute count:" << attr_count << endl;
-      }
-
-      // Process the attributes for this object.
-      for ( unsigned int i = 0; i < attr_count; ++i ) {
-
-         // Initialize the TrickHLA-Attribute before we use it.
-         attrs[i].initialize( data_objects[n].get_FOM_name(), n, i );
-
-         if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-            msg << "   " << ( i + 1 ) << "/" << attr_count
-                << " FOM-Attribute:'" << attrs[i].get_FOM_name() << "'"
-                << " Trick-Name:'" << attrs[i].get_trick_name() << "'"
-                << endl;
-         }
-      }
-
-      if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-         send_hs( stdout, msg.str().c_str() );
-      }
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      ref_setup.report( "Manager::setup_object_ref_attributes():" );
    }
 }
 
@@ -1069,40 +1779,21 @@ void Manager::setup_interaction_ref_attributes()
                __LINE__, THLA_NEWLINE );
    }
 
-   // Interactions.
-   for ( int n = 0; n < inter_count; ++n ) {
-      ostringstream msg;
-
-      if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-         msg << "Manager::setup_interaction_ref_attributes():" << __LINE__ << endl
-             << "--------------- Trick REF-Attributes ---------------" << endl
-             << " FOM-Interaction:'" << interactions[n].get_FOM_name() << "'"
-             << endl;
-      }
+   RefAttributeSetup ref_setup( NULL, interactions, inter_count );
 
-      // Initialize the TrickHLA Interaction before we use it.
+   // Initialize the TrickHLA Interactions before we use them.
+   for ( int n = 0; n < inter_count; ++n ) {
+      int64_t const start_time = MonotonicClock::get_time_micros();
       interactions[n].initialize( this );
+      ref_setup.add_time( interactions[n].get_FOM_name(), 1, 0,
+                          MonotonicClock::get_time_micros() - start_time );
+   }
 
-      int const  param_count = interactions[n].get_parameter_count();
-      Parameter *params      = interactions[n].get_parameters();
-
-      // Process the attributes for this object.
-      for ( unsigned int i = 0; i < param_count; ++i ) {
-
-         if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-            msg << "   " << ( i + 1 ) << "/" << param_count
-                << " FOM-Parameter:'" << params[i].get_FOM_name() << "'"
-                << " Trick-Name:'" << params[i].get_trick_name() << "'"
-                << endl;
-         }
-
-         // Initialize the TrickHLA Parameter.
-         params[i].initialize( interactions[n].get_FOM_name(), n, i );
-      }
+   // Initialize the parameters of the interactions.
+   ref_setup.run( get_setup_thread_count() );
 
-      if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-         send_hs( stdout, msg.str().c_str() );
-      }
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      ref_setup.report( "Manager::setup_interaction_ref_attributes():" );
    }
 
    // Tell the ExecutionControl object to setup the appropriate Trick Ref
@@ -1230,6 +1921,15 @@ void Manager::setup_object_RTI_handles(
             attrs[i].set_attribute_handle(
                rti_amb->getAttributeHandle( data_objects[n].get_class_handle(), ws_FOM_name ) );
 
+            // Get the handle of the separate attribute that carries the
+            // shared-memory descriptor of the value.
+            if ( attrs[i].is_shared_memory() ) {
+               attr_FOM_name = attrs[i].get_shared_memory_FOM_name();
+               StringUtilities::to_wstring( ws_FOM_name, attr_FOM_name );
+               attrs[i].set_shared_memory_attribute_handle(
+                  rti_amb->getAttributeHandle( data_objects[n].get_class_handle(), ws_FOM_name ) );
+            }
+
             if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
                string id_str;
                StringUtilities::to_string( id_str,
@@ -2229,6 +2929,13 @@ void Manager::provide_attribute_update(
    Object *trickhla_obj = get_trickhla_object( theObject );
    if ( trickhla_obj != NULL ) {
       trickhla_obj->provide_attribute_update( theAttributes );
+
+      // Add the object to the active set of objects to send requested data for.
+      unsigned int obj_index;
+      if ( trickhla_obj->is_attribute_update_requested()
+           && get_object_index( trickhla_obj, obj_index ) ) {
+         add_requested_object( obj_index );
+      }
    } else {
       this->execution_control->provide_attribute_update( theObject, theAttributes );
    }
@@ -2279,6 +2986,368 @@ void Manager::determine_job_cycle_time()
    }
 }
 
+void Manager::clear_active_sets()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &active_set_mutex );
+
+   changed_obj_set.clear();
+   deleted_obj_set.clear();
+   requested_obj_set.clear();
+   reschedule_obj_set.clear();
+   catch_up_queue.clear();
+   catch_up_queued_obj_set.clear();
+   blocking_read_obj_list.clear();
+   always_send_obj_list.clear();
+   send_schedule.clear();
+   obj_next_send_cycle.clear();
+   obj_last_send_cycle.clear();
+
+   for ( unsigned int id = 0; id < thread_send_schedule.size(); ++id ) {
+      thread_requested_obj_set[id].clear();
+      thread_reschedule_obj_set[id].clear();
+      thread_always_send_obj_list[id].clear();
+      thread_send_cycle_count[id] = 0LL;
+      thread_send_schedule[id].clear();
+      thread_obj_next_send_cycle[id].clear();
+      thread_obj_last_send_cycle[id].clear();
+   }
+
+   this->send_cycle_count          = 0LL;
+   this->catch_up_objs_per_cycle   = 0;
+   this->active_sets_initialized   = false;
+   this->send_schedule_initialized = false;
+}
+
+/*!
+ * @details Seeds the active sets from the current object states, which is
+ * the only time all the objects are scanned. After this the active sets are
+ * maintained by the RTI callbacks.
+ * @job_class{scheduled}
+ */
+void Manager::initialize_active_sets()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &active_set_mutex );
+
+   blocking_read_obj_list.clear();
+
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+
+      // Any data received before the active sets were initialized.
+      changed_obj_set.insert( n );
+
+      if ( objects[n].process_object_deleted_from_RTI ) {
+         deleted_obj_set.insert( n );
+      }
+      if ( objects[n].is_attribute_update_requested() ) {
+         insert_requested_object( n );
+      }
+
+      // Blocking reads wait for data every data cycle even if none arrived.
+      if ( objects[n].blocking_cyclic_read ) {
+         blocking_read_obj_list.push_back( n );
+      }
+   }
+
+   this->active_sets_initialized = true;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::initialize_active_sets():%d Objects:%d Blocking-Reads:%d%c",
+               __LINE__, obj_count, (int)blocking_read_obj_list.size(), THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @details Objects associated to a Trick child thread with a data cycle
+ * different than the job cycle, or with an ownership handler that can reset
+ * the attribute sub-rate counters, are checked every data cycle. All other
+ * objects are only visited on the data cycle they are due to send. The
+ * objects a Trick child thread sends are scheduled by that thread.
+ * @job_class{scheduled}
+ */
+void Manager::initialize_send_schedule()
+{
+   // Only the objects instantiated from a template since the last call need
+   // to be scheduled.
+   unsigned int const first_index = obj_next_send_cycle.size();
+   obj_next_send_cycle.resize( obj_count, -1LL );
+   obj_last_send_cycle.resize( obj_count, send_cycle_count );
+
+   for ( unsigned int n = first_index; n < obj_count; ++n ) {
+      // Apply any current send rate degradation to the newly added objects.
+      if ( this->send_degradation_level > 0 ) {
+         objects[n].set_send_degradation_level( this->send_degradation_level, this->degrade_factor );
+      }
+      if ( federate->get_send_thread_id_for_obj( n ) != 0 ) {
+         continue;
+      }
+      if ( ( objects[n].ownership != NULL )
+           || ( federate->get_data_cycle_base_time_for_obj( n, this->job_cycle_base_time ) != this->job_cycle_base_time ) ) {
+         always_send_obj_list.push_back( n );
+         obj_next_send_cycle[n] = -2LL; // Never in the send schedule.
+      } else {
+         schedule_object_send( n );
+      }
+   }
+
+   this->send_schedule_initialized = true;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::initialize_send_schedule():%d Scheduled:%d Always-Checked:%d%c",
+               __LINE__, (int)send_schedule.size(), (int)always_send_obj_list.size(),
+               THLA_NEWLINE );
+   }
+}
+
+void Manager::schedule_object_send(
+   unsigned int const obj_index )
+{
+   int const cycles = objects[obj_index].get_data_cycles_until_ready();
+   if ( cycles > 0 ) {
+      obj_next_send_cycle[obj_index] = send_cycle_count + cycles;
+      send_schedule.insert( make_pair( obj_next_send_cycle[obj_index], obj_index ) );
+   } else {
+      // The object does not publish any cyclic attributes.
+      obj_next_send_cycle[obj_index] = -1LL;
+   }
+}
+
+void Manager::setup_thread_send_schedules()
+{
+   unsigned int const thread_count = exec_get_num_threads();
+
+   thread_requested_obj_set.assign( thread_count, ObjectIndexSet() );
+   thread_reschedule_obj_set.assign( thread_count, ObjectIndexSet() );
+   thread_always_send_obj_list.assign( thread_count, std::vector< unsigned int >() );
+   thread_send_cycle_count.assign( thread_count, 0LL );
+   thread_send_schedule.assign( thread_count, ObjectIndexScheduleMap() );
+   thread_obj_next_send_cycle.assign( thread_count, std::vector< int64_t >() );
+   thread_obj_last_send_cycle.assign( thread_count, std::vector< int64_t >() );
+}
+
+/*!
+ * @details Objects with an ownership handler that can reset the attribute
+ * sub-rate counters are checked every data cycle of the Trick child thread.
+ * All other objects of the thread are only visited on the thread data cycle
+ * they are due to send.
+ * @job_class{scheduled}
+ */
+void Manager::initialize_thread_send_schedule(
+   unsigned int const thread_id,
+   unsigned int const thread_obj_count )
+{
+   std::vector< int64_t > &next_send_cycle = thread_obj_next_send_cycle[thread_id];
+
+   // Only the objects instantiated from a template since the last call need
+   // to be scheduled.
+   unsigned int const first_index = next_send_cycle.size();
+   next_send_cycle.resize( thread_obj_count, -1LL );
+   thread_obj_last_send_cycle[thread_id].resize( thread_obj_count, thread_send_cycle_count[thread_id] );
+
+   for ( unsigned int n = first_index; n < thread_obj_count; ++n ) {
+      if ( federate->get_send_thread_id_for_obj( n ) != thread_id ) {
+         continue;
+      }
+      if ( objects[n].ownership != NULL ) {
+         thread_always_send_obj_list[thread_id].push_back( n );
+         next_send_cycle[n] = -2LL; // Never in the send schedule.
+      } else {
+         schedule_object_send_for_thread( thread_id, n );
+      }
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::initialize_thread_send_schedule():%d Child Thread:%d Scheduled:%d Always-Checked:%d%c",
+               __LINE__, thread_id, (int)thread_send_schedule[thread_id].size(),
+               (int)thread_always_send_obj_list[thread_id].size(), THLA_NEWLINE );
+   }
+}
+
+void Manager::schedule_object_send_for_thread(
+   unsigned int const thread_id,
+   unsigned int const obj_index )
+{
+   int const cycles = objects[obj_index].get_data_cycles_until_ready();
+   if ( cycles > 0 ) {
+      thread_obj_next_send_cycle[thread_id][obj_index] = thread_send_cycle_count[thread_id] + cycles;
+      thread_send_schedule[thread_id].insert( make_pair( thread_obj_next_send_cycle[thread_id][obj_index], obj_index ) );
+   } else {
+      // The object does not publish any cyclic attributes.
+      thread_obj_next_send_cycle[thread_id][obj_index] = -1LL;
+   }
+}
+
+void Manager::insert_requested_object(
+   unsigned int const obj_index )
+{
+   unsigned int const thread_id = federate->get_send_thread_id_for_obj( obj_index );
+   if ( ( thread_id != 0 ) && ( thread_id < thread_requested_obj_set.size() ) ) {
+      thread_requested_obj_set[thread_id].insert( obj_index );
+   } else {
+      requested_obj_set.insert( obj_index );
+   }
+}
+
+/*!
+ * @details Objects sent by a Trick child thread are checked for requests
+ * every data cycle of that thread, so only the objects the Trick main thread
+ * sends are paced.
+ * @job_class{scheduled}
+ */
+void Manager::add_requested_object(
+   unsigned int const obj_index )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &active_set_mutex );
+
+   if ( is_catch_up_paced() && ( federate->get_send_thread_id_for_obj( obj_index ) == 0 ) ) {
+      if ( catch_up_queued_obj_set.insert( obj_index ).second ) {
+         catch_up_queue.push_back( obj_index );
+      }
+   } else {
+      insert_requested_object( obj_index );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Manager::requeue_requested_object(
+   unsigned int const obj_index )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &active_set_mutex );
+
+   if ( is_catch_up_paced() && ( federate->get_send_thread_id_for_obj( obj_index ) == 0 ) ) {
+      if ( catch_up_queued_obj_set.insert( obj_index ).second ) {
+         catch_up_queue.push_front( obj_index );
+      }
+   } else {
+      insert_requested_object( obj_index );
+   }
+}
+
+/*!
+ * @details The objects are sent in the order the requests arrived. With a
+ * catch_up_cycle_count the number of objects sent per data cycle is set so
+ * the queue empties in that many data cycles, and with a
+ * catch_up_bytes_per_cycle the objects are sent until their estimated size
+ * reaches the budget. At least one object is sent every data cycle.
+ * @job_class{scheduled}
+ */
+void Manager::schedule_catch_up_objects(
+   ObjectIndexSet &due_obj_set )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &active_set_mutex );
+
+   if ( catch_up_queue.empty() ) {
+      this->catch_up_objs_per_cycle = 0;
+      return;
+   }
+
+   // Only raise the rate for new requests so the queue still empties in the
+   // catch-up cycle count instead of slowing down as it gets shorter.
+   if ( this->catch_up_cycle_count > 0 ) {
+      size_t const objs_per_cycle = ( catch_up_queue.size() + catch_up_cycle_count - 1 ) / catch_up_cycle_count;
+      if ( objs_per_cycle > this->catch_up_objs_per_cycle ) {
+         this->catch_up_objs_per_cycle = objs_per_cycle;
+      }
+   }
+
+   size_t obj_cnt  = 0;
+   size_t byte_cnt = 0;
+   while ( !catch_up_queue.empty() ) {
+      if ( ( this->catch_up_cycle_count > 0 ) && ( obj_cnt >= this->catch_up_objs_per_cycle ) ) {
+         break;
+      }
+      unsigned int const n = catch_up_queue.front();
+
+      // The request was already answered if the object sent its requested
+      // attributes with its cyclic data, or is sending them this data cycle.
+      if ( objects[n].is_attribute_update_requested()
+           && ( due_obj_set.find( n ) == due_obj_set.end() ) ) {
+
+         size_t const size = objects[n].get_requested_attribute_size();
+         if ( ( this->catch_up_bytes_per_cycle > 0 )
+              && ( obj_cnt > 0 )
+              && ( ( byte_cnt + size ) > (size_t)this->catch_up_bytes_per_cycle ) ) {
+            break;
+         }
+         due_obj_set.insert( n );
+         ++obj_cnt;
+         byte_cnt += size;
+      }
+      catch_up_queue.pop_front();
+      catch_up_queued_obj_set.erase( n );
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::schedule_catch_up_objects():%d Sending:%d Bytes:%d Queued:%d%c",
+               __LINE__, (int)obj_cnt, (int)byte_cnt, (int)catch_up_queue.size(), THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+unsigned int Manager::get_catch_up_queue_size()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &active_set_mutex );
+   return catch_up_queue.size();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Manager::check_catch_up_progress()
+{
+   unsigned int remaining_count;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+      remaining_count = catch_up_pending_obj_set.size();
+
+      // Stop waiting for the objects whose owner never answered the request.
+      if ( ( remaining_count > 0 )
+           && ( this->catch_up_timeout > 0.0 )
+           && ( (double)( MonotonicClock::get_time_micros() - catch_up_start_wall_time ) > ( this->catch_up_timeout * 1000000.0 ) ) ) {
+         send_hs( stderr, "Manager::check_catch_up_progress():%d WARNING: Gave up on %d of %d requested objects not received in %G seconds.%c",
+                  __LINE__, remaining_count, catch_up_expected_count,
+                  this->catch_up_timeout, THLA_NEWLINE );
+         catch_up_pending_obj_set.clear();
+         this->catch_up_remaining_count = 0;
+         return;
+      }
+   }
+   if ( remaining_count == this->catch_up_remaining_count ) {
+      return;
+   }
+   this->catch_up_remaining_count = remaining_count;
+
+   if ( remaining_count > 0 ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         send_hs( stdout, "Manager::check_catch_up_progress():%d Received %d of %d requested objects (%.1f%%).%c",
+                  __LINE__, catch_up_expected_count - remaining_count, catch_up_expected_count,
+                  100.0 * get_catch_up_progress(), THLA_NEWLINE );
+      }
+   } else if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::check_catch_up_progress():%d Caught up, received all %d requested objects in %.3f seconds.%c",
+               __LINE__, catch_up_expected_count,
+               (double)( MonotonicClock::get_time_micros() - catch_up_start_wall_time ) / 1000000.0,
+               THLA_NEWLINE );
+   }
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -2290,6 +3359,7 @@ void Manager::send_cyclic_and_requested_data()
    }
 
    // Current time values.
+   int64_t const start_wall_time       = is_send_degradation_enabled() ? MonotonicClock::get_time_micros() : 0LL;
    int64_t const sim_time_in_base_time = Int64BaseTime::to_base_time( exec_get_sim_time() );
    int64_t const granted_base_time     = get_granted_base_time();
    int64_t const lookahead_base_time   = federate->is_zero_lookahead_time()
@@ -2340,8 +3410,55 @@ void Manager::send_cyclic_and_requested_data()
    // Send any ExecutionControl data requested.
    this->execution_control->send_requested_data( update_time );
 
-   // Send data to remote RTI federates for each of the objects.
-   for ( unsigned int obj_index = 0; obj_index < this->obj_count; ++obj_index ) {
+   if ( !this->send_schedule_initialized
+        || ( obj_next_send_cycle.size() != (size_t)obj_count ) ) {
+      initialize_send_schedule();
+   }
+   ++send_cycle_count;
+
+   // Build the set of objects to visit this data cycle. The set is ordered by
+   // object index so the data is sent in the same order as the objects array.
+   ObjectIndexSet due_obj_set( always_send_obj_list.begin(), always_send_obj_list.end() );
+   ObjectIndexSet reschedule_set;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+      due_obj_set.insert( requested_obj_set.begin(), requested_obj_set.end() );
+      requested_obj_set.clear();
+      reschedule_set.swap( reschedule_obj_set );
+   }
+
+   // Put the objects with a publish or ownership change back on the send
+   // schedule, where an older schedule entry is ignored as stale.
+   ObjectIndexSet::const_iterator iter;
+   for ( iter = reschedule_set.begin(); iter != reschedule_set.end(); ++iter ) {
+      if ( ( *iter < obj_next_send_cycle.size() ) && ( obj_next_send_cycle[*iter] != -2LL ) ) {
+         schedule_object_send( *iter );
+      }
+   }
+   while ( !send_schedule.empty() && ( send_schedule.begin()->first <= send_cycle_count ) ) {
+      unsigned int const n = send_schedule.begin()->second;
+
+      // Ignore stale entries for objects that were rescheduled after being
+      // visited early because of an attribute update request.
+      if ( obj_next_send_cycle[n] == send_schedule.begin()->first ) {
+         due_obj_set.insert( n );
+      }
+      send_schedule.erase( send_schedule.begin() );
+   }
+   if ( is_catch_up_paced() ) {
+      schedule_catch_up_objects( due_obj_set );
+   }
+
+   // Send data to remote RTI federates for each of the objects due.
+   for ( iter = due_obj_set.begin(); iter != due_obj_set.end(); ++iter ) {
+      unsigned int const obj_index = *iter;
+
+      // Skip the objects a Trick child thread sends itself.
+      if ( federate->get_send_thread_id_for_obj( obj_index ) != 0 ) {
+         continue;
+      }
 
       // Only send data if we are on the data cycle time boundary for this object.
       if ( federate->on_data_cycle_boundary_for_obj( obj_index, sim_time_in_base_time ) ) {
@@ -2361,105 +3478,719 @@ void Manager::send_cyclic_and_requested_data()
             }
          }
 
+         // Account for the data cycles the scheduled object was not visited.
+         bool const scheduled = ( obj_next_send_cycle[obj_index] != -2LL );
+         if ( scheduled ) {
+            objects[obj_index].skip_data_cycles( (int)( send_cycle_count - obj_last_send_cycle[obj_index] - 1 ) );
+            obj_last_send_cycle[obj_index] = send_cycle_count;
+         }
+
          // Send the data for the object using the cycle time for this object.
          objects[obj_index].send_cyclic_and_requested_data( update_time );
+
+         if ( scheduled ) {
+            schedule_object_send( obj_index );
+         }
+      } else {
+         if ( objects[obj_index].is_attribute_update_requested() ) {
+            // Keep the update request active until the data cycle boundary.
+            requeue_requested_object( obj_index );
+         }
+         if ( ( obj_next_send_cycle[obj_index] >= 0LL )
+              && ( obj_next_send_cycle[obj_index] <= send_cycle_count ) ) {
+            // Check the scheduled object again next data cycle.
+            obj_next_send_cycle[obj_index] = send_cycle_count + 1;
+            send_schedule.insert( make_pair( obj_next_send_cycle[obj_index], obj_index ) );
+         }
       }
    }
+
+   // Send the interactions queued by the Trick threads this frame.
+   flush_interaction_outboxes();
+
+   if ( is_send_degradation_enabled() ) {
+      update_send_degradation( this->receive_wall_time + ( MonotonicClock::get_time_micros() - start_wall_time ) );
+      this->receive_wall_time = 0LL;
+   }
 }
 
 /*!
- * @details If the object is owned remotely, this function copies its internal
- * data into simulation object and marks the object as "unchanged". This data
- * was deposited by the reflect callback and marked as "changed". By marking
- * it as unchanged, we avoid copying the same data over and over. If the object
- * is locally owned, we shouldn't be receiving any remote data anyway and if
- * we were to -- bogusly -- copy it to the internal byte buffer, we'd
- * continually reset our local simulation.
+ * @details Called from the Trick child thread when its data cycle completes,
+ * after the Trick main thread has the grant for the frame. The objects are
+ * sent with the same update time the main thread would use, which is the
+ * granted time plus the data cycle time of the object. Like the main thread,
+ * the child thread only visits the objects due on its send schedule, always
+ * checked or with an attribute update request.
  * @job_class{scheduled}
  */
-void Manager::receive_cyclic_data()
+void Manager::send_cyclic_and_requested_data_for_thread(
+   unsigned int const thread_id )
 {
-   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-      send_hs( stdout, "Manager::receive_cyclic_data():%d%c",
-               __LINE__, THLA_NEWLINE );
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::send_cyclic_and_requested_data_for_thread():%d Child Thread:%d%c",
+               __LINE__, thread_id, THLA_NEWLINE );
+   }
+
+   if ( thread_id >= thread_send_schedule.size() ) {
+      ostringstream errmsg;
+      errmsg << "Manager::send_cyclic_and_requested_data_for_thread():" << __LINE__
+             << " ERROR: The Trick child thread ID " << thread_id
+             << " is not less than the " << thread_send_schedule.size()
+             << " Trick threads the send schedules were set up for!"
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
    }
 
+   // The object count is shared with the Trick main thread.
+   unsigned int thread_obj_count;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+      thread_obj_count = obj_count;
+   }
+
+   // Current time values.
    int64_t const sim_time_in_base_time = Int64BaseTime::to_base_time( exec_get_sim_time() );
+   int64_t const granted_base_time     = get_granted_base_time();
+   int64_t const lookahead_base_time   = federate->is_zero_lookahead_time()
+                                            ? 0LL
+                                            : federate->get_lookahead_in_base_time();
 
-   // Receive and process any updates for ExecutionControl.
-   this->execution_control->receive_cyclic_data();
+   // The send schedule of this child thread, which only this thread accesses.
+   ObjectIndexScheduleMap &schedule        = thread_send_schedule[thread_id];
+   std::vector< int64_t > &next_send_cycle = thread_obj_next_send_cycle[thread_id];
+   std::vector< int64_t > &last_send_cycle = thread_obj_last_send_cycle[thread_id];
+   int64_t                &cycle_count     = thread_send_cycle_count[thread_id];
 
-   // Receive data from remote RTI federates for each of the objects.
-   for ( unsigned int n = 0; n < obj_count; ++n ) {
+   if ( next_send_cycle.size() != (size_t)thread_obj_count ) {
+      initialize_thread_send_schedule( thread_id, thread_obj_count );
+   }
+   ++cycle_count;
 
-      // Only receive data if we are on the data cycle time boundary for this object.
-      if ( federate->on_data_cycle_boundary_for_obj( n, sim_time_in_base_time ) ) {
-         objects[n].receive_cyclic_data();
+   // Build the set of objects to visit this data cycle. The set is ordered by
+   // object index so the data is sent in the same order as the objects array.
+   ObjectIndexSet due_obj_set( thread_always_send_obj_list[thread_id].begin(),
+                               thread_always_send_obj_list[thread_id].end() );
+   ObjectIndexSet reschedule_set;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+      due_obj_set.insert( thread_requested_obj_set[thread_id].begin(),
+                          thread_requested_obj_set[thread_id].end() );
+      thread_requested_obj_set[thread_id].clear();
+      reschedule_set.swap( thread_reschedule_obj_set[thread_id] );
+   }
+
+   // Put the objects with a publish or ownership change back on the send
+   // schedule, where an older schedule entry is ignored as stale.
+   ObjectIndexSet::const_iterator iter;
+   for ( iter = reschedule_set.begin(); iter != reschedule_set.end(); ++iter ) {
+      if ( ( *iter < next_send_cycle.size() ) && ( next_send_cycle[*iter] != -2LL ) ) {
+         schedule_object_send_for_thread( thread_id, *iter );
       }
    }
-}
-
-/*!
- * @job_class{scheduled}
- */
-void Manager::process_interactions()
-{
-   // Process any ExecutionControl mode transitions.
-   this->execution_control->process_mode_interaction();
+   while ( !schedule.empty() && ( schedule.begin()->first <= cycle_count ) ) {
+      unsigned int const n = schedule.begin()->second;
 
-   // Just return if the interaction queue is empty.
-   if ( interactions_queue.empty() ) {
-      return;
+      // Ignore stale entries for objects that were rescheduled after being
+      // visited early because of an attribute update request.
+      if ( next_send_cycle[n] == schedule.begin()->first ) {
+         due_obj_set.insert( n );
+      }
+      schedule.erase( schedule.begin() );
    }
 
-   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-      send_hs( stdout, "Manager::process_interactions():%d%c",
+   int64_t   prev_dt = -1LL;
+   Int64Time update_time;
+
+   // Send data to remote RTI federates for each of the objects due.
+   for ( iter = due_obj_set.begin(); iter != due_obj_set.end(); ++iter ) {
+      unsigned int const obj_index = *iter;
+
+      // Only send data if we are on the data cycle time boundary for this object.
+      if ( federate->on_data_cycle_boundary_for_obj( obj_index, sim_time_in_base_time ) ) {
+
+         // Get the cyclic data time for the object, which is the data cycle
+         // time of the child thread that owns it.
+         int64_t const dt = federate->get_data_cycle_base_time_for_obj( obj_index, this->job_cycle_base_time );
+
+         // Reuse the update_time if the data cycle time (dt) is the same.
+         if ( dt != prev_dt ) {
+            prev_dt = dt;
+
+            // Make sure the update time is not less than the granted time + lookahead,
+            // which happens if the delta-time step is less than the lookahead time.
+            update_time.set( granted_base_time + ( ( dt < lookahead_base_time ) ? lookahead_base_time : dt ) );
+         }
+
+         // Account for the data cycles the scheduled object was not visited.
+         bool const scheduled = ( next_send_cycle[obj_index] != -2LL );
+         if ( scheduled ) {
+            objects[obj_index].skip_data_cycles( (int)( cycle_count - last_send_cycle[obj_index] - 1 ) );
+            last_send_cycle[obj_index] = cycle_count;
+         }
+
+         // Send the data for the object using the cycle time for this object.
+         objects[obj_index].send_cyclic_and_requested_data( update_time );
+
+         if ( scheduled ) {
+            schedule_object_send_for_thread( thread_id, obj_index );
+         }
+      } else {
+         if ( objects[obj_index].is_attribute_update_requested() ) {
+            // Keep the update request active until the data cycle boundary.
+            requeue_requested_object( obj_index );
+         }
+         if ( ( next_send_cycle[obj_index] >= 0LL )
+              && ( next_send_cycle[obj_index] <= cycle_count ) ) {
+            // Check the scheduled object again next data cycle.
+            next_send_cycle[obj_index] = cycle_count + 1;
+            schedule.insert( make_pair( next_send_cycle[obj_index], obj_index ) );
+         }
+      }
+   }
+}
+
+void Manager::verify_send_degradation_settings()
+{
+   if ( !is_send_degradation_enabled() ) {
+      return;
+   }
+   if ( this->degrade_factor < 2 ) {
+      ostringstream errmsg;
+      errmsg << "Manager::verify_send_degradation_settings():" << __LINE__
+             << " ERROR: The 'degrade_factor' of " << this->degrade_factor
+             << " must be 2 or greater when a 'send_receive_budget' is"
+             << " specified. Please check your input or modified-data files."
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( ( this->degrade_cycle_count < 1 ) || ( this->recover_cycle_count < 1 ) ) {
+      ostringstream errmsg;
+      errmsg << "Manager::verify_send_degradation_settings():" << __LINE__
+             << " ERROR: The 'degrade_cycle_count' (" << this->degrade_cycle_count
+             << ") and 'recover_cycle_count' (" << this->recover_cycle_count
+             << ") must be 1 or greater. Please check your input or"
+             << " modified-data files." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( ( this->recover_budget_fraction <= 0.0 ) || ( this->recover_budget_fraction > 1.0 ) ) {
+      ostringstream errmsg;
+      errmsg << "Manager::verify_send_degradation_settings():" << __LINE__
+             << " ERROR: The 'recover_budget_fraction' of "
+             << this->recover_budget_fraction << " must be greater than 0"
+             << " and no more than 1. Please check your input or"
+             << " modified-data files." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+}
+
+void Manager::verify_interactions_queue_settings()
+{
+   if ( this->interactions_queue_max_depth < 0 ) {
+      ostringstream errmsg;
+      errmsg << "Manager::verify_interactions_queue_settings():" << __LINE__
+             << " ERROR: The 'interactions_queue_max_depth' of "
+             << this->interactions_queue_max_depth << " must be zero (unbounded)"
+             << " or greater. Please check your input or modified-data files."
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( ( this->interactions_queue_policy < QUEUE_OVERFLOW_FIRST_VALUE )
+        || ( this->interactions_queue_policy > QUEUE_OVERFLOW_LAST_VALUE ) ) {
+      ostringstream errmsg;
+      errmsg << "Manager::verify_interactions_queue_settings():" << __LINE__
+             << " ERROR: The 'interactions_queue_policy' has a value that is"
+             << " out of the valid range of " << QUEUE_OVERFLOW_FIRST_VALUE
+             << " to " << QUEUE_OVERFLOW_LAST_VALUE << ". Please check your"
+             << " input or modified-data files." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( this->queue_block_timeout < 0.0 ) {
+      ostringstream errmsg;
+      errmsg << "Manager::verify_interactions_queue_settings():" << __LINE__
+             << " ERROR: The 'queue_block_timeout' of " << this->queue_block_timeout
+             << " must be zero or greater. Please check your input or"
+             << " modified-data files." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+}
+
+/*!
+ * @details Degrades one level at a time after being over budget for
+ * degrade_cycle_count data cycles, and recovers one level at a time after
+ * being under the recover budget for recover_cycle_count data cycles, so the
+ * send rates do not oscillate with the load.
+ */
+void Manager::update_send_degradation(
+   int64_t const send_receive_time )
+{
+   this->send_receive_wall_time = send_receive_time;
+
+   double const time = (double)send_receive_time / 1000000.0;
+   int          level = this->send_degradation_level;
+
+   if ( time > this->send_receive_budget ) {
+      this->under_budget_cycles = 0;
+      if ( ( ++this->over_budget_cycles >= this->degrade_cycle_count )
+           && ( level < SEND_PRIORITY_LOW ) ) {
+         ++level;
+         this->over_budget_cycles = 0;
+      }
+   } else {
+      this->over_budget_cycles = 0;
+      if ( time <= ( this->send_receive_budget * this->recover_budget_fraction ) ) {
+         if ( ( ++this->under_budget_cycles >= this->recover_cycle_count )
+              && ( level > 0 ) ) {
+            --level;
+            this->under_budget_cycles = 0;
+         }
+      } else {
+         this->under_budget_cycles = 0;
+      }
+   }
+
+   if ( level == this->send_degradation_level ) {
+      return;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::update_send_degradation():%d Send-receive time %.6f \
+seconds, budget %.6f seconds, degradation level changed from %d to %d.%c",
+               __LINE__, time, this->send_receive_budget,
+               this->send_degradation_level, level, THLA_NEWLINE );
+   }
+
+   this->send_degradation_level = level;
+
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      objects[n].set_send_degradation_level( level, this->degrade_factor );
+
+      // Reschedule the object for its new send rate, which makes any existing
+      // entry in the send schedule stale.
+      if ( ( n < obj_next_send_cycle.size() ) && ( obj_next_send_cycle[n] >= 0LL ) ) {
+         schedule_object_send( n );
+      }
+   }
+}
+
+void Manager::start_async_send()
+{
+   if ( !this->async_send || this->sender_thread.is_running() ) {
+      return;
+   }
+   if ( this->async_send_queue_limit < 1 ) {
+      ostringstream errmsg;
+      errmsg << "Manager::start_async_send():" << __LINE__
+             << " ERROR: The 'async_send_queue_limit' of "
+             << this->async_send_queue_limit << " must be 1 or greater when"
+             << " 'async_send' is enabled. Please check your input or"
+             << " modified-data files." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   this->sender_thread.start( (unsigned int)this->async_send_queue_limit );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void Manager::stop_async_send()
+{
+   if ( !this->sender_thread.is_running() ) {
+      return;
+   }
+   this->sender_thread.stop();
+
+   if ( this->sender_thread.get_blocked_count() > 0 ) {
+      send_hs( stderr, "Manager::stop_async_send():%d WARNING: The sender \
+thread queue was full %llu times, consider increasing the \
+'async_send_queue_limit' of %d (max-queue-depth:%u).%c",
+               __LINE__, this->sender_thread.get_blocked_count(),
+               this->async_send_queue_limit,
+               this->sender_thread.get_max_queue_depth(), THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void Manager::setup_interaction_outboxes()
+{
+   if ( ( this->interaction_outbox_size <= 0 ) || ( this->interaction_outboxes != NULL ) ) {
+      return;
+   }
+
+   // One outbox for the main thread and each of the Trick child threads.
+   this->interaction_outbox_count = exec_get_num_threads();
+   this->interaction_outboxes     = new InteractionOutbox[interaction_outbox_count];
+   for ( unsigned int id = 0; id < interaction_outbox_count; ++id ) {
+      this->interaction_outboxes[id].initialize( (unsigned int)this->interaction_outbox_size );
+   }
+   this->outbox_pending.reserve( interaction_outbox_count * (unsigned int)this->interaction_outbox_size );
+   this->outbox_collected.assign( interaction_outbox_count, 0 );
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::setup_interaction_outboxes():%d Interaction outboxes for %u Trick threads with %d sends each.%c",
+               __LINE__, interaction_outbox_count, this->interaction_outbox_size, THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @details Trick reports the Trick main thread ID for a thread it does not
+ * know about, such as the RTI callback thread, so the calling thread is
+ * checked against the Trick thread with that ID. There is no outbox for a
+ * thread that is not a Trick thread, since the outbox of a Trick thread must
+ * only be filled from that thread.
+ * @job_class{scheduled}
+ */
+InteractionOutbox *Manager::get_interaction_outbox()
+{
+   if ( this->interaction_outboxes == NULL ) {
+      return NULL;
+   }
+   unsigned int const thread_id = exec_get_process_id();
+   if ( ( thread_id >= this->interaction_outbox_count )
+        || !pthread_equal( pthread_self(), exec_get_pthread_id( thread_id ) ) ) {
+      return NULL;
+   }
+   return &interaction_outboxes[thread_id];
+}
+
+/*!
+ * @brief Order the outbox items with the Receive Order items first, followed
+ * by the Timestamp Order items by send time, with items that compare equal
+ * kept in the order they were enqueued.
+ */
+static bool outbox_item_order(
+   InteractionOutboxItem const *a,
+   InteractionOutboxItem const *b )
+{
+   if ( a->timestamp_order != b->timestamp_order ) {
+      return !a->timestamp_order;
+   }
+   if ( a->timestamp_order && ( a->send_time != b->send_time ) ) {
+      return ( a->send_time < b->send_time );
+   }
+   return ( a->enqueue_wall_time < b->enqueue_wall_time );
+}
+
+/*!
+ * @details Called from the Trick main thread once per frame after the child
+ * threads have finished their data cycle. Interactions a child thread
+ * enqueues while the flush is in progress are sent in the next frame.
+ * @job_class{scheduled}
+ */
+void Manager::flush_interaction_outboxes()
+{
+   if ( this->interaction_outboxes == NULL ) {
+      return;
+   }
+
+   outbox_pending.clear();
+   for ( unsigned int id = 0; id < interaction_outbox_count; ++id ) {
+      outbox_collected[id] = interaction_outboxes[id].collect( outbox_pending );
+   }
+   if ( outbox_pending.empty() ) {
+      return;
+   }
+
+   stable_sort( outbox_pending.begin(), outbox_pending.end(), outbox_item_order );
+
+   for ( unsigned int i = 0; i < outbox_pending.size(); ++i ) {
+      InteractionOutboxItem &item = *outbox_pending[i];
+
+      item.interaction->send_outbox_item( item );
+
+      int64_t const latency = MonotonicClock::get_time_micros() - item.enqueue_wall_time;
+      this->outbox_latency_sum += latency;
+      if ( latency > this->outbox_latency_max ) {
+         this->outbox_latency_max = latency;
+      }
+      ++this->outbox_sent_count;
+   }
+
+   // Return the sent items to the producer threads for reuse.
+   for ( unsigned int id = 0; id < interaction_outbox_count; ++id ) {
+      interaction_outboxes[id].release( outbox_collected[id] );
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+      send_hs( stdout, "Manager::flush_interaction_outboxes():%d Sent:%u Total-sent:%llu Mean-latency:%.6f Max-latency:%.6f seconds%c",
+               __LINE__, (unsigned int)outbox_pending.size(), outbox_sent_count,
+               get_outbox_latency_mean(), get_outbox_latency_max(), THLA_NEWLINE );
+   }
+   outbox_pending.clear();
+}
+
+unsigned long long Manager::get_outbox_overflow_count() const
+{
+   unsigned long long count = 0;
+   for ( unsigned int id = 0; id < interaction_outbox_count; ++id ) {
+      count += interaction_outboxes[id].get_overflow_count();
+   }
+   return count;
+}
+
+unsigned long long Manager::get_dropped_send_count() const
+{
+   unsigned long long count = 0;
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      count += objects[n].get_dropped_send_count();
+   }
+   return count;
+}
+
+/*!
+ * @details If the object is owned remotely, this function copies its internal
+ * data into simulation object and marks the object as "unchanged". This data
+ * was deposited by the reflect callback and marked as "changed". By marking
+ * it as unchanged, we avoid copying the same data over and over. If the object
+ * is locally owned, we shouldn't be receiving any remote data anyway and if
+ * we were to -- bogusly -- copy it to the internal byte buffer, we'd
+ * continually reset our local simulation.
+ * @job_class{scheduled}
+ */
+void Manager::receive_cyclic_data()
+{
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::receive_cyclic_data():%d%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   int64_t const start_wall_time       = is_send_degradation_enabled() ? MonotonicClock::get_time_micros() : 0LL;
+   int64_t const sim_time_in_base_time = Int64BaseTime::to_base_time( exec_get_sim_time() );
+
+   // Receive and process any updates for ExecutionControl.
+   this->execution_control->receive_cyclic_data();
+
+   // Instantiate the objects for the instances discovered from a template.
+   if ( obj_template_count > 0 ) {
+      instantiate_pending_template_objects();
+   }
+
+   if ( !this->active_sets_initialized ) {
+      initialize_active_sets();
+   }
+
+   // Only the objects reflected since the last data cycle, plus the objects
+   // doing blocking reads, need to be visited.
+   ObjectIndexSet recv_obj_set( blocking_read_obj_list.begin(), blocking_read_obj_list.end() );
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+      recv_obj_set.insert( changed_obj_set.begin(), changed_obj_set.end() );
+      changed_obj_set.clear();
+   }
+
+   // Receive data from remote RTI federates for each of the objects.
+   ObjectIndexSet deferred_obj_set;
+   ObjectIndexSet::const_iterator iter;
+   for ( iter = recv_obj_set.begin(); iter != recv_obj_set.end(); ++iter ) {
+      unsigned int const n = *iter;
+
+      // Only receive data if we are on the data cycle time boundary for this object.
+      if ( federate->on_data_cycle_boundary_for_obj( n, sim_time_in_base_time ) ) {
+         objects[n].receive_cyclic_data();
+      } else {
+         // Keep the changed data pending until the object data cycle boundary.
+         deferred_obj_set.insert( n );
+      }
+   }
+
+   if ( !deferred_obj_set.empty() ) {
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+      changed_obj_set.insert( deferred_obj_set.begin(), deferred_obj_set.end() );
+   }
+
+   if ( this->catch_up_remaining_count > 0 ) {
+      check_catch_up_progress();
+   }
+
+   if ( is_send_degradation_enabled() ) {
+      this->receive_wall_time += MonotonicClock::get_time_micros() - start_wall_time;
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Manager::process_interactions()
+{
+   // Process any ExecutionControl mode transitions.
+   this->execution_control->process_mode_interaction();
+
+   // Just return if the interaction queue is empty.
+   if ( interactions_queue.empty() ) {
+      return;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::process_interactions():%d%c",
                __LINE__, THLA_NEWLINE );
    }
 
    // Process all the interactions in the queue.
    while ( !interactions_queue.empty() ) {
 
-      // Get a reference to the first item on the queue.
-      InteractionItem *interaction_item =
-         static_cast< InteractionItem * >( interactions_queue.front() );
+      int process_index = -1;
 
-      switch ( interaction_item->interaction_type ) {
-         case TRICKHLA_MANAGER_USER_DEFINED_INTERACTION: {
-            // Process the interaction if we subscribed to it and the interaction
-            // index is valid.
-            if ( ( interaction_item->index >= 0 )
-                 && ( interaction_item->index < inter_count )
-                 && interactions[interaction_item->index].is_subscribe() ) {
+      // The queue stays locked while the front item is in use because the
+      // overflow policy can remove queued items from the RTI callback thread.
+      {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks the
+         // mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &interactions_queue.mutex );
 
-               interactions[interaction_item->index].extract_data( interaction_item );
-
-               interactions[interaction_item->index].process_interaction();
-            }
+         // Get a reference to the first item on the queue.
+         InteractionItem *interaction_item =
+            static_cast< InteractionItem * >( interactions_queue.front() );
+         if ( interaction_item == NULL ) {
             break;
          }
 
-         default: {
-            ostringstream errmsg;
-            errmsg << "Manager::process_interactions():" << __LINE__
-                   << " FATAL ERROR: encountered an invalid interaction type: "
-                   << interaction_item->interaction_type
-                   << ". Verify that you are specifying the correct interaction "
-                   << "type defined in 'ManagerTypeOfInteractionEnum' enum "
-                   << "found in 'Manager.hh' and re-run." << THLA_ENDL;
-            DebugHandler::terminate_with_message( errmsg.str() );
-            break;
+         switch ( interaction_item->interaction_type ) {
+            case TRICKHLA_MANAGER_USER_DEFINED_INTERACTION: {
+               // Process the interaction if we subscribed to it and the interaction
+               // index is valid.
+               if ( ( interaction_item->index >= 0 )
+                    && ( interaction_item->index < inter_count )
+                    && interactions[interaction_item->index].is_subscribe() ) {
+
+                  interactions[interaction_item->index].extract_data( interaction_item );
+
+                  process_index = interaction_item->index;
+               }
+               break;
+            }
+
+            default: {
+               ostringstream errmsg;
+               errmsg << "Manager::process_interactions():" << __LINE__
+                      << " FATAL ERROR: encountered an invalid interaction type: "
+                      << interaction_item->interaction_type
+                      << ". Verify that you are specifying the correct interaction "
+                      << "type defined in 'ManagerTypeOfInteractionEnum' enum "
+                      << "found in 'Manager.hh' and re-run." << THLA_ENDL;
+               DebugHandler::terminate_with_message( errmsg.str() );
+               break;
+            }
          }
+
+         // Now that we extracted the interaction-item remove it from the queue,
+         // which will result in the item being deleted and no longer valid.
+         interactions_queue.pop();
+      }
+
+      // The extracted data is held by the interaction, so the user handler
+      // is called without holding the queue lock.
+      if ( process_index >= 0 ) {
+         interactions[process_index].process_interaction();
       }
+   }
 
-      // Now that we processed the interaction-item remove it from the queue,
-      // which will result in the item being deleted and no longer valid.
-      interactions_queue.pop();
+   // Report the next overflow once the backlog has drained.
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &interactions_queue.mutex );
+      if ( interactions_queue.empty() ) {
+         this->interactions_queue_overflowed = false;
+      }
    }
 
    clear_interactions();
 }
 
+/*!
+ * @details The QUEUE_OVERFLOW_BLOCK policy does not block while the federate
+ * has a time advance request pending, because this RTI callback thread must
+ * deliver the time advance grant the Trick main thread is waiting on before
+ * it can drain the queue. It then drops the oldest queued interaction
+ * instead, as it also does once the queue_block_timeout expires.
+ * @job_class{scheduled}
+ */
+bool const Manager::make_room_in_interactions_queue(
+   int const index )
+{
+   if ( ( this->interactions_queue_max_depth <= 0 )
+        || ( interactions_queue.size() < this->interactions_queue_max_depth ) ) {
+      return true;
+   }
+
+   bool report_overflow;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &interactions_queue.mutex );
+      report_overflow                     = !this->interactions_queue_overflowed;
+      this->interactions_queue_overflowed = true;
+   }
+   if ( report_overflow ) {
+      send_hs( stderr, "Manager::make_room_in_interactions_queue():%d WARNING: \
+The interactions queue reached its maximum depth of %d, applying the overflow \
+policy %d.%c",
+               __LINE__, this->interactions_queue_max_depth,
+               (int)this->interactions_queue_policy, THLA_NEWLINE );
+   }
+
+   switch ( this->interactions_queue_policy ) {
+      case QUEUE_OVERFLOW_BLOCK: {
+         ++this->interactions_blocked_count;
+
+         SleepTimeout sleep_timer( this->queue_block_timeout, THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+         while ( interactions_queue.size() >= this->interactions_queue_max_depth ) {
+            if ( ( ( federate != NULL ) && federate->is_time_advance_requested() )
+                 || sleep_timer.timeout() || is_shutdown_called() ) {
+               if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+                  send_hs( stderr, "Manager::make_room_in_interactions_queue():%d \
+WARNING: Could not wait for room in the interactions queue, dropping the \
+oldest interaction.%c",
+                           __LINE__, THLA_NEWLINE );
+               }
+               interactions_queue.pop();
+               ++this->interactions_dropped_count;
+               break;
+            }
+            (void)sleep_timer.sleep();
+         }
+         return true;
+      }
+      case QUEUE_OVERFLOW_DROP_NEWEST: {
+         ++this->interactions_dropped_count;
+         return false;
+      }
+      case QUEUE_OVERFLOW_CONFLATE: {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks the
+         // mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &interactions_queue.mutex );
+
+         // Replace the oldest queued interaction of the same class.
+         for ( Item *item = interactions_queue.front(); item != NULL; item = item->next ) {
+            InteractionItem *queued_item = static_cast< InteractionItem * >( item );
+            if ( ( queued_item->interaction_type == TRICKHLA_MANAGER_USER_DEFINED_INTERACTION )
+                 && ( queued_item->index == index ) ) {
+               interactions_queue.remove( item );
+               ++this->interactions_conflated_count;
+               return true;
+            }
+         }
+         // No queued interaction of the same class so drop the oldest.
+         interactions_queue.pop();
+         ++this->interactions_dropped_count;
+         return true;
+      }
+      default: {
+         // QUEUE_OVERFLOW_DROP_OLDEST
+         interactions_queue.pop();
+         ++this->interactions_dropped_count;
+         return true;
+      }
+   }
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -2477,6 +4208,11 @@ void Manager::receive_interaction(
       if ( interactions[i].is_subscribe()
            && ( interactions[i].get_class_handle() == theInteraction ) ) {
 
+         // Apply the overflow policy if the queue is full.
+         if ( !make_room_in_interactions_queue( i ) ) {
+            return;
+         }
+
          InteractionItem *item;
          if ( received_as_TSO ) {
             item = new InteractionItem( i,
@@ -2496,8 +4232,13 @@ void Manager::receive_interaction(
          }
 
          // Add the interaction item to the queue.
+         item->account_memory( &interactions[i].memory_usage );
          interactions_queue.push( item );
 
+         if ( interactions_queue.size() > this->interactions_queue_peak_depth ) {
+            this->interactions_queue_peak_depth = interactions_queue.size();
+         }
+
          if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
             if ( received_as_TSO ) {
                Int64Time _time;
@@ -2535,6 +4276,11 @@ void Manager::receive_interaction(
 Object *Manager::get_trickhla_object(
    RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_id )
 {
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception. The Trick main thread binds the
+   // objects instantiated from a template.
+   MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
    // We use a map with the key being the ObjectIntanceHandle for fast lookups.
    ObjectInstanceMap::const_iterator iter = object_map.find( instance_id );
    return ( ( iter != object_map.end() ) ? iter->second : NULL );
@@ -2584,6 +4330,12 @@ bool Manager::discover_object_instance(
 
    bool return_value = false;
 
+   // Build the discovery indexes on first use, at which point all the object
+   // class handles are known.
+   if ( !this->discovery_index_initialized ) {
+      initialize_discovery_indexes();
+   }
+
    // Get the unregistered TrickHLA Object for the given class handle and
    // object instance name.
    Object *trickhla_obj = get_unregistered_object( theObjectClass, theObjectInstanceName );
@@ -2601,22 +4353,10 @@ bool Manager::discover_object_instance(
 
    // Determine if the discovered instance was for a data object.
    if ( trickhla_obj != NULL ) {
-      // Set the Instance ID for the discovered object.
-      trickhla_obj->set_instance_handle_and_name( theObject, theObjectInstanceName );
-
-      // Put this discovered instance in the map of object instance handles.
-      if ( object_map.find( trickhla_obj->get_instance_handle() ) == object_map.end() ) {
-         object_map[theObject] = trickhla_obj;
-      }
-
+      bind_discovered_object( trickhla_obj, theObject, theObjectInstanceName );
+      return_value = true;
+   } else if ( queue_template_instance( theObject, theObjectClass, theObjectInstanceName ) ) {
       return_value = true;
-
-      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-         string id_str;
-         StringUtilities::to_string( id_str, theObject );
-         send_hs( stdout, "Manager::discover_object_instance():%d Data-Object '%s' Instance-ID:%s%c",
-                  __LINE__, trickhla_obj->get_name(), id_str.c_str(), THLA_NEWLINE );
-      }
    } else if ( ( federate != NULL ) && federate->is_MOM_HLAfederate_class( theObjectClass ) ) {
 
       federate->add_federate_instance_id( theObject );
@@ -2649,6 +4389,75 @@ bool Manager::discover_object_instance(
    return return_value;
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void Manager::bind_discovered_object(
+   Object                     *trickhla_obj,
+   ObjectInstanceHandle const &theObject,
+   wstring const              &theObjectInstanceName )
+{
+   // Set the Instance ID for the discovered object.
+   trickhla_obj->set_instance_handle_and_name( theObject, theObjectInstanceName );
+
+   // The object is now registered and may have taken on the discovered name.
+   unsigned int obj_index;
+   if ( this->discovery_index_initialized && get_object_index( trickhla_obj, obj_index ) ) {
+      update_discovery_indexes( obj_index );
+   }
+
+   // Put this discovered instance in the map of object instance handles.
+   if ( object_map.find( trickhla_obj->get_instance_handle() ) == object_map.end() ) {
+      object_map[theObject] = trickhla_obj;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      string id_str;
+      StringUtilities::to_string( id_str, theObject );
+      send_hs( stdout, "Manager::bind_discovered_object():%d Data-Object '%s' Instance-ID:%s%c",
+               __LINE__, trickhla_obj->get_name(), id_str.c_str(), THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @details The object is instantiated from the template on the Trick main
+ * thread by instantiate_pending_template_objects().
+ * @job_class{scheduled}
+ */
+bool Manager::queue_template_instance(
+   ObjectInstanceHandle const &theObject,
+   ObjectClassHandle const    &theObjectClass,
+   wstring const              &theObjectInstanceName )
+{
+   for ( int t = 0; t < obj_template_count; ++t ) {
+
+      int const proto_index = obj_templates[t].get_prototype_index();
+      if ( ( proto_index < 0 ) || ( objects[proto_index].get_class_handle() != theObjectClass ) ) {
+         continue;
+      }
+
+      if ( !obj_templates[t].is_pool_available_for_pending() ) {
+         send_hs( stderr, "Manager::queue_template_instance():%d WARNING: \
+The pool of %d objects for Object Template '%s' is exhausted, ignoring the \
+discovered object instance.%c",
+                  __LINE__, obj_templates[t].pool_size, obj_templates[t].name,
+                  THLA_NEWLINE );
+         return false;
+      }
+
+      obj_templates[t].add_pending_instance( theObject, theObjectInstanceName );
+
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         string id_str;
+         StringUtilities::to_string( id_str, theObject );
+         send_hs( stdout, "Manager::queue_template_instance():%d Object Template '%s' Instance-ID:%s%c",
+                  __LINE__, obj_templates[t].name, id_str.c_str(), THLA_NEWLINE );
+      }
+      return true;
+   }
+   return false;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -2656,23 +4465,24 @@ Object *Manager::get_unregistered_object(
    ObjectClassHandle const &theObjectClass,
    wstring const           &theObjectInstanceName )
 {
-   wstring ws_obj_name;
-
-   // Search the simulation data objects first.
-   for ( unsigned int n = 0; n < obj_count; ++n ) {
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
 
-      // Find the object that is not registered (i.e. the instance ID == 0),
-      // has the same class handle as the one specified, and has the same name
-      // as the object instance name that is specified.
-      if ( ( objects[n].get_class_handle() == theObjectClass )
-           && ( !objects[n].is_instance_handle_valid() ) ) {
+   if ( !this->discovery_index_initialized ) {
+      initialize_discovery_indexes();
+   }
 
-         StringUtilities::to_wstring( ws_obj_name, objects[n].get_name() );
+   // Search the simulation data objects first, which are indexed by class
+   // handle and object instance name.
+   ObjectClassNameIndexMap::const_iterator class_iter = discovery_name_index_map.find( theObjectClass );
+   if ( class_iter != discovery_name_index_map.end() ) {
+      ObjectWstringNameIndexMap::const_iterator name_iter = class_iter->second.find( theObjectInstanceName );
 
-         // Determine if the name matches the object instance name.
-         if ( ws_obj_name == theObjectInstanceName ) {
-            return ( &objects[n] );
-         }
+      // Find the object that is not registered (i.e. the instance ID == 0).
+      if ( ( name_iter != class_iter->second.end() )
+           && ( !objects[name_iter->second].is_instance_handle_valid() ) ) {
+         return ( &objects[name_iter->second] );
       }
    }
 
@@ -2687,21 +4497,28 @@ Object *Manager::get_unregistered_object(
 Object *Manager::get_unregistered_remote_object(
    ObjectClassHandle const &theObjectClass )
 {
-   // Search the simulation data objects first.
-   for ( unsigned int n = 0; n < obj_count; ++n ) {
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
 
-      // Return the first TrickHLA object that we did not create an HLA
-      // instance for, has the same class handle as the one specified, is not
-      // registered (i.e. the instance ID == 0), and does not have an Object
-      // Instance Name associated with it, and a name is not required or the
-      // user did not specify one.
-      if ( ( !objects[n].is_create_HLA_instance() )
-           && ( objects[n].get_class_handle() == theObjectClass )
-           && ( !objects[n].is_instance_handle_valid() )
-           && ( !objects[n].is_name_required()
-                || ( objects[n].get_name() == NULL )
-                || ( *( objects[n].get_name() ) == '\0' ) ) ) {
-         return ( &objects[n] );
+   if ( !this->discovery_index_initialized ) {
+      initialize_discovery_indexes();
+   }
+
+   // Search the simulation data objects first. Return the lowest index
+   // TrickHLA object that we did not create an HLA instance for, has the same
+   // class handle as the one specified, is not registered (i.e. the instance
+   // ID == 0), and does not have an Object Instance Name associated with it,
+   // and a name is not required or the user did not specify one.
+   ObjectClassIndexSetMap::iterator free_iter = discovery_free_index_map.find( theObjectClass );
+   if ( free_iter != discovery_free_index_map.end() ) {
+      while ( !free_iter->second.empty() ) {
+         unsigned int const n = *( free_iter->second.begin() );
+         if ( !objects[n].is_instance_handle_valid() ) {
+            return ( &objects[n] );
+         }
+         // Drop objects registered outside of discovery, such as by a restore.
+         free_iter->second.erase( free_iter->second.begin() );
       }
    }
 
@@ -2710,6 +4527,91 @@ Object *Manager::get_unregistered_remote_object(
    return ( this->execution_control->get_unregistered_remote_object( theObjectClass ) );
 }
 
+void Manager::clear_discovery_indexes()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+   discovery_name_index_map.clear();
+   discovery_free_index_map.clear();
+   discovery_obj_names.clear();
+
+   this->discovery_index_initialized = false;
+}
+
+/*!
+ * @details Indexes the objects by class handle and instance name, plus a
+ * free list per class handle of the unregistered remote objects that do not
+ * require a name, so that each discovered object instance is matched without
+ * scanning all the objects.
+ * @job_class{scheduled}
+ */
+void Manager::initialize_discovery_indexes()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+   discovery_name_index_map.clear();
+   discovery_free_index_map.clear();
+   discovery_obj_names.assign( obj_count, wstring() );
+
+   this->discovery_index_initialized = true;
+
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      update_discovery_indexes( n );
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::initialize_discovery_indexes():%d Object-Classes:%d%c",
+               __LINE__, (int)discovery_name_index_map.size(), THLA_NEWLINE );
+   }
+}
+
+void Manager::update_discovery_indexes(
+   unsigned int const obj_index )
+{
+   // Make sure there is a name entry for every object index.
+   if ( obj_index >= discovery_obj_names.size() ) {
+      discovery_obj_names.resize( obj_index + 1 );
+   }
+
+   ObjectClassHandle const class_handle = objects[obj_index].get_class_handle();
+
+   // Remove the index entry for the previous object instance name.
+   if ( !discovery_obj_names[obj_index].empty() ) {
+      ObjectWstringNameIndexMap &name_map = discovery_name_index_map[class_handle];
+
+      ObjectWstringNameIndexMap::iterator name_iter = name_map.find( discovery_obj_names[obj_index] );
+      if ( ( name_iter != name_map.end() ) && ( name_iter->second == obj_index ) ) {
+         name_map.erase( name_iter );
+      }
+      discovery_obj_names[obj_index].clear();
+   }
+
+   // Index the object by the current object instance name.
+   if ( ( objects[obj_index].get_name() != NULL )
+        && ( *( objects[obj_index].get_name() ) != '\0' ) ) {
+      StringUtilities::to_wstring( discovery_obj_names[obj_index], objects[obj_index].get_name() );
+      discovery_name_index_map[class_handle][discovery_obj_names[obj_index]] = obj_index;
+   }
+
+   // Unregistered objects we did not create an HLA instance for, and that do
+   // not require a name, can match any discovered instance of the class.
+   if ( !objects[obj_index].is_create_HLA_instance()
+        && !objects[obj_index].is_instance_handle_valid()
+        && ( !objects[obj_index].is_name_required()
+             || discovery_obj_names[obj_index].empty() ) ) {
+      discovery_free_index_map[class_handle].insert( obj_index );
+   } else {
+      ObjectClassIndexSetMap::iterator free_iter = discovery_free_index_map.find( class_handle );
+      if ( free_iter != discovery_free_index_map.end() ) {
+         free_iter->second.erase( obj_index );
+      }
+   }
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -2740,7 +4642,16 @@ void Manager::mark_object_as_deleted_from_federation(
    if ( !this->execution_control->mark_object_as_deleted_from_federation( instance_id ) ) {
 
       Object *obj = get_trickhla_object( instance_id );
-      if ( obj != NULL ) {
+      if ( obj == NULL ) {
+         // The instance may still be waiting for an object to be instantiated
+         // from a template.
+         MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+         for ( int t = 0; t < obj_template_count; ++t ) {
+            if ( obj_templates[t].remove_pending_instance( instance_id ) ) {
+               break;
+            }
+         }
+      } else {
          if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
             string id_str;
             StringUtilities::to_string( id_str, instance_id );
@@ -2749,6 +4660,23 @@ void Manager::mark_object_as_deleted_from_federation(
                      ( instance_id.isValid() ? "Yes" : "No" ), THLA_NEWLINE );
          }
          obj->remove_object_instance();
+
+         unsigned int obj_index;
+         if ( get_object_index( obj, obj_index ) ) {
+            {
+               MutexProtection auto_unlock_mutex( &active_set_mutex );
+               deleted_obj_set.insert( obj_index );
+
+               // A deleted object will never answer the catch-up request.
+               catch_up_pending_obj_set.erase( obj_index );
+            }
+
+            // The object can be discovered again now that it is unregistered.
+            MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+            if ( this->discovery_index_initialized ) {
+               update_discovery_indexes( obj_index );
+            }
+         }
       }
    }
 }
@@ -2761,10 +4689,26 @@ void Manager::process_deleted_objects()
    // Process ExecutionControl deletions.
    this->execution_control->process_deleted_objects();
 
-   // Search the simulation data objects, looking for deleted objects.
-   for ( unsigned int n = 0; n < obj_count; ++n ) {
-      if ( objects[n].process_object_deleted_from_RTI ) {
-         objects[n].process_deleted_object();
+   if ( !this->active_sets_initialized ) {
+      initialize_active_sets();
+   }
+
+   // Only the objects marked as deleted from the federation are visited.
+   ObjectIndexSet del_obj_set;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &active_set_mutex );
+      if ( deleted_obj_set.empty() ) {
+         return;
+      }
+      del_obj_set.swap( deleted_obj_set );
+   }
+
+   ObjectIndexSet::const_iterator iter;
+   for ( iter = del_obj_set.begin(); iter != del_obj_set.end(); ++iter ) {
+      if ( objects[*iter].process_object_deleted_from_RTI ) {
+         objects[*iter].process_deleted_object();
       }
    }
 }
@@ -2804,6 +4748,9 @@ void Manager::grant_pull_request()
  */
 void Manager::release_ownership()
 {
+   // Queued updates must be sent before the attributes are divested.
+   flush_async_send();
+
    for ( unsigned int n = 0; n < obj_count; ++n ) {
       objects[n].release_ownership();
    }
@@ -3071,6 +5018,9 @@ restoring check_interactions[%d] into interaction index %d, parm_count=%d%c",
          item->order_is_TSO = check_interactions[i].order_is_TSO;
          item->time         = check_interactions[i].time;
 
+         if ( ( item->index >= 0 ) && ( item->index < (int)inter_count ) ) {
+            item->account_memory( &interactions[item->index].memory_usage );
+         }
          interactions_queue.push( item );
       }
    }
@@ -0,0 +1,348 @@
+/*!
+@file TrickHLA/MemoryAccounting.cpp
+@ingroup TrickHLA
+@brief This class accounts for the memory TrickHLA itself allocates, per
+subsystem and per object, interaction and FOM class, and prints a report of
+the current bytes, peak bytes and allocation counts on demand.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Federate.cpp}
+@trick_link_dependency{Interaction.cpp}
+@trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MemoryAccounting.cpp}
+@trick_link_dependency{MemoryUsage.cpp}
+@trick_link_dependency{Object.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Trick include files.
+#include "trick/exec_proto.h"
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/Federate.hh"
+#include "TrickHLA/Interaction.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/MemoryAccounting.hh"
+#include "TrickHLA/MemoryUsage.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+MemoryUsage MemoryAccounting::subsystem_usage[MEMORY_SUBSYSTEM_COUNT];
+
+namespace
+{
+
+// Usage of one row of the report, which unlike MemoryUsage can be copied.
+struct MemoryReportRow {
+   string  name;
+   string  FOM_name;
+   int     instances;
+   int64_t current_bytes;
+   int64_t peak_bytes;
+   int64_t alloc_count;
+
+   MemoryReportRow()
+      : instances( 0 ), current_bytes( 0 ), peak_bytes( 0 ), alloc_count( 0 )
+   {
+      return;
+   }
+
+   void add( MemoryUsage const &usage )
+   {
+      ++instances;
+      current_bytes += usage.current_bytes;
+      peak_bytes += usage.peak_bytes;
+      alloc_count += usage.alloc_count;
+   }
+};
+
+bool larger_row( MemoryReportRow const &a, MemoryReportRow const &b )
+{
+   return ( a.current_bytes > b.current_bytes )
+          || ( ( a.current_bytes == b.current_bytes ) && ( a.peak_bytes > b.peak_bytes ) );
+}
+
+string to_KiB( int64_t const bytes )
+{
+   ostringstream str;
+   str << fixed << setprecision( 1 ) << ( (double)bytes / 1024.0 );
+   return str.str();
+}
+
+void print_row( ostringstream &msg, MemoryReportRow const &row, bool const show_instances )
+{
+   msg << "  " << setw( 40 ) << left << row.name << right;
+   if ( show_instances ) {
+      msg << setw( 10 ) << row.instances;
+   } else {
+      msg << setw( 10 ) << "";
+   }
+   msg << setw( 14 ) << to_KiB( row.current_bytes )
+       << setw( 14 ) << to_KiB( row.peak_bytes )
+       << setw( 14 ) << row.alloc_count << THLA_ENDL;
+}
+
+void print_header( ostringstream &msg, char const *title, char const *count_title )
+{
+   msg << "  " << setw( 40 ) << left << title << right
+       << setw( 10 ) << count_title
+       << setw( 14 ) << "Current(KiB)"
+       << setw( 14 ) << "Peak(KiB)"
+       << setw( 14 ) << "Allocations" << THLA_ENDL;
+}
+
+void print_largest( ostringstream &msg, vector< MemoryReportRow > &rows, int const max_rows, char const *title )
+{
+   if ( rows.empty() ) {
+      return;
+   }
+   sort( rows.begin(), rows.end(), larger_row );
+
+   size_t const count = ( ( max_rows > 0 ) && ( (size_t)max_rows < rows.size() ) ) ? (size_t)max_rows : rows.size();
+
+   ostringstream heading;
+   heading << title << " (" << count << " of " << rows.size() << ")";
+   print_header( msg, heading.str().c_str(), "" );
+   for ( size_t i = 0; i < count; ++i ) {
+      MemoryReportRow row = rows[i];
+      if ( row.name != row.FOM_name ) {
+         row.name += " [" + row.FOM_name + "]";
+      }
+      print_row( msg, row, false );
+   }
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+MemoryAccounting::MemoryAccounting()
+   : print_on_shutdown( true ),
+     report_object_max( 10 ),
+     total_current_bytes( 0 ),
+     total_peak_bytes( 0 ),
+     federate( NULL ),
+     manager( NULL )
+{
+   for ( int i = 0; i < MEMORY_SUBSYSTEM_COUNT; ++i ) {
+      current_bytes[i] = 0;
+      peak_bytes[i]    = 0;
+      alloc_count[i]   = 0;
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+MemoryAccounting::~MemoryAccounting()
+{
+   this->federate = NULL;
+   this->manager  = NULL;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void MemoryAccounting::configure(
+   Federate *fed,
+   Manager  *mgr )
+{
+   this->federate = fed;
+   this->manager  = mgr;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void MemoryAccounting::initialize()
+{
+   update();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void MemoryAccounting::update()
+{
+   if ( this->federate != NULL ) {
+      int64_t entries = 0;
+      int64_t bytes   = (int64_t)this->federate->get_MOM_memory_size( entries );
+      subsystem_usage[MEMORY_MOM_TABLES].set( bytes, entries );
+   }
+
+   this->total_current_bytes = 0;
+   for ( int i = 0; i < MEMORY_SUBSYSTEM_COUNT; ++i ) {
+      this->current_bytes[i] = subsystem_usage[i].current_bytes;
+      this->peak_bytes[i]    = subsystem_usage[i].peak_bytes;
+      this->alloc_count[i]   = subsystem_usage[i].alloc_count;
+      this->total_current_bytes += this->current_bytes[i];
+   }
+   if ( this->total_current_bytes > this->total_peak_bytes ) {
+      this->total_peak_bytes = this->total_current_bytes;
+   }
+}
+
+/*!
+ * @job_class{logging}
+ */
+void MemoryAccounting::print_report()
+{
+   update();
+
+   ostringstream msg;
+   msg << "MemoryAccounting::print_report() TrickHLA memory at sim-time "
+       << fixed << setprecision( 3 ) << exec_get_sim_time() << " s" << THLA_ENDL;
+
+   // Per subsystem.
+   print_header( msg, "Subsystem", "" );
+   MemoryReportRow total;
+   total.name = "Total";
+   for ( int i = 0; i < MEMORY_SUBSYSTEM_COUNT; ++i ) {
+      MemoryReportRow row;
+      row.name = get_subsystem_name( (MemorySubsystemEnum)i );
+      row.add( subsystem_usage[i] );
+      print_row( msg, row, false );
+      total.add( subsystem_usage[i] );
+   }
+   total.peak_bytes = this->total_peak_bytes;
+   print_row( msg, total, false );
+
+   if ( this->manager != NULL ) {
+      // Per object and per FOM class, where the class peak is the sum of the
+      // instance peaks.
+      map< string, MemoryReportRow > classes;
+      vector< MemoryReportRow >      objects;
+      vector< MemoryReportRow >      interactions;
+
+      Object   *objs      = this->manager->get_objects();
+      int const obj_count = this->manager->get_object_count();
+      for ( int n = 0; n < obj_count; ++n ) {
+         MemoryReportRow row;
+         row.name     = ( objs[n].get_name() != NULL ) ? objs[n].get_name() : "";
+         row.FOM_name = ( objs[n].get_FOM_name() != NULL ) ? objs[n].get_FOM_name() : "";
+         row.add( objs[n].memory_usage );
+         objects.push_back( row );
+
+         MemoryReportRow &fom_class = classes[row.FOM_name];
+         fom_class.name             = row.FOM_name;
+         fom_class.add( objs[n].memory_usage );
+      }
+
+      Interaction *inters      = this->manager->get_interactions();
+      int const    inter_count = this->manager->get_interaction_count();
+      for ( int n = 0; n < inter_count; ++n ) {
+         MemoryReportRow row;
+         row.FOM_name = ( inters[n].get_FOM_name() != NULL ) ? inters[n].get_FOM_name() : "";
+         row.name     = row.FOM_name;
+         row.add( inters[n].memory_usage );
+         interactions.push_back( row );
+
+         MemoryReportRow &fom_class = classes[row.FOM_name];
+         fom_class.name             = row.FOM_name;
+         fom_class.add( inters[n].memory_usage );
+      }
+
+      if ( !classes.empty() ) {
+         print_header( msg, "FOM class", "Instances" );
+         map< string, MemoryReportRow >::const_iterator iter;
+         for ( iter = classes.begin(); iter != classes.end(); ++iter ) {
+            print_row( msg, iter->second, true );
+         }
+      }
+      print_largest( msg, objects, this->report_object_max, "Largest objects" );
+      print_largest( msg, interactions, this->report_object_max, "Largest interactions" );
+   }
+
+   send_hs( stdout, msg.str().c_str() );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void MemoryAccounting::shutdown()
+{
+   if ( this->print_on_shutdown ) {
+      print_report();
+
+      // Only print the report once.
+      this->print_on_shutdown = false;
+   }
+}
+
+void MemoryAccounting::record(
+   MemorySubsystemEnum const subsystem,
+   int64_t const             delta_bytes,
+   MemoryUsage              *owner )
+{
+   if ( delta_bytes == 0 ) {
+      return;
+   }
+   subsystem_usage[subsystem].record( delta_bytes );
+   if ( owner != NULL ) {
+      owner->record( delta_bytes );
+   }
+}
+
+MemoryUsage const &MemoryAccounting::get_subsystem_usage(
+   MemorySubsystemEnum const subsystem )
+{
+   return subsystem_usage[subsystem];
+}
+
+char const *MemoryAccounting::get_subsystem_name(
+   MemorySubsystemEnum const subsystem )
+{
+   switch ( subsystem ) {
+      case MEMORY_ATTRIBUTE_BUFFERS: {
+         return "Attribute buffers";
+      }
+      case MEMORY_PARAMETER_BUFFERS: {
+         return "Parameter buffers";
+      }
+      case MEMORY_INTERACTION_ITEMS: {
+         return "Received interactions";
+      }
+      case MEMORY_REFLECTION_QUEUES: {
+         return "Reflection queues";
+      }
+      case MEMORY_OPAQUE_BUFFERS: {
+         return "Opaque buffers";
+      }
+      case MEMORY_MOM_TABLES: {
+         return "MOM tables";
+      }
+      default: {
+         return "Unknown";
+      }
+   }
+}
@@ -0,0 +1,103 @@
+/*!
+@file TrickHLA/MemoryUsage.cpp
+@ingroup TrickHLA
+@brief This class holds the current bytes, peak bytes and allocation count
+of memory accounted to a TrickHLA subsystem, object or interaction.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{MemoryUsage.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// TrickHLA include files.
+#include "TrickHLA/MemoryUsage.hh"
+
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+MemoryUsage::MemoryUsage()
+   : current_bytes( 0 ),
+     peak_bytes( 0 ),
+     alloc_count( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+MemoryUsage::~MemoryUsage()
+{
+   return;
+}
+
+/*!
+ * @details The peak is raised with a compare-and-swap loop so that a
+ * concurrent larger peak is never overwritten by a smaller one.
+ */
+void MemoryUsage::record(
+   int64_t const delta_bytes )
+{
+   if ( delta_bytes == 0 ) {
+      return;
+   }
+
+   int64_t const current = __sync_add_and_fetch( &current_bytes, delta_bytes );
+
+   if ( delta_bytes > 0 ) {
+      (void)__sync_add_and_fetch( &alloc_count, 1 );
+
+      int64_t peak = peak_bytes;
+      while ( current > peak ) {
+         int64_t const prev = __sync_val_compare_and_swap( &peak_bytes, peak, current );
+         if ( prev == peak ) {
+            break;
+         }
+         peak = prev;
+      }
+   }
+}
+
+void MemoryUsage::set(
+   int64_t const bytes,
+   int64_t const entries )
+{
+   this->current_bytes = bytes;
+   this->alloc_count   = entries;
+   if ( bytes > peak_bytes ) {
+      this->peak_bytes = bytes;
+   }
+}
+
+void MemoryUsage::add(
+   MemoryUsage const &usage )
+{
+   this->current_bytes += usage.current_bytes;
+   this->peak_bytes += usage.peak_bytes;
+   this->alloc_count += usage.alloc_count;
+}
+
+void MemoryUsage::reset()
+{
+   this->current_bytes = 0;
+   this->peak_bytes    = 0;
+   this->alloc_count   = 0;
+}
@@ -0,0 +1,179 @@
+/*!
+@file TrickHLA/MonotonicClock.cpp
+@ingroup TrickHLA
+@brief This class provides a low overhead monotonic clock in integer
+nanoseconds for the TrickHLA timeouts, statistics and profiling.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{MonotonicClock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <pthread.h>
+#include <time.h>
+#if defined( __x86_64__ )
+#   include <cpuid.h>
+#endif
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/MonotonicClock.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace TrickHLA;
+
+// Time in nanoseconds of each of the two TSC calibration intervals.
+#define THLA_TSC_CALIBRATION_NANOS 10000000L
+
+volatile bool MonotonicClock::initialized    = false;
+bool          MonotonicClock::use_tsc        = false;
+uint64_t      MonotonicClock::base_ticks     = 0;
+int64_t       MonotonicClock::base_nanos     = 0;
+uint64_t      MonotonicClock::nanos_per_tick = 0;
+
+namespace
+{
+
+pthread_once_t calibrate_once = PTHREAD_ONCE_INIT;
+
+#if defined( __x86_64__ )
+/*!
+ * @brief Determine if the CPU has an invariant TSC, which runs at a constant
+ * rate in all power states and is synchronized across the cores.
+ * @return True if the CPU has an invariant TSC.
+ */
+bool const has_invariant_tsc()
+{
+   unsigned int eax, ebx, ecx, edx;
+   if ( ( __get_cpuid( 0x80000000, &eax, &ebx, &ecx, &edx ) == 0 ) || ( eax < 0x80000007 ) ) {
+      return false;
+   }
+   if ( __get_cpuid( 0x80000007, &eax, &ebx, &ecx, &edx ) == 0 ) {
+      return false;
+   }
+   return ( ( edx & ( 1U << 8 ) ) != 0 );
+}
+
+/*!
+ * @brief Get a TSC value and the CLOCK_MONOTONIC time taken as close together
+ * as possible, by keeping the sample with the fewest ticks around the clock
+ * read.
+ * @param ticks TSC value.
+ * @param nanos CLOCK_MONOTONIC time in nanoseconds.
+ */
+void sample_tsc_and_monotonic(
+   uint64_t &ticks,
+   int64_t  &nanos )
+{
+   uint64_t best_ticks = UINT64_MAX;
+   for ( int i = 0; i < 5; ++i ) {
+      struct timespec ts;
+      uint64_t const  before = __builtin_ia32_rdtsc();
+      clock_gettime( CLOCK_MONOTONIC, &ts );
+      uint64_t const after = __builtin_ia32_rdtsc();
+      if ( ( after - before ) < best_ticks ) {
+         best_ticks = after - before;
+         ticks      = before + ( ( after - before ) / 2 );
+         nanos      = ( (int64_t)ts.tv_sec * 1000000000LL ) + (int64_t)ts.tv_nsec;
+      }
+   }
+}
+
+/*!
+ * @brief Measure the TSC rate against CLOCK_MONOTONIC.
+ * @return Nanoseconds per TSC tick as a 32.32 fixed point value, or zero if
+ * the TSC did not advance.
+ */
+uint64_t const measure_nanos_per_tick()
+{
+   uint64_t start_ticks, end_ticks;
+   int64_t  start_nanos, end_nanos;
+
+   sample_tsc_and_monotonic( start_ticks, start_nanos );
+
+   struct timespec interval;
+   interval.tv_sec  = 0;
+   interval.tv_nsec = THLA_TSC_CALIBRATION_NANOS;
+   nanosleep( &interval, NULL );
+
+   sample_tsc_and_monotonic( end_ticks, end_nanos );
+
+   if ( ( end_ticks <= start_ticks ) || ( end_nanos <= start_nanos ) ) {
+      return 0;
+   }
+   return ( (uint64_t)( end_nanos - start_nanos ) << 32 ) / ( end_ticks - start_ticks );
+}
+#endif // __x86_64__
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+void MonotonicClock::initialize()
+{
+   pthread_once( &calibrate_once, MonotonicClock::calibrate );
+}
+
+void MonotonicClock::calibrate()
+{
+#if defined( __x86_64__ )
+   if ( has_invariant_tsc() ) {
+      // Only use the TSC if two calibration intervals agree to within 0.1%,
+      // which guards against a TSC a hypervisor does not keep steady.
+      uint64_t const rate_1 = measure_nanos_per_tick();
+      uint64_t const rate_2 = measure_nanos_per_tick();
+      uint64_t const diff   = ( rate_1 > rate_2 ) ? ( rate_1 - rate_2 ) : ( rate_2 - rate_1 );
+
+      if ( ( rate_1 > 0 ) && ( rate_2 > 0 ) && ( diff <= ( rate_1 / 1000 ) ) ) {
+         nanos_per_tick = ( rate_1 / 2 ) + ( rate_2 / 2 );
+         sample_tsc_and_monotonic( base_ticks, base_nanos );
+         use_tsc = true;
+      }
+   }
+#endif
+
+   // Make sure the calibration is visible before the initialized flag is.
+   __sync_synchronize();
+   initialized = true;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_ALL_MODULES ) ) {
+      if ( use_tsc ) {
+         send_hs( stdout, "MonotonicClock::calibrate():%d Using the invariant TSC at %.6f GHz.%c",
+                  __LINE__, get_tsc_frequency() / 1.0e9, THLA_NEWLINE );
+      } else {
+         send_hs( stdout, "MonotonicClock::calibrate():%d Using CLOCK_MONOTONIC.%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+   }
+}
+
+double MonotonicClock::get_tsc_frequency()
+{
+   if ( !is_using_tsc() || ( nanos_per_tick == 0 ) ) {
+      return 0.0;
+   }
+   return 4294967296.0e9 / (double)nanos_per_tick;
+}
@@ -25,6 +25,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{Int64Time.cpp}
 @trick_link_dependency{LagCompensation.cpp}
 @trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MonotonicClock.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
 @trick_link_dependency{Object.cpp}
@@ -71,6 +72,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Int64Time.hh"
 #include "TrickHLA/LagCompensation.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/MonotonicClock.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Object.hh"
@@ -119,15 +121,21 @@ Object::Object()
      create_HLA_instance( false ),
      required( true ),
      blocking_cyclic_read( false ),
+     zero_copy_send( false ),
      thread_ids( NULL ),
      attr_count( 0 ),
      attributes( NULL ),
      lag_comp( NULL ),
      lag_comp_type( LAG_COMPENSATION_NONE ),
+     reflection_conflation( REFLECTION_CONFLATION_NONE ),
+     reflection_queue_max_depth( 0 ),
+     reflection_queue_policy( QUEUE_OVERFLOW_CONFLATE ),
+     send_priority( SEND_PRIORITY_NORMAL ),
      packing( NULL ),
      ownership( NULL ),
      deleted( NULL ),
      conditional( NULL ),
+     memory_usage(),
      thread_ids_array_count( 0 ),
      thread_ids_array( NULL ),
      process_object_deleted_from_RTI( false ),
@@ -140,6 +148,7 @@ Object::Object()
      name_registered( false ),
      changed( false ),
      attr_update_requested( false ),
+     shared_memory_inline_pending( false ),
      removed_instance( false ),
      first_blocking_cyclic_read( true ),
      any_attribute_FOM_specified_order( false ),
@@ -151,8 +160,15 @@ Object::Object()
      rti_ambassador( NULL ),
      thla_reflected_attributes_queue(),
      thla_attribute_map(),
+     thla_shm_attribute_map(),
      send_count( 0LL ),
      receive_count( 0LL ),
+     pack_time( 0LL ),
+     unpack_time( 0LL ),
+     bytes_sent( 0LL ),
+     bytes_received( 0LL ),
+     packed_attr_count( 0LL ),
+     skipped_attr_count( 0LL ),
      elapsed_time_stats()
 {
    // Make sure we allocate the map.
@@ -201,6 +217,7 @@ Object::~Object()
       }
 
       thla_attribute_map.clear();
+      thla_shm_attribute_map.clear();
 
       // Make sure we destroy the mutexs.
       push_mutex.destroy();
@@ -289,6 +306,58 @@ void Object::initialize(
       DebugHandler::terminate_with_message( errmsg.str() );
    }
 
+   // Do a bounds check on the 'reflection_conflation' value.
+   if ( ( reflection_conflation < REFLECTION_CONFLATION_FIRST_VALUE )
+        || ( reflection_conflation > REFLECTION_CONFLATION_LAST_VALUE ) ) {
+      ostringstream errmsg;
+      errmsg << "Object::initialize():" << __LINE__
+             << " ERROR: For object '" << name << "', the Reflection Conflation"
+             << " setting 'reflection_conflation' has a value that is out of the"
+             << " valid range of " << REFLECTION_CONFLATION_FIRST_VALUE << " to "
+             << REFLECTION_CONFLATION_LAST_VALUE << ". Please check your input"
+             << " or modified-data files to make sure the 'reflection_conflation'"
+             << " value is correctly specified." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( reflection_queue_max_depth < 0 ) {
+      ostringstream errmsg;
+      errmsg << "Object::initialize():" << __LINE__
+             << " ERROR: For object '" << name << "', the"
+             << " 'reflection_queue_max_depth' of " << reflection_queue_max_depth
+             << " must be zero (unbounded) or greater. Please check your input"
+             << " or modified-data files." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Do a bounds check on the 'reflection_queue_policy' value.
+   if ( ( reflection_queue_policy < QUEUE_OVERFLOW_FIRST_VALUE )
+        || ( reflection_queue_policy > QUEUE_OVERFLOW_LAST_VALUE ) ) {
+      ostringstream errmsg;
+      errmsg << "Object::initialize():" << __LINE__
+             << " ERROR: For object '" << name << "', the"
+             << " 'reflection_queue_policy' has a value that is out of the"
+             << " valid range of " << QUEUE_OVERFLOW_FIRST_VALUE << " to "
+             << QUEUE_OVERFLOW_LAST_VALUE << ". Please check your input"
+             << " or modified-data files to make sure the 'reflection_queue_policy'"
+             << " value is correctly specified." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+#if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
+   thla_reflected_attributes_queue.configure_conflation( reflection_conflation,
+                                                         reflection_queue_max_depth );
+   thla_reflected_attributes_queue.configure_overflow( reflection_queue_policy,
+                                                       manager->queue_block_timeout );
+#else
+   if ( ( reflection_conflation != REFLECTION_CONFLATION_NONE ) || ( reflection_queue_max_depth > 0 ) ) {
+      send_hs( stderr, "Object::initialize():%d WARNING: For object '%s', the \
+'reflection_conflation', 'reflection_queue_max_depth' and 'reflection_queue_policy' \
+settings are ignored because TrickHLA was not compiled with THLA_QUEUE_REFLECTED_ATTRIBUTES.%c",
+               __LINE__, name, THLA_NEWLINE );
+   }
+#endif
+
    // If we have an attribute count but no attributes then let the user know.
    if ( ( attr_count > 0 ) && ( attributes == NULL ) ) {
       ostringstream errmsg;
@@ -358,6 +427,12 @@ void Object::initialize(
       this->attr_count = 0;
    }
 
+   // Account the attribute buffers and queued reflections to this object.
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      attributes[i].set_memory_owner( &memory_usage );
+   }
+   thla_reflected_attributes_queue.set_memory_owner( &memory_usage );
+
    // Check for the case where attributes are a mix of Zero Lookahead and Cyclic
    // since this can result in deadlock.
    bool any_cyclic_attr         = false;
@@ -399,6 +474,41 @@ void Object::initialize(
       DebugHandler::terminate_with_message( errmsg.str() );
    }
 
+   // Do a bounds check on the object 'send_priority' value, which can not
+   // refer back to the object.
+   if ( ( send_priority < SEND_PRIORITY_FIRST_VALUE )
+        || ( send_priority >= SEND_PRIORITY_OBJECT ) ) {
+      ostringstream errmsg;
+      errmsg << "Object::initialize():" << __LINE__
+             << " ERROR: For object '" << name << "', the 'send_priority'"
+             << " has a value that is out of the valid range of "
+             << SEND_PRIORITY_CRITICAL << " to " << SEND_PRIORITY_LOW
+             << ". Please check your input or modified-data files to make"
+             << " sure the 'send_priority' value is correctly specified."
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Attributes without their own send priority use the object priority.
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( ( attributes[i].send_priority < SEND_PRIORITY_FIRST_VALUE )
+           || ( attributes[i].send_priority > SEND_PRIORITY_LAST_VALUE ) ) {
+         ostringstream errmsg;
+         errmsg << "Object::initialize():" << __LINE__
+                << " ERROR: For object '" << name << "', the attribute '"
+                << ( ( attributes[i].FOM_name != NULL ) ? attributes[i].FOM_name : "NULL" )
+                << "' has a 'send_priority' value that is out of the valid"
+                << " range of " << SEND_PRIORITY_FIRST_VALUE << " to "
+                << SEND_PRIORITY_LAST_VALUE << ". Please check your input or"
+                << " modified-data files to make sure the 'send_priority' value"
+                << " is correctly specified." << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+      if ( attributes[i].send_priority == SEND_PRIORITY_OBJECT ) {
+         attributes[i].send_priority = send_priority;
+      }
+   }
+
    // TODO: Get the preferred order by parsing the FOM.
    //
    // Determine if any attribute is the FOM specified order.
@@ -731,6 +841,7 @@ void Object::mark_all_attributes_as_nonlocal()
       msg << THLA_ENDL;
       send_hs( stdout, msg.str().c_str() );
    }
+   notify_attribute_ownership_changed();
 }
 
 /*!
@@ -759,6 +870,11 @@ void Object::publish_object_attributes()
          for ( unsigned int i = 0; i < attr_count; ++i ) {
             if ( attributes[i].is_publish() ) {
                attrs.insert( attributes[i].get_attribute_handle() );
+
+               // Also publish the attribute carrying the shared-memory descriptor.
+               if ( attributes[i].is_shared_memory() ) {
+                  attrs.insert( attributes[i].get_shared_memory_attribute_handle() );
+               }
             }
          }
 
@@ -914,9 +1030,15 @@ void Object::subscribe_to_object_attributes()
          AttributeHandleSet attrs;
 
          // Subscribe only to the attributes we have the subscribe flag set for.
+         // A shared-memory attribute subscribes to the descriptor attribute
+         // instead so the RTI does not deliver the FOM encoded value.
          for ( unsigned int i = 0; i < attr_count; ++i ) {
             if ( attributes[i].is_subscribe() ) {
-               attrs.insert( attributes[i].get_attribute_handle() );
+               if ( attributes[i].is_shared_memory_enabled() ) {
+                  attrs.insert( attributes[i].get_shared_memory_attribute_handle() );
+               } else {
+                  attrs.insert( attributes[i].get_attribute_handle() );
+               }
             }
          }
 
@@ -1575,12 +1697,7 @@ void Object::request_attribute_value_update()
 
    // Create the set of Attribute handles we need to request an update for.
    AttributeHandleSet attr_handle_set = AttributeHandleSet();
-   for ( unsigned int i = 0; i < attr_count; ++i ) {
-      // Only include attributes that are remotely owned that are subscribed to.
-      if ( attributes[i].is_remotely_owned() && attributes[i].is_subscribe() ) {
-         attr_handle_set.insert( attributes[i].get_attribute_handle() );
-      }
-   }
+   get_remotely_owned_subscribed_attributes( attr_handle_set );
 
    try {
       rti_amb->requestAttributeValueUpdate( this->instance_handle,
@@ -1671,6 +1788,56 @@ void Object::provide_attribute_update(
    }
 }
 
+/*!
+ * @details The subscription to the descriptor attribute is kept because
+ * subscriptions are per object class and other instances of the class may
+ * still read the side channel.
+ * @job_class{scheduled}
+ */
+void Object::subscribe_to_shared_memory_fallback()
+{
+   this->shared_memory_inline_pending = false;
+
+   AttributeHandleSet attr_handle_set = AttributeHandleSet();
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( attributes[i].is_shared_memory_inline_pending() ) {
+         attributes[i].clear_shared_memory_inline_pending();
+         attr_handle_set.insert( attributes[i].get_attribute_handle() );
+      }
+   }
+   if ( attr_handle_set.empty() ) {
+      return;
+   }
+
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   RTIambassador *rti_amb = get_RTI_ambassador();
+   if ( rti_amb != NULL ) {
+      try {
+         rti_amb->subscribeObjectClassAttributes( this->class_handle,
+                                                  attr_handle_set,
+                                                  true );
+
+         // Get the current value instead of waiting for the next update.
+         rti_amb->requestAttributeValueUpdate( this->instance_handle,
+                                               attr_handle_set,
+                                               RTI1516_USERDATA( 0, 0 ) );
+      } catch ( RTI1516_EXCEPTION const &e ) {
+         string id_str;
+         StringUtilities::to_string( id_str, instance_handle );
+         string rti_err_msg;
+         StringUtilities::to_string( rti_err_msg, e.what() );
+         send_hs( stderr, "Object::subscribe_to_shared_memory_fallback():%d Exception for '%s' and instance_id=%s: '%s'%c",
+                  __LINE__, get_name(), id_str.c_str(), rti_err_msg.c_str(), THLA_NEWLINE );
+      }
+   }
+   attr_handle_set.clear();
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -1737,7 +1904,7 @@ void Object::send_requested_data(
 
    // If we have a data packing object then pack the data now.
    if ( packing != NULL ) {
-      packing->pack();
+      pack_with_metrics( get_requested_attribute_mask() );
    }
 
    // Buffer the requested attribute values for the object.
@@ -1775,6 +1942,9 @@ void Object::send_requested_data(
 
          RTIambassador *rti_amb = get_RTI_ambassador();
 
+         // Keep the send order with any updates queued for the sender thread.
+         manager->flush_async_send();
+
          if ( send_with_timestamp ) {
             if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
                send_hs( stdout, "Object::send_requested_data():%d \
@@ -1801,6 +1971,7 @@ Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds
 #ifdef THLA_CHECK_SEND_AND_RECEIVE_COUNTS
          ++send_count;
 #endif
+         count_bytes_sent();
       }
    } catch ( InvalidLogicalTime const &e ) {
       string id_str;
@@ -1997,7 +2168,7 @@ void Object::send_cyclic_and_requested_data(
 
    // If we have a data packing object then pack the data now.
    if ( packing != NULL ) {
-      packing->pack();
+      pack_with_metrics( get_send_attribute_mask( CONFIG_CYCLIC, true ) );
    }
 
    // Buffer the attribute values for the object.
@@ -2040,30 +2211,51 @@ void Object::send_cyclic_and_requested_data(
 
          RTIambassador *rti_amb = get_RTI_ambassador();
 
-         if ( send_with_timestamp ) {
-
+         if ( manager->is_async_send_enabled() ) {
             if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
                send_hs( stdout, "Object::send_cyclic_and_requested_data():%d \
-Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds.%c",
-                        __LINE__, get_name(), update_time.get_time_in_seconds(),
-                        THLA_NEWLINE );
+Object '%s', queued %s Attribute update for the sender thread, HLA Logical Time:%f seconds.%c",
+                        __LINE__, get_name(), ( send_with_timestamp ? "TSO" : "RO" ),
+                        update_time.get_time_in_seconds(), THLA_NEWLINE );
             }
 
-            // Send as Timestamp Order
-            rti_amb->updateAttributeValues( this->instance_handle,
-                                            *attribute_values_map,
-                                            RTI1516_USERDATA( 0, 0 ),
-                                            update_time.get() );
+            // Count the bytes before the queued update takes the attribute
+            // values, leaving the attribute values map empty.
+            count_bytes_sent();
+
+            manager->get_sender_thread().enqueue( get_name(),
+                                                  rti_amb,
+                                                  this->instance_handle,
+                                                  *attribute_values_map,
+                                                  send_with_timestamp,
+                                                  update_time );
          } else {
-            if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
-               send_hs( stdout, "Object::send_cyclic_and_requested_data():%d Object '%s', Receive Order (RO) Attribute update.%c",
-                        __LINE__, get_name(), THLA_NEWLINE );
-            }
+            if ( send_with_timestamp ) {
 
-            // Send as Receive Order (i.e. with no timestamp).
-            rti_amb->updateAttributeValues( this->instance_handle,
-                                            *attribute_values_map,
-                                            RTI1516_USERDATA( 0, 0 ) );
+               if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+                  send_hs( stdout, "Object::send_cyclic_and_requested_data():%d \
+Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds.%c",
+                           __LINE__, get_name(), update_time.get_time_in_seconds(),
+                           THLA_NEWLINE );
+               }
+
+               // Send as Timestamp Order
+               rti_amb->updateAttributeValues( this->instance_handle,
+                                               *attribute_values_map,
+                                               RTI1516_USERDATA( 0, 0 ),
+                                               update_time.get() );
+            } else {
+               if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+                  send_hs( stdout, "Object::send_cyclic_and_requested_data():%d Object '%s', Receive Order (RO) Attribute update.%c",
+                           __LINE__, get_name(), THLA_NEWLINE );
+               }
+
+               // Send as Receive Order (i.e. with no timestamp).
+               rti_amb->updateAttributeValues( this->instance_handle,
+                                               *attribute_values_map,
+                                               RTI1516_USERDATA( 0, 0 ) );
+            }
+            count_bytes_sent();
          }
 #ifdef THLA_CHECK_SEND_AND_RECEIVE_COUNTS
          ++send_count;
@@ -2268,7 +2460,7 @@ void Object::send_zero_lookahead_and_requested_data(
 
    // If we have a data packing object then pack the data now.
    if ( packing != NULL ) {
-      packing->pack();
+      pack_with_metrics( get_send_attribute_mask( CONFIG_ZERO_LOOKAHEAD, true ) );
    }
 
    // Buffer the attribute values for the object.
@@ -2325,6 +2517,9 @@ void Object::send_zero_lookahead_and_requested_data(
 
          RTIambassador *rti_amb = get_RTI_ambassador();
 
+         // Keep the send order with any updates queued for the sender thread.
+         manager->flush_async_send();
+
          if ( send_with_timestamp ) {
 
             if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
@@ -2354,6 +2549,7 @@ Object '%s', Receive Order (RO) Attribute update.%c",
 #ifdef THLA_CHECK_SEND_AND_RECEIVE_COUNTS
          ++send_count;
 #endif
+         count_bytes_sent();
       }
    } catch ( InvalidLogicalTime const &e ) {
       string id_str;
@@ -2522,6 +2718,12 @@ void Object::receive_cyclic_data()
       return;
    }
 
+   // Subscribe to the FOM encoded values that could not be read from the
+   // shared-memory side channel of the publisher.
+   if ( shared_memory_inline_pending ) {
+      subscribe_to_shared_memory_fallback();
+   }
+
    // Block waiting for received data if the user has specified we must do so.
    if ( blocking_cyclic_read ) {
 
@@ -2598,7 +2800,7 @@ void Object::receive_cyclic_data()
 
          // Unpack the data for the object if we have a packing object.
          if ( packing != NULL ) {
-            packing->unpack();
+            unpack_with_metrics( get_received_attribute_mask() );
          }
 
          // Do lag compensation.
@@ -2676,7 +2878,7 @@ void Object::receive_zero_lookahead_data()
 
       // Unpack the data for the object if we have a packing object.
       if ( packing != NULL ) {
-         packing->unpack();
+         unpack_with_metrics( get_received_attribute_mask() );
       }
 
       // Lag-compensation is not supported for zero-lookahead, but if
@@ -2752,7 +2954,7 @@ void Object::send_init_data()
 
    // If we have a data packing object then pack the data now.
    if ( packing != NULL ) {
-      packing->pack();
+      pack_with_metrics( get_send_attribute_mask( CONFIG_INITIALIZE, false ) );
    }
 
    // Buffer the attribute values for the object.
@@ -2778,6 +2980,9 @@ void Object::send_init_data()
                      __LINE__, get_name(), THLA_NEWLINE );
          }
 
+         // Keep the send order with any updates queued for the sender thread.
+         manager->flush_async_send();
+
          // Send the Attributes to the federation. This call returns an
          // event retraction handle but we don't support event retraction
          // so no need to store it.
@@ -2787,6 +2992,7 @@ void Object::send_init_data()
 #ifdef THLA_CHECK_SEND_AND_RECEIVE_COUNTS
          ++send_count;
 #endif
+         count_bytes_sent();
       }
    } catch ( InvalidLogicalTime const &e ) {
       string id_str;
@@ -2954,7 +3160,7 @@ void Object::receive_init_data()
 
       // Unpack the data for the object if we have a packing object.
       if ( packing != NULL ) {
-         packing->unpack();
+         unpack_with_metrics( get_received_attribute_mask() );
       }
 
       // Lag-compensation is not supported for init-data, but if
@@ -3001,6 +3207,11 @@ void Object::create_requested_attribute_set()
          }
          // Create the Attribute-Value from the buffered data.
          ( *attribute_values_map )[attributes[i].get_attribute_handle()] = attributes[i].get_attribute_value();
+
+         if ( is_shared_memory_sender( i ) ) {
+            ( *attribute_values_map )[attributes[i].get_shared_memory_attribute_handle()] =
+               attributes[i].get_shared_memory_value();
+         }
       }
    }
 }
@@ -3012,8 +3223,15 @@ void Object::create_attribute_set(
    DataUpdateEnum const required_config,
    bool const           include_requested )
 {
-   // Make sure we clear the map before we populate it.
-   if ( !attribute_values_map->empty() ) {
+   // The zero-copy map is persistent and only works with synchronous sends
+   // because the asynchronous sender takes the attribute values.
+   bool const zero_copy = this->zero_copy_send && !manager->is_async_send_enabled();
+
+   if ( zero_copy ) {
+      // Keep the map nodes and only track which attributes are sent.
+      this->zero_copy_attr_included.assign( attr_count, false );
+   } else if ( !attribute_values_map->empty() ) {
+      // Make sure we clear the map before we populate it.
       attribute_values_map->clear();
    }
 
@@ -3050,8 +3268,7 @@ void Object::create_attribute_set(
                            __LINE__, get_name(), attributes[i].get_FOM_name(), THLA_NEWLINE );
                }
                // Create the Attribute-Value from the buffered data.
-               ( *attribute_values_map )[attributes[i].get_attribute_handle()] =
-                  attributes[i].get_attribute_value();
+               add_attribute_value( i, zero_copy );
             }
          }
       }
@@ -3083,8 +3300,7 @@ void Object::create_attribute_set(
                            __LINE__, get_name(), attributes[i].get_FOM_name(), THLA_NEWLINE );
                }
                // Create the Attribute-Value from the buffered data.
-               ( *attribute_values_map )[attributes[i].get_attribute_handle()] =
-                  attributes[i].get_attribute_value();
+               add_attribute_value( i, zero_copy );
             }
          }
       }
@@ -3103,8 +3319,77 @@ void Object::create_attribute_set(
             attributes[i].set_update_requested( false );
 
             // Create the Attribute-Value from the buffered data.
-            ( *attribute_values_map )[attributes[i].get_attribute_handle()] =
-               attributes[i].get_attribute_value();
+            add_attribute_value( i, zero_copy );
+         }
+      }
+   }
+
+   if ( zero_copy ) {
+      remove_excluded_attribute_values();
+   }
+}
+
+/*!
+ * @details With zero-copy the map node for the attribute is only allocated
+ * the first time the attribute is sent, after which the value is just
+ * pointed at the attribute buffer again.
+ * @job_class{scheduled}
+ */
+void Object::add_attribute_value(
+   unsigned int const index,
+   bool const         zero_copy )
+{
+   if ( zero_copy ) {
+      this->zero_copy_attr_included[index] = true;
+      attributes[index].get_attribute_value_pointer(
+         ( *attribute_values_map )[attributes[index].get_attribute_handle()] );
+   } else {
+      ( *attribute_values_map )[attributes[index].get_attribute_handle()] =
+         attributes[index].get_attribute_value();
+   }
+
+   // The descriptor attribute is sent along with the FOM encoded value.
+   if ( is_shared_memory_sender( index ) ) {
+      if ( zero_copy ) {
+         attributes[index].get_shared_memory_value_pointer(
+            ( *attribute_values_map )[attributes[index].get_shared_memory_attribute_handle()] );
+      } else {
+         ( *attribute_values_map )[attributes[index].get_shared_memory_attribute_handle()] =
+            attributes[index].get_shared_memory_value();
+      }
+   }
+}
+
+/*!
+ * @details Only the federate that registered the object instance owns the
+ * descriptor attribute, since ownership of the descriptor attribute is not
+ * transferred along with the value attribute.
+ * @job_class{scheduled}
+ */
+bool const Object::is_shared_memory_sender(
+   unsigned int const index ) const
+{
+   return ( attributes[index].is_shared_memory() && this->create_HLA_instance );
+}
+
+/*!
+ * @details Only the attributes that were sent last time but not this time
+ * are erased, so the map membership is toggled instead of rebuilt.
+ * @job_class{scheduled}
+ */
+void Object::remove_excluded_attribute_values()
+{
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( !this->zero_copy_attr_included[i] ) {
+         AttributeHandleValueMap::iterator iter = attribute_values_map->find( attributes[i].get_attribute_handle() );
+         if ( iter != attribute_values_map->end() ) {
+            attribute_values_map->erase( iter );
+         }
+         if ( is_shared_memory_sender( i ) ) {
+            iter = attribute_values_map->find( attributes[i].get_shared_memory_attribute_handle() );
+            if ( iter != attribute_values_map->end() ) {
+               attribute_values_map->erase( iter );
+            }
          }
       }
    }
@@ -3115,13 +3400,33 @@ void Object::create_attribute_set(
  * @job_class{scheduled}
  */
 void Object::enqueue_data(
-   AttributeHandleValueMap const &theAttributes )
+   AttributeHandleValueMap const &theAttributes,
+   int64_t const                  time )
 {
+   // Wait for room before taking the receive mutex, which the Trick main
+   // thread needs to drain the queue.
+   if ( !thla_reflected_attributes_queue.wait_for_room( get_federate() )
+        && DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+      send_hs( stderr, "Object::enqueue_data():%d WARNING: For object '%s', could \
+not wait for room in the reflection queue, dropping the oldest reflection.%c",
+               __LINE__, name, THLA_NEWLINE );
+   }
+
    // When auto_unlock_mutex goes out of scope it automatically unlocks the
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &receive_mutex );
 
-   thla_reflected_attributes_queue.push( theAttributes );
+   if ( thla_reflected_attributes_queue.push( theAttributes, time ) ) {
+      send_hs( stderr, "Object::enqueue_data():%d WARNING: For object '%s', the \
+reflection queue reached its maximum depth of %d, applying the overflow policy %d.%c",
+               __LINE__, name, thla_reflected_attributes_queue.get_max_depth(),
+               (int)reflection_queue_policy, THLA_NEWLINE );
+   }
+
+   // Let the manager know this object has data to process.
+   if ( manager != NULL ) {
+      manager->mark_object_as_changed( this );
+   }
 }
 #endif // THLA_QUEUE_REFLECTED_ATTRIBUTES
 
@@ -3146,10 +3451,17 @@ bool Object::extract_data(
 
    bool any_attr_received = false;
 
+   bool const         collecting_metrics = is_collecting_metrics();
+   unsigned long long received_size      = 0;
+
    AttributeHandleValueMap::iterator iter;
 
    for ( iter = theAttributes.begin(); iter != theAttributes.end(); ++iter ) {
 
+      if ( collecting_metrics ) {
+         received_size += iter->second.size();
+      }
+
       // Get the TrickHLA Attribute for the given AttributeHandle from the
       // attribute-handle-value map.
       // NOTE: The value of iter->first is of type AttributeHandle.
@@ -3162,6 +3474,15 @@ bool Object::extract_data(
          if ( attr->extract_data( &( iter->second ) ) ) {
             any_attr_received = true;
          }
+      } else if ( ( attr = get_shared_memory_attribute( iter->first ) ) != NULL ) {
+
+         // Place the value the shared-memory descriptor refers to into the
+         // TrickHLA Attribute.
+         if ( attr->extract_shared_memory_data( &( iter->second ) ) ) {
+            any_attr_received = true;
+         } else if ( attr->is_shared_memory_inline_pending() ) {
+            this->shared_memory_inline_pending = true;
+         }
       } else if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
          string id_str;
          StringUtilities::to_string( id_str, iter->first );
@@ -3180,6 +3501,20 @@ this attribute.%c",
 
       // Flag for user use to indicate the data changed.
       this->data_changed = true;
+
+   } else if ( this->shared_memory_inline_pending && ( manager != NULL ) ) {
+      // Nothing could be read from the shared-memory side channel, but the
+      // object must still be visited in the next receive so that it
+      // subscribes to the FOM encoded values.
+      manager->mark_object_as_changed( this );
+   }
+
+   // The metrics are read from the Trick main thread.
+   if ( received_size > 0 ) {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &receive_mutex );
+      this->bytes_received += received_size;
    }
    return any_attr_received;
 }
@@ -3296,6 +3631,9 @@ void Object::release_ownership()
             }
          }
       }
+      if ( !attrs.empty() ) {
+         notify_attribute_ownership_changed();
+      }
    } catch ( ObjectInstanceNotKnown const &e ) {
       string rti_err_msg;
       StringUtilities::to_string( rti_err_msg, e.what() );
@@ -3642,6 +3980,7 @@ No attributes Divested since no federate wanted them for object '%s'.%c",
                   }
                }
             }
+            notify_attribute_ownership_changed();
          }
       } catch ( RTI1516_EXCEPTION const &e ) {
          send_hs( stderr, "Object::grant_pull_request():%d Unable to grant \
@@ -4101,6 +4440,63 @@ void Object::set_core_job_cycle_time(
    }
 }
 
+void Object::skip_data_cycles(
+   int const skipped_cycles )
+{
+   if ( skipped_cycles > 0 ) {
+      for ( unsigned int i = 0; i < attr_count; ++i ) {
+         attributes[i].skip_data_cycles( skipped_cycles );
+      }
+   }
+}
+
+int Object::get_data_cycles_until_ready() const
+{
+   int cycles = 0;
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+
+      // Only published cyclic attributes are sent on a sub-rate.
+      if ( attributes[i].is_publish()
+           && ( ( attributes[i].get_configuration() & CONFIG_CYCLIC ) == CONFIG_CYCLIC ) ) {
+
+         int const attr_cycles = attributes[i].get_data_cycles_until_ready();
+         if ( ( cycles <= 0 ) || ( attr_cycles < cycles ) ) {
+            cycles = attr_cycles;
+         }
+      }
+   }
+   return cycles;
+}
+
+void Object::set_send_degradation_level(
+   int const level,
+   int const degrade_factor )
+{
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      SendPriorityEnum const priority = ( attributes[i].send_priority == SEND_PRIORITY_OBJECT )
+                                           ? this->send_priority
+                                           : attributes[i].send_priority;
+
+      int const steps = level - ( SEND_PRIORITY_LOW - priority );
+      int       scale = 1;
+      if ( priority != SEND_PRIORITY_CRITICAL ) {
+         for ( int k = 0; k < steps; ++k ) {
+            scale *= degrade_factor;
+         }
+      }
+      attributes[i].set_cycle_ratio_scale( scale );
+   }
+}
+
+unsigned long long Object::get_dropped_send_count() const
+{
+   unsigned long long count = 0;
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      count += attributes[i].get_dropped_send_count();
+   }
+   return count;
+}
+
 void Object::set_name(
    char const *new_name )
 {
@@ -4123,8 +4519,12 @@ void Object::set_name(
 void Object::build_attribute_map()
 {
    thla_attribute_map.clear();
+   thla_shm_attribute_map.clear();
    for ( unsigned int i = 0; i < attr_count; ++i ) {
       thla_attribute_map[attributes[i].get_attribute_handle()] = &attributes[i];
+      if ( attributes[i].is_shared_memory() ) {
+         thla_shm_attribute_map[attributes[i].get_shared_memory_attribute_handle()] = &attributes[i];
+      }
    }
 }
 
@@ -4150,6 +4550,13 @@ Attribute *Object::get_attribute(
    return ( ( iter != thla_attribute_map.end() ) ? iter->second : NULL );
 }
 
+Attribute *Object::get_shared_memory_attribute(
+   RTI1516_NAMESPACE::AttributeHandle attr_handle )
+{
+   AttributeMap::const_iterator iter = thla_shm_attribute_map.find( attr_handle );
+   return ( ( iter != thla_shm_attribute_map.end() ) ? iter->second : NULL );
+}
+
 Attribute *Object::get_attribute(
    string const &attr_FOM_name )
 {
@@ -4177,6 +4584,11 @@ void Object::stop_publishing_attributes()
    for ( unsigned int i = 0; i < attr_count; ++i ) {
       attributes[i].set_publish( false );
    }
+
+   // Take the object off the send schedule of the manager.
+   if ( manager != NULL ) {
+      manager->mark_object_send_schedule_changed( this );
+   }
 }
 
 void Object::stop_subscribing_attributes()
@@ -4320,6 +4732,30 @@ bool Object::any_remotely_owned_subscribed_attribute()
    return false; // No attribute remotely owned and subscribed.
 }
 
+void Object::get_remotely_owned_subscribed_attributes(
+   AttributeHandleSet &attr_handle_set )
+{
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      // Only include attributes that are remotely owned that are subscribed to.
+      if ( attributes[i].is_remotely_owned() && attributes[i].is_subscribe() ) {
+         attr_handle_set.insert( attributes[i].get_attribute_handle() );
+      }
+   }
+}
+
+size_t Object::get_requested_attribute_size()
+{
+   size_t size = 0;
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( attributes[i].is_locally_owned()
+           && attributes[i].is_publish()
+           && attributes[i].is_update_requested() ) {
+         size += attributes[i].get_attribute_size();
+      }
+   }
+   return size;
+}
+
 bool Object::any_remotely_owned_subscribed_attribute(
    DataUpdateEnum const attr_config )
 {
@@ -4372,7 +4808,10 @@ void Object::set_to_unblocking_cyclic_reads()
 
 void Object::notify_attribute_ownership_changed()
 {
-   return;
+   // Put the object back on the send schedule of the manager.
+   if ( manager != NULL ) {
+      manager->mark_object_send_schedule_changed( this );
+   }
 }
 
 void Object::mark_changed()
@@ -4381,6 +4820,11 @@ void Object::mark_changed()
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &receive_mutex );
    this->changed = true;
+
+   // Let the manager know this object has data to process.
+   if ( manager != NULL ) {
+      manager->mark_object_as_changed( this );
+   }
 }
 
 void Object::mark_unchanged()
@@ -4713,3 +5157,124 @@ bool Object::is_thread_associated(
    }
    return ( this->thread_ids_array[thread_id] );
 }
+
+bool const Object::is_collecting_metrics() const
+{
+   return ( ( manager != NULL ) && manager->is_collecting_metrics() );
+}
+
+PackingAttributeMask const Object::get_send_attribute_mask(
+   DataUpdateEnum const required_config,
+   bool const           include_requested ) const
+{
+   bool const cyclic         = ( ( required_config & CONFIG_CYCLIC ) == CONFIG_CYCLIC );
+   bool const zero_lookahead = !cyclic && ( ( required_config & CONFIG_ZERO_LOOKAHEAD ) == CONFIG_ZERO_LOOKAHEAD );
+
+   PackingAttributeMask attr_mask = 0;
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( !attributes[i].is_locally_owned() || !attributes[i].is_publish() ) {
+         continue;
+      }
+      bool const config_match = ( ( attributes[i].get_configuration() & required_config ) == required_config );
+
+      bool due;
+      if ( cyclic ) {
+         due = ( include_requested && attributes[i].is_update_requested() )
+               || ( attributes[i].is_data_cycle_ready() && config_match );
+      } else if ( zero_lookahead ) {
+         due = ( include_requested && attributes[i].is_update_requested() )
+               || config_match;
+      } else {
+         due = config_match;
+      }
+      if ( due ) {
+         attr_mask |= ( (PackingAttributeMask)1 ) << ( ( i < 63 ) ? i : 63 );
+      }
+   }
+   return attr_mask;
+}
+
+PackingAttributeMask const Object::get_requested_attribute_mask() const
+{
+   PackingAttributeMask attr_mask = 0;
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( attributes[i].is_update_requested()
+           && attributes[i].is_locally_owned()
+           && attributes[i].is_publish() ) {
+         attr_mask |= ( (PackingAttributeMask)1 ) << ( ( i < 63 ) ? i : 63 );
+      }
+   }
+   return attr_mask;
+}
+
+PackingAttributeMask const Object::get_received_attribute_mask() const
+{
+   PackingAttributeMask attr_mask = 0;
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( attributes[i].is_received() ) {
+         attr_mask |= ( (PackingAttributeMask)1 ) << ( ( i < 63 ) ? i : 63 );
+      }
+   }
+   return attr_mask;
+}
+
+void Object::pack_with_metrics(
+   PackingAttributeMask const attr_mask )
+{
+   if ( is_collecting_metrics() ) {
+      count_masked_attributes( attr_mask );
+      int64_t const start_time = MonotonicClock::get_time_micros();
+      packing->pack_masked( attr_mask );
+      this->pack_time += MonotonicClock::get_time_micros() - start_time;
+   } else {
+      packing->pack_masked( attr_mask );
+   }
+}
+
+void Object::unpack_with_metrics(
+   PackingAttributeMask const attr_mask )
+{
+   if ( is_collecting_metrics() ) {
+      count_masked_attributes( attr_mask );
+      int64_t const start_time = MonotonicClock::get_time_micros();
+      packing->unpack_masked( attr_mask );
+      this->unpack_time += MonotonicClock::get_time_micros() - start_time;
+   } else {
+      packing->unpack_masked( attr_mask );
+   }
+}
+
+void Object::count_masked_attributes(
+   PackingAttributeMask const attr_mask )
+{
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( ( attr_mask & ( ( (PackingAttributeMask)1 ) << ( ( i < 63 ) ? i : 63 ) ) ) != 0 ) {
+         ++packed_attr_count;
+      } else {
+         ++skipped_attr_count;
+      }
+   }
+}
+
+/*!
+ * @details The count is updated by the RTI callback thread that reflects
+ * the attribute values, so it is read under the receive mutex.
+ * @job_class{scheduled}
+ */
+unsigned long long Object::get_bytes_received()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &receive_mutex );
+   return this->bytes_received;
+}
+
+void Object::count_bytes_sent()
+{
+   if ( is_collecting_metrics() ) {
+      AttributeHandleValueMap::const_iterator iter;
+      for ( iter = attribute_values_map->begin(); iter != attribute_values_map->end(); ++iter ) {
+         this->bytes_sent += iter->second.size();
+      }
+   }
+}
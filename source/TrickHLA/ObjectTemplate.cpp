@@ -0,0 +1,291 @@
+/*!
+@file TrickHLA/ObjectTemplate.cpp
+@ingroup TrickHLA
+@brief This class defines a class-level template used by the TrickHLA Manager
+to instantiate TrickHLA Objects for discovered object instances.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Attribute.cpp}
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{LagCompensation.cpp}
+@trick_link_dependency{Object.cpp}
+@trick_link_dependency{ObjectTemplate.cpp}
+@trick_link_dependency{Packing.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstring>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/MemoryManager.hh"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/LagCompensation.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/ObjectTemplate.hh"
+#include "TrickHLA/Packing.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+ObjectTemplate::ObjectTemplate()
+   : name( NULL ),
+     FOM_name( NULL ),
+     pool_size( 0 ),
+     attr_count( 0 ),
+     attributes( NULL ),
+     packing( NULL ),
+     lag_comp( NULL ),
+     lag_comp_type( LAG_COMPENSATION_NONE ),
+     instance_count( 0 ),
+     prototype_index( -1 ),
+     pending_instances()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+ObjectTemplate::~ObjectTemplate()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void ObjectTemplate::initialize()
+{
+   // The template name is used to build the Trick variable names of the
+   // allocated instances so it must be specified.
+   if ( ( name == NULL ) || ( *name == '\0' ) ) {
+      ostringstream errmsg;
+      errmsg << "ObjectTemplate::initialize():" << __LINE__
+             << " ERROR: Missing Object Template Name. Please check your input"
+             << " or modified-data files to make sure the object template name"
+             << " is correctly specified." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( ( FOM_name == NULL ) || ( *FOM_name == '\0' ) ) {
+      ostringstream errmsg;
+      errmsg << "ObjectTemplate::initialize():" << __LINE__
+             << " ERROR: Object Template '" << name << "' is missing the Object"
+             << " FOM Name. Please check your input or modified-data files to"
+             << " make sure the object FOM name is correctly specified."
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( pool_size <= 0 ) {
+      ostringstream errmsg;
+      errmsg << "ObjectTemplate::initialize():" << __LINE__
+             << " ERROR: Object Template '" << name << "' has an invalid"
+             << " 'pool_size' of " << pool_size << ", which must be greater"
+             << " than zero. Please check your input or modified-data files."
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( ( attr_count <= 0 ) || ( attributes == NULL ) ) {
+      ostringstream errmsg;
+      errmsg << "ObjectTemplate::initialize():" << __LINE__
+             << " ERROR: For Object Template '" << name << "', the 'attr_count'"
+             << " is " << attr_count << " and 'attributes' are "
+             << ( ( attributes == NULL ) ? "not " : "" ) << "specified."
+             << " Please check your input or modified-data files to make sure"
+             << " the template attributes are correctly specified." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // The attribute trick_names are relative to the packing instance so we
+   // must have a packing object to create instances from.
+   if ( packing == NULL ) {
+      ostringstream errmsg;
+      errmsg << "ObjectTemplate::initialize():" << __LINE__
+             << " ERROR: For Object Template '" << name << "', the 'packing'"
+             << " prototype object is NULL. Please check your input or"
+             << " modified-data files to make sure the packing is correctly"
+             << " specified." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( ( lag_comp_type != LAG_COMPENSATION_NONE ) && ( lag_comp == NULL ) ) {
+      ostringstream errmsg;
+      errmsg << "ObjectTemplate::initialize():" << __LINE__
+             << " ERROR: For Object Template '" << name << "', Lag-Compensation"
+             << " 'lag_comp_type' is specified, but 'lag_comp' is NULL! Please"
+             << " check your input or modified-data files to make sure the"
+             << " Lag-Compensation type and object are correctly specified."
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   for ( int i = 0; i < attr_count; ++i ) {
+      if ( ( attributes[i].FOM_name == NULL ) || ( *( attributes[i].FOM_name ) == '\0' )
+           || ( attributes[i].trick_name == NULL ) || ( *( attributes[i].trick_name ) == '\0' ) ) {
+         ostringstream errmsg;
+         errmsg << "ObjectTemplate::initialize():" << __LINE__
+                << " ERROR: Object Template '" << name << "' has a missing"
+                << " Attribute FOM Name or Trick Name at array index " << i
+                << ". Please check your input or modified-data files to make"
+                << " sure the template attributes are correctly specified."
+                << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+}
+
+/*!
+ * @details The object is configured as a remotely owned object that does not
+ * require a name, so it binds to the next discovered instance of the class.
+ * The Trick memory allocations are not thread safe, so this is only called
+ * from the Trick main thread.
+ * @job_class{scheduled}
+ */
+void ObjectTemplate::instantiate(
+   Object   &obj,
+   int const obj_index )
+{
+   if ( !is_pool_available() ) {
+      ostringstream errmsg;
+      errmsg << "ObjectTemplate::instantiate():" << __LINE__
+             << " ERROR: The pool of " << pool_size << " objects for Object"
+             << " Template '" << name << "' is exhausted!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Unique Trick variable name for the allocations of this instance.
+   ostringstream inst_name;
+   inst_name << name << "_" << instance_count;
+   string const inst_name_str = inst_name.str();
+
+   Packing *inst_packing = packing->create_template_instance( inst_name_str.c_str() );
+   if ( inst_packing == NULL ) {
+      ostringstream errmsg;
+      errmsg << "ObjectTemplate::instantiate():" << __LINE__
+             << " ERROR: For Object Template '" << name << "', the 'packing'"
+             << " class failed to create an instance or does not implement"
+             << " create_template_instance(), which is required to instantiate"
+             << " objects from a template."
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   LagCompensation *inst_lag_comp = NULL;
+   if ( lag_comp != NULL ) {
+      string const lag_comp_name_str = inst_name_str + "_lag_comp";
+
+      inst_lag_comp = lag_comp->create_template_instance( lag_comp_name_str.c_str(), inst_packing );
+      if ( inst_lag_comp == NULL ) {
+         ostringstream errmsg;
+         errmsg << "ObjectTemplate::instantiate():" << __LINE__
+                << " ERROR: For Object Template '" << name << "', the 'lag_comp'"
+                << " class failed to create an instance or does not implement"
+                << " create_template_instance(), which is required to instantiate"
+                << " objects from a template."
+                << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+
+   obj.name                = NULL;
+   obj.name_required       = false;
+   obj.FOM_name            = allocate_input_string( FOM_name );
+   obj.create_HLA_instance = false;
+   obj.required            = false;
+   obj.packing             = inst_packing;
+   obj.lag_comp            = inst_lag_comp;
+   obj.lag_comp_type       = lag_comp_type;
+
+   obj.attr_count = attr_count;
+   obj.attributes = static_cast< Attribute * >( trick_MM->declare_var( "TrickHLA::Attribute", attr_count ) );
+   if ( obj.attributes == NULL ) {
+      ostringstream errmsg;
+      errmsg << "ObjectTemplate::instantiate():" << __LINE__
+             << " ERROR: Could not allocate memory for " << attr_count
+             << " attributes for Object Template '" << name << "'!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   for ( int i = 0; i < attr_count; ++i ) {
+      obj.attributes[i].FOM_name        = allocate_input_string( attributes[i].FOM_name );
+      obj.attributes[i].trick_name      = allocate_input_string( inst_name_str + "." + attributes[i].trick_name );
+      obj.attributes[i].config          = attributes[i].config;
+      obj.attributes[i].preferred_order = attributes[i].preferred_order;
+      obj.attributes[i].publish         = attributes[i].publish;
+      obj.attributes[i].subscribe       = attributes[i].subscribe;
+      obj.attributes[i].locally_owned   = attributes[i].locally_owned;
+      obj.attributes[i].rti_encoding    = attributes[i].rti_encoding;
+      obj.attributes[i].cycle_time      = attributes[i].cycle_time;
+      obj.attributes[i].send_priority   = attributes[i].send_priority;
+
+      obj.attributes[i].shared_memory          = attributes[i].shared_memory;
+      obj.attributes[i].shared_memory_FOM_name = ( attributes[i].shared_memory_FOM_name != NULL )
+                                                    ? allocate_input_string( attributes[i].shared_memory_FOM_name )
+                                                    : NULL;
+      obj.attributes[i].shared_memory_capacity = attributes[i].shared_memory_capacity;
+   }
+
+   if ( instance_count == 0 ) {
+      this->prototype_index = obj_index;
+   }
+   ++instance_count;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+      send_hs( stdout, "ObjectTemplate::instantiate():%d Template '%s' instance '%s' at object index %d (%d of %d).%c",
+               __LINE__, name, inst_name_str.c_str(), obj_index, instance_count,
+               pool_size, THLA_NEWLINE );
+   }
+}
+
+bool ObjectTemplate::remove_pending_instance(
+   RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_hdl )
+{
+   deque< pair< RTI1516_NAMESPACE::ObjectInstanceHandle, wstring > >::iterator iter;
+   for ( iter = pending_instances.begin(); iter != pending_instances.end(); ++iter ) {
+      if ( iter->first == instance_hdl ) {
+         pending_instances.erase( iter );
+         return true;
+      }
+   }
+   return false;
+}
+
+char *ObjectTemplate::allocate_input_string(
+   string const &cpp_string )
+{
+   char *new_c_str = static_cast< char * >( TMM_declare_var_1d( "char", cpp_string.length() + 1 ) );
+   strncpy( new_c_str, cpp_string.c_str(), cpp_string.length() + 1 );
+
+   return new_c_str;
+}
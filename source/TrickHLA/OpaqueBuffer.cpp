@@ -20,6 +20,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{MemoryAccounting.cpp}
 @trick_link_dependency{OpaqueBuffer.cpp}
 @trick_link_dependency{Utilities.cpp}
 
@@ -46,6 +47,7 @@ NASA, Johnson Space Center\n
 
 // TrickHLA model include files.
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/MemoryAccounting.hh"
 #include "TrickHLA/OpaqueBuffer.hh"
 #include "TrickHLA/Utilities.hh"
 
@@ -79,6 +81,7 @@ OpaqueBuffer::~OpaqueBuffer() // RETURN: -- None.
          send_hs( stderr, "OpaqueBuffer::~OpaqueBuffer():%d ERROR deleting Trick Memory for 'buffer'%c",
                   __LINE__, THLA_NEWLINE );
       }
+      MemoryAccounting::record( MEMORY_OPAQUE_BUFFERS, -(int64_t)capacity );
       buffer   = NULL;
       capacity = 0;
       push_pos = 0;
@@ -116,7 +119,8 @@ void OpaqueBuffer::set_byte_alignment( unsigned int const size )
 void OpaqueBuffer::ensure_buffer_capacity(
    size_t const size )
 {
-   size_t requested_size = size;
+   size_t const prev_capacity  = ( buffer != NULL ) ? capacity : 0;
+   size_t       requested_size = size;
 
    // Make sure the requested capacity is a multiple of the byte alignment.
    if ( alignment > 1 ) {
@@ -149,6 +153,8 @@ void OpaqueBuffer::ensure_buffer_capacity(
              << " capacity " << capacity << "!" << THLA_ENDL;
       DebugHandler::terminate_with_message( errmsg.str() );
    }
+
+   MemoryAccounting::record( MEMORY_OPAQUE_BUFFERS, (int64_t)capacity - (int64_t)prev_capacity );
 }
 
 void OpaqueBuffer::push_to_buffer(
@@ -57,7 +57,8 @@ using namespace TrickHLA;
  */
 Packing::Packing()
    : initialized( false ),
-     object( NULL )
+     object( NULL ),
+     attr_mask( THLA_PACKING_ALL_ATTRIBUTES )
 {
    return;
 }
@@ -146,6 +147,46 @@ Attribute *Packing::get_attribute_and_validate(
    return attr;
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void Packing::pack_masked(
+   PackingAttributeMask const mask )
+{
+   this->attr_mask = mask;
+   pack();
+   this->attr_mask = THLA_PACKING_ALL_ATTRIBUTES;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Packing::unpack_masked(
+   PackingAttributeMask const mask )
+{
+   this->attr_mask = mask;
+   unpack();
+   this->attr_mask = THLA_PACKING_ALL_ATTRIBUTES;
+}
+
+/*!
+ * @details The bit is found from the position of the attribute in the
+ * attribute array of the object so no lookup is needed.
+ */
+PackingAttributeMask const Packing::get_attribute_mask_bit(
+   Attribute const *attr ) const
+{
+   if ( ( object == NULL ) || ( attr == NULL ) ) {
+      return 0;
+   }
+   Attribute const *attrs = object->get_attributes();
+   if ( ( attrs == NULL ) || ( attr < attrs ) || ( attr >= ( attrs + object->get_attribute_count() ) ) ) {
+      return 0;
+   }
+   unsigned int const index = (unsigned int)( attr - attrs );
+   return ( ( (PackingAttributeMask)1 ) << ( ( index < 63 ) ? index : 63 ) );
+}
+
 /*!
  * @brief Get the current scenario time.
  * @return Returns the current scenario time.
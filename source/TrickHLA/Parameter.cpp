@@ -18,6 +18,8 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{DebugHandler.cpp}
 @trick_link_dependency{Int64BaseTime.cpp}
+@trick_link_dependency{MemoryAccounting.cpp}
+@trick_link_dependency{MemoryUsage.cpp}
 @trick_link_dependency{Parameter.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{Utilities.cpp}
@@ -54,6 +56,9 @@ NASA, Johnson Space Center\n
 // TrickHLA include files.
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/Int64BaseTime.hh"
+#include "TrickHLA/MemoryAccounting.hh"
+#include "TrickHLA/MemoryUsage.hh"
+#include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Parameter.hh"
 #include "TrickHLA/StringUtilities.hh"
 #include "TrickHLA/Types.hh"
@@ -81,6 +86,7 @@ Parameter::Parameter()
      rti_encoding( ENCODING_UNKNOWN ),
      buffer( NULL ),
      buffer_capacity( 0 ),
+     memory_owner( NULL ),
      size_is_static( true ),
      size( 0 ),
      num_items( 0 ),
@@ -106,6 +112,7 @@ Parameter::~Parameter()
          send_hs( stderr, "Parameter::~Parameter():%d ERROR deleting Trick Memory for 'buffer'%c",
                   __LINE__, THLA_NEWLINE );
       }
+      MemoryAccounting::record( MEMORY_PARAMETER_BUFFERS, -(int64_t)buffer_capacity, memory_owner );
       buffer          = NULL;
       buffer_capacity = 0;
    }
@@ -171,7 +178,14 @@ void Parameter::initialize(
    }
 
    // Get the ref-attributes.
-   REF2 *ref2 = ref_attributes( trick_name );
+   REF2 *ref2;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &Utilities::trick_mm_mutex );
+
+      ref2 = ref_attributes( trick_name );
+   }
 
    // Determine if we had an error getting the ref-attributes.
    if ( ref2 == (REF2 *)NULL ) {
@@ -188,9 +202,15 @@ void Parameter::initialize(
       DebugHandler::terminate_with_message( errmsg.str() );
    } else {
 
-      address              = ref2->address;
-      attr                 = ref2->attr;
-      interaction_FOM_name = trick_MM->mm_strdup( const_cast< char * >( interaction_fom_name ) );
+      address = ref2->address;
+      attr    = ref2->attr;
+      {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &Utilities::trick_mm_mutex );
+
+         interaction_FOM_name = trick_MM->mm_strdup( const_cast< char * >( interaction_fom_name ) );
+      }
 
       // Free the memory used by ref2.
       free( ref2 );
@@ -475,11 +495,18 @@ void Parameter::complete_initialization()
    // Determine if the size of this parameter is static or dynamic.
    size_is_static = is_static_in_size();
 
-   // Get the parameter size and number of items.
-   calculate_size_and_number_of_items();
+   {
+      // The size of a dynamic array and the buffer come from the Trick
+      // memory-manager. When auto_unlock_mutex goes out of scope it
+      // automatically unlocks the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &Utilities::trick_mm_mutex );
 
-   // Ensure enough buffer capacity for the parameter.
-   ensure_buffer_capacity( size );
+      // Get the parameter size and number of items.
+      calculate_size_and_number_of_items();
+
+      // Ensure enough buffer capacity for the parameter.
+      ensure_buffer_capacity( size );
+   }
 
    // Check to make sure the users simulation variable has memory allocated to
    // it. It could be that the users simulation variable happens to be pointing
@@ -538,13 +565,7 @@ VariableLengthData Parameter::get_encoded_parameter_value()
 {
    // Pack the parameter buffer to encode the parameter.
    pack_parameter_buffer();
-   if ( rti_encoding == ENCODING_BOOLEAN ) {
-      // The size is the number of 1-byte bool values in c++ and we need to
-      // map to a 4-byte HLAboolean type. The buffer already holds the
-      // encoded HLAboolean type.
-      return VariableLengthData( buffer, 4 * size );
-   }
-   return VariableLengthData( buffer, size );
+   return VariableLengthData( buffer, get_encoded_size() );
 }
 
 bool Parameter::extract_data(
@@ -736,9 +757,25 @@ from parameter map, buffer-size:%d, expected-byte-count:%d.%c",
    return true;
 }
 
+void Parameter::set_memory_owner(
+   MemoryUsage *owner )
+{
+   if ( buffer != NULL ) {
+      if ( memory_owner != NULL ) {
+         memory_owner->record( -(int64_t)buffer_capacity );
+      }
+      if ( owner != NULL ) {
+         owner->record( (int64_t)buffer_capacity );
+      }
+   }
+   this->memory_owner = owner;
+}
+
 void Parameter::ensure_buffer_capacity(
    size_t capacity )
 {
+   size_t const prev_capacity = ( buffer != NULL ) ? buffer_capacity : 0;
+
    if ( capacity > buffer_capacity ) {
       buffer_capacity = capacity;
       if ( buffer == NULL ) {
@@ -764,6 +801,8 @@ void Parameter::ensure_buffer_capacity(
              << "'!" << THLA_ENDL;
       DebugHandler::terminate_with_message( errmsg.str() );
    }
+
+   MemoryAccounting::record( MEMORY_PARAMETER_BUFFERS, (int64_t)buffer_capacity - (int64_t)prev_capacity, memory_owner );
 }
 
 void Parameter::calculate_size_and_number_of_items()
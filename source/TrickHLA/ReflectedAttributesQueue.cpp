@@ -16,8 +16,11 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{ReflectedAttributesQueue.cpp}
+@trick_link_dependency{MemoryAccounting.cpp}
+@trick_link_dependency{MemoryUsage.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
+@trick_link_dependency{SleepTimeout.cpp}
 
 @revs_title
 @revs_begin
@@ -31,19 +34,55 @@ NASA, Johnson Space Center\n
 
 // TrickHLA include files.
 #include "TrickHLA/ReflectedAttributesQueue.hh"
+#include "TrickHLA/Federate.hh"
+#include "TrickHLA/MemoryAccounting.hh"
+#include "TrickHLA/MemoryUsage.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/SleepTimeout.hh"
 
 using namespace std;
 using namespace RTI1516_NAMESPACE;
 using namespace TrickHLA;
 
+namespace
+{
+
+// Approximate bytes of a queued reflection: the attribute values plus the
+// map node and timestamp overhead.
+int64_t reflection_bytes(
+   AttributeHandleValueMap const &attrs )
+{
+   int64_t bytes = (int64_t)( sizeof( AttributeHandleValueMap ) + sizeof( int64_t ) );
+
+   AttributeHandleValueMap::const_iterator iter;
+   for ( iter = attrs.begin(); iter != attrs.end(); ++iter ) {
+      bytes += (int64_t)( sizeof( AttributeHandleValueMap::value_type ) + ( 4 * sizeof( void * ) ) + iter->second.size() );
+   }
+   return bytes;
+}
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
 ReflectedAttributesQueue::ReflectedAttributesQueue()
    : queue_mutex(),
-     attribute_map_queue()
+     attribute_map_queue(),
+     attribute_time_queue(),
+     conflation_mode( REFLECTION_CONFLATION_NONE ),
+     max_depth( 0 ),
+     overflow_policy( QUEUE_OVERFLOW_CONFLATE ),
+     block_timeout( 1.0 ),
+     conflated_count( 0LL ),
+     conflated_attribute_count( 0LL ),
+     dropped_count( 0LL ),
+     blocked_count( 0LL ),
+     peak_depth( 0 ),
+     overflowed( false ),
+     memory_owner( NULL ),
+     queued_bytes( 0 )
 {
    return;
 }
@@ -58,6 +97,10 @@ ReflectedAttributesQueue::~ReflectedAttributesQueue()
    while ( !attribute_map_queue.empty() ) {
       attribute_map_queue.pop();
    }
+   while ( !attribute_time_queue.empty() ) {
+      attribute_time_queue.pop();
+   }
+   account_bytes( -queued_bytes );
 
    // Make sure we destroy the queue_mutex.
    queue_mutex.destroy();
@@ -72,14 +115,125 @@ bool ReflectedAttributesQueue::empty()
    return attribute_map_queue.empty();
 }
 
-void ReflectedAttributesQueue::push(
-   AttributeHandleValueMap const &theAttributes )
+void ReflectedAttributesQueue::configure_conflation(
+   ReflectionConflationEnum const mode,
+   int const                      max_depth )
 {
    // When auto_unlock_mutex goes out of scope it automatically unlocks the
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &queue_mutex );
 
-   attribute_map_queue.push( theAttributes );
+   this->conflation_mode = mode;
+   this->max_depth       = ( max_depth > 0 ) ? max_depth : 0;
+}
+
+void ReflectedAttributesQueue::configure_overflow(
+   QueueOverflowPolicyEnum const policy,
+   double const                  block_timeout )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &queue_mutex );
+
+   this->overflow_policy = policy;
+   this->block_timeout   = ( block_timeout > 0.0 ) ? block_timeout : 0.0;
+}
+
+/*!
+ * @details The RTI callback thread must not block while the federate has a
+ * time advance request pending, since it has to deliver the time advance
+ * grant the Trick main thread is waiting on before it can drain the queue.
+ * The wait is also bounded by the block timeout.
+ * @job_class{scheduled}
+ */
+bool const ReflectedAttributesQueue::wait_for_room(
+   Federate *federate )
+{
+   if ( ( overflow_policy != QUEUE_OVERFLOW_BLOCK ) || ( max_depth <= 0 )
+        || ( size() < (size_t)max_depth ) ) {
+      return true;
+   }
+
+   ++blocked_count;
+
+   SleepTimeout sleep_timer( block_timeout, THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+   while ( size() >= (size_t)max_depth ) {
+      if ( ( ( federate != NULL ) && federate->is_time_advance_requested() )
+           || sleep_timer.timeout() ) {
+         return false;
+      }
+      (void)sleep_timer.sleep();
+   }
+   return true;
+}
+
+/*!
+ * @details When conflation applies the reflected attribute values are merged
+ * into the newest queued reflection so that only the latest value of each
+ * attribute is kept, which bounds the queue for a slow consumer.
+ * @job_class{scheduled}
+ */
+bool const ReflectedAttributesQueue::push(
+   AttributeHandleValueMap const &theAttributes,
+   int64_t const                  time )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &queue_mutex );
+
+   bool const full    = ( max_depth > 0 ) && ( attribute_map_queue.size() >= (size_t)max_depth );
+   bool const reached = full && !overflowed;
+   if ( full ) {
+      overflowed = true;
+
+      if ( overflow_policy == QUEUE_OVERFLOW_DROP_NEWEST ) {
+         ++dropped_count;
+         return reached;
+      }
+      // The block policy falls back to dropping the oldest reflection when
+      // wait_for_room() could not wait for room.
+      if ( ( overflow_policy == QUEUE_OVERFLOW_DROP_OLDEST )
+           || ( overflow_policy == QUEUE_OVERFLOW_BLOCK ) ) {
+         account_bytes( -reflection_bytes( attribute_map_queue.front() ) );
+         attribute_map_queue.pop();
+         attribute_time_queue.pop();
+         ++dropped_count;
+      }
+   }
+
+   if ( !attribute_map_queue.empty() && is_conflation_allowed( time ) ) {
+      AttributeHandleValueMap &queued_attrs = attribute_map_queue.back();
+      int64_t const            prev_bytes   = reflection_bytes( queued_attrs );
+
+      AttributeHandleValueMap::const_iterator iter;
+      for ( iter = theAttributes.begin(); iter != theAttributes.end(); ++iter ) {
+         AttributeHandleValueMap::iterator queued_iter = queued_attrs.find( iter->first );
+         if ( queued_iter != queued_attrs.end() ) {
+            queued_iter->second = iter->second;
+            ++conflated_attribute_count;
+         } else {
+            queued_attrs.insert( *iter );
+         }
+      }
+
+      // The merged reflection takes on the time of the latest reflection.
+      attribute_time_queue.back() = time;
+
+      account_bytes( reflection_bytes( queued_attrs ) - prev_bytes );
+
+      ++conflated_count;
+   } else {
+      attribute_map_queue.push( theAttributes );
+      attribute_time_queue.push( time );
+
+      account_bytes( reflection_bytes( theAttributes ) );
+
+      if ( attribute_map_queue.size() > peak_depth ) {
+         peak_depth = attribute_map_queue.size();
+      }
+   }
+
+   return reached;
 }
 
 void ReflectedAttributesQueue::pop()
@@ -88,7 +242,14 @@ void ReflectedAttributesQueue::pop()
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &queue_mutex );
 
+   account_bytes( -reflection_bytes( attribute_map_queue.front() ) );
    attribute_map_queue.pop();
+   attribute_time_queue.pop();
+
+   // Report the next overflow once the backlog has drained.
+   if ( attribute_map_queue.empty() ) {
+      overflowed = false;
+   }
 }
 
 AttributeHandleValueMap const &ReflectedAttributesQueue::front()
@@ -110,4 +271,66 @@ void ReflectedAttributesQueue::clear()
    while ( !attribute_map_queue.empty() ) {
       attribute_map_queue.pop();
    }
+   while ( !attribute_time_queue.empty() ) {
+      attribute_time_queue.pop();
+   }
+   account_bytes( -queued_bytes );
+   overflowed = false;
+}
+
+size_t ReflectedAttributesQueue::size()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &queue_mutex );
+
+   return attribute_map_queue.size();
+}
+
+bool ReflectedAttributesQueue::is_conflation_allowed(
+   int64_t const time )
+{
+   // Bound the queue memory by always merging once the queue is full.
+   if ( ( overflow_policy == QUEUE_OVERFLOW_CONFLATE )
+        && ( max_depth > 0 ) && ( attribute_map_queue.size() >= (size_t)max_depth ) ) {
+      return true;
+   }
+
+   switch ( conflation_mode ) {
+      case REFLECTION_CONFLATION_LATEST_VALUE: {
+         return true;
+      }
+      case REFLECTION_CONFLATION_SAME_TIME: {
+         // Only merge reflections for the same timestamp so that Timestamp
+         // Order data is still processed in time order. Receive Order
+         // reflections all share the same RECEIVE_ORDER_TIME.
+         return ( attribute_time_queue.back() == time );
+      }
+      default: {
+         return false;
+      }
+   }
+}
+
+void ReflectedAttributesQueue::set_memory_owner(
+   MemoryUsage *owner )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &queue_mutex );
+
+   if ( memory_owner != NULL ) {
+      memory_owner->record( -queued_bytes );
+   }
+   if ( owner != NULL ) {
+      owner->record( queued_bytes );
+   }
+   this->memory_owner = owner;
+}
+
+void ReflectedAttributesQueue::account_bytes(
+   int64_t const delta_bytes )
+{
+   this->queued_bytes += delta_bytes;
+   MemoryAccounting::record( MEMORY_REFLECTION_QUEUES, delta_bytes, memory_owner );
 }
@@ -0,0 +1,275 @@
+/*!
+@file TrickHLA/SenderThread.cpp
+@ingroup TrickHLA
+@brief This class provides a dedicated thread that issues the RTI attribute
+value updates queued by the Trick main thread, in the order they were queued.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{Int64Time.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+@trick_link_dependency{SenderThread.cpp}
+@trick_link_dependency{StringUtilities.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <pthread.h>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/SenderThread.hh"
+#include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/Types.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+using namespace std;
+using namespace RTI1516_NAMESPACE;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+SenderThread::SenderThread()
+   : running( false ),
+     stopping( false ),
+     sending( false ),
+     queue_limit( 1 ),
+     queue(),
+     mutex(),
+     blocked_count( 0 ),
+     max_queue_depth( 0 ),
+     sent_count( 0 )
+{
+   pthread_cond_init( &work_cond, NULL );
+   pthread_cond_init( &drained_cond, NULL );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SenderThread::~SenderThread()
+{
+   stop();
+
+   pthread_cond_destroy( &work_cond );
+   pthread_cond_destroy( &drained_cond );
+
+   // Make sure we destroy the mutex.
+   mutex.destroy();
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void SenderThread::start(
+   unsigned int const limit )
+{
+   if ( running ) {
+      return;
+   }
+
+   this->queue_limit = ( limit > 0 ) ? limit : 1;
+   this->stopping    = false;
+
+   int const ret = pthread_create( &thread, NULL, thread_main, this );
+   if ( ret != 0 ) {
+      ostringstream errmsg;
+      errmsg << "SenderThread::start():" << __LINE__
+             << " ERROR: Could not create the sender thread, error code: "
+             << ret << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   this->running = true;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "SenderThread::start():%d Started the sender thread with a queue limit of %u updates.%c",
+               __LINE__, queue_limit, THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void SenderThread::stop()
+{
+   if ( !running ) {
+      return;
+   }
+
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      // The sender thread sends the queued updates before it exits.
+      this->stopping = true;
+      pthread_cond_signal( &work_cond );
+   }
+   pthread_join( thread, NULL );
+   this->running = false;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "SenderThread::stop():%d Sent:%llu Max-queue-depth:%u Blocked:%llu%c",
+               __LINE__, sent_count, max_queue_depth, blocked_count, THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void SenderThread::enqueue(
+   char const                 *obj_name,
+   RTIambassador              *rti_amb,
+   ObjectInstanceHandle const &instance_handle,
+   AttributeHandleValueMap    &attribute_values,
+   bool const                  timestamp_order,
+   Int64Time const            &update_time )
+{
+   SenderThreadItem *item = new SenderThreadItem();
+   item->obj_name         = obj_name;
+   item->rti_amb          = rti_amb;
+   item->instance_handle  = instance_handle;
+   item->timestamp_order  = timestamp_order;
+   item->update_time      = update_time;
+
+   // Take the attribute values without copying them.
+   item->attribute_values.swap( attribute_values );
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   // Back-pressure: block while the queue is full so the main thread can not
+   // get further ahead of the RTI than the queue limit.
+   if ( queue.size() >= queue_limit ) {
+      ++blocked_count;
+      while ( queue.size() >= queue_limit ) {
+         pthread_cond_wait( &drained_cond, &mutex.mutex );
+      }
+   }
+
+   queue.push_back( item );
+   if ( queue.size() > max_queue_depth ) {
+      this->max_queue_depth = (unsigned int)queue.size();
+   }
+   pthread_cond_signal( &work_cond );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void SenderThread::flush()
+{
+   if ( !running ) {
+      return;
+   }
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   while ( !queue.empty() || sending ) {
+      pthread_cond_wait( &drained_cond, &mutex.mutex );
+   }
+}
+
+void *SenderThread::thread_main(
+   void *arg )
+{
+   static_cast< SenderThread * >( arg )->run();
+   return NULL;
+}
+
+void SenderThread::run()
+{
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   while ( true ) {
+      while ( queue.empty() && !stopping ) {
+         pthread_cond_wait( &work_cond, &mutex.mutex );
+      }
+      if ( queue.empty() ) {
+         // Stopping with no updates left to send.
+         break;
+      }
+
+      SenderThreadItem *item = queue.front();
+      queue.pop_front();
+      this->sending = true;
+
+      // Make the RTI call without holding the mutex so the main thread can
+      // keep queuing updates.
+      mutex.unlock();
+      send( *item );
+      delete item;
+      mutex.lock();
+
+      this->sending = false;
+      ++sent_count;
+      pthread_cond_broadcast( &drained_cond );
+   }
+}
+
+void SenderThread::send(
+   SenderThreadItem &item )
+{
+   try {
+      if ( item.timestamp_order ) {
+         // Send as Timestamp Order
+         item.rti_amb->updateAttributeValues( item.instance_handle,
+                                              item.attribute_values,
+                                              RTI1516_USERDATA( 0, 0 ),
+                                              item.update_time.get() );
+      } else {
+         // Send as Receive Order (i.e. with no timestamp).
+         item.rti_amb->updateAttributeValues( item.instance_handle,
+                                              item.attribute_values,
+                                              RTI1516_USERDATA( 0, 0 ) );
+      }
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      string id_str;
+      StringUtilities::to_string( id_str, item.instance_handle );
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "SenderThread::send():" << __LINE__
+             << " Exception for object '" << item.obj_name << "': '" << rti_err_msg << "'" << endl
+             << "  instance_id=" << id_str << endl
+             << "  timestamp_order=" << ( item.timestamp_order ? "Yes" : "No" ) << endl
+             << "  update_time=" << item.update_time.get_time_in_seconds() << endl;
+      send_hs( stderr, errmsg.str().c_str() );
+   }
+}
@@ -0,0 +1,364 @@
+/*!
+@file TrickHLA/SharedMemoryChannel.cpp
+@ingroup TrickHLA
+@brief This class provides a double-buffered shared-memory side channel for
+exchanging large attribute values between federates on the same host.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{SharedMemoryChannel.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER6, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/SharedMemoryChannel.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+// The 'THSM' magic number identifying a shared-memory descriptor or segment.
+#define THLA_SHARED_MEMORY_MAGIC 0x5448534DU
+#define THLA_SHARED_MEMORY_VERSION 1U
+
+// The buffers start on a cache line boundary after the segment header.
+#define THLA_SHARED_MEMORY_DATA_OFFSET 128
+
+namespace
+{
+
+/*!
+@struct SharedMemorySlot
+@brief The state of one of the two buffers in the segment. A sequence number
+of zero means the buffer is being written.
+*/
+typedef struct {
+   volatile uint64_t sequence;
+   volatile uint64_t size;
+} SharedMemorySlot;
+
+/*!
+@struct SharedMemoryHeader
+@brief The header at the start of the segment.
+*/
+typedef struct {
+   uint32_t         magic;
+   uint32_t         version;
+   uint64_t         buffer_capacity;
+   SharedMemorySlot slot[2];
+} SharedMemoryHeader;
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+SharedMemoryChannel::SharedMemoryChannel()
+   : segment_name(),
+     segment( NULL ),
+     segment_size( 0 ),
+     owner( false ),
+     sequence( 0 ),
+     read_buffer( NULL ),
+     read_capacity( 0 ),
+     read_size( 0 )
+{
+   memset( &descriptor, 0, sizeof( descriptor ) );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+   close();
+
+   if ( read_buffer != NULL ) {
+      free( read_buffer );
+      read_buffer   = NULL;
+      read_capacity = 0;
+      read_size     = 0;
+   }
+}
+
+bool const SharedMemoryChannel::is_descriptor(
+   void const  *data,
+   size_t const data_size )
+{
+   if ( ( data == NULL ) || ( data_size != sizeof( SharedMemoryDescriptor ) ) ) {
+      return false;
+   }
+   SharedMemoryDescriptor const *desc = static_cast< SharedMemoryDescriptor const * >( data );
+   return ( ( desc->magic == THLA_SHARED_MEMORY_MAGIC )
+            && ( desc->version == THLA_SHARED_MEMORY_VERSION ) );
+}
+
+uint64_t const SharedMemoryChannel::get_host_id()
+{
+   static uint64_t host_id = 0;
+
+   if ( host_id == 0 ) {
+      char host_name[256];
+      if ( gethostname( host_name, sizeof( host_name ) ) != 0 ) {
+         host_name[0] = '\0';
+      }
+      host_name[sizeof( host_name ) - 1] = '\0';
+
+      // 64-bit FNV-1a hash of the host name.
+      uint64_t hash = 0xcbf29ce484222325ULL;
+      for ( char const *c = host_name; *c != '\0'; ++c ) {
+         hash ^= (uint64_t)(unsigned char)*c;
+         hash *= 0x100000001b3ULL;
+      }
+      host_id = hash;
+   }
+   return host_id;
+}
+
+bool const SharedMemoryChannel::create(
+   size_t const buffer_capacity )
+{
+   if ( is_open() ) {
+      close();
+   }
+
+   if ( segment_name.empty() || ( segment_name.size() >= THLA_SHARED_MEMORY_SEGMENT_NAME_SIZE ) ) {
+      send_hs( stderr, "SharedMemoryChannel::create():%d WARNING: Invalid \
+segment name '%s', it must be less than %d characters.%c",
+               __LINE__, segment_name.c_str(), THLA_SHARED_MEMORY_SEGMENT_NAME_SIZE,
+               THLA_NEWLINE );
+      return false;
+   }
+
+   // Remove a segment left behind by a process that had the same process ID.
+   shm_unlink( segment_name.c_str() );
+
+   int fd = shm_open( segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644 );
+   if ( fd < 0 ) {
+      send_hs( stderr, "SharedMemoryChannel::create():%d WARNING: shm_open() \
+failed for segment '%s': %s%c",
+               __LINE__, segment_name.c_str(), strerror( errno ), THLA_NEWLINE );
+      return false;
+   }
+
+   size_t const size = THLA_SHARED_MEMORY_DATA_OFFSET + ( 2 * buffer_capacity );
+   if ( ftruncate( fd, (off_t)size ) != 0 ) {
+      send_hs( stderr, "SharedMemoryChannel::create():%d WARNING: ftruncate() \
+failed for segment '%s': %s%c",
+               __LINE__, segment_name.c_str(), strerror( errno ), THLA_NEWLINE );
+      ::close( fd );
+      shm_unlink( segment_name.c_str() );
+      return false;
+   }
+
+   void *addr = mmap( NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+   ::close( fd );
+   if ( addr == MAP_FAILED ) {
+      send_hs( stderr, "SharedMemoryChannel::create():%d WARNING: mmap() \
+failed for segment '%s': %s%c",
+               __LINE__, segment_name.c_str(), strerror( errno ), THLA_NEWLINE );
+      shm_unlink( segment_name.c_str() );
+      return false;
+   }
+
+   this->segment      = static_cast< unsigned char * >( addr );
+   this->segment_size = size;
+   this->owner        = true;
+   this->sequence     = 0;
+
+   SharedMemoryHeader *header = reinterpret_cast< SharedMemoryHeader * >( segment );
+   header->buffer_capacity    = buffer_capacity;
+   header->slot[0].sequence   = 0;
+   header->slot[0].size       = 0;
+   header->slot[1].sequence   = 0;
+   header->slot[1].size       = 0;
+   header->version            = THLA_SHARED_MEMORY_VERSION;
+   __sync_synchronize();
+   header->magic = THLA_SHARED_MEMORY_MAGIC;
+
+   memset( &descriptor, 0, sizeof( descriptor ) );
+   descriptor.magic   = THLA_SHARED_MEMORY_MAGIC;
+   descriptor.version = THLA_SHARED_MEMORY_VERSION;
+   descriptor.host_id = get_host_id();
+   strncpy( descriptor.segment, segment_name.c_str(), THLA_SHARED_MEMORY_SEGMENT_NAME_SIZE - 1 );
+
+   return true;
+}
+
+/*!
+ * @details The two buffers are written alternately so a reader can still
+ * copy the previous value while the next one is written. The sequence number
+ * of a buffer is cleared while it is written, so a reader detects a value
+ * that was overwritten during the copy.
+ */
+bool const SharedMemoryChannel::write(
+   void const  *data,
+   size_t const data_size )
+{
+   if ( !owner || ( segment == NULL ) ) {
+      return false;
+   }
+
+   SharedMemoryHeader *header = reinterpret_cast< SharedMemoryHeader * >( segment );
+   if ( data_size > header->buffer_capacity ) {
+      return false;
+   }
+
+   uint64_t const next_sequence = sequence + 1;
+   unsigned int   index         = (unsigned int)( next_sequence % 2 );
+   size_t const   offset        = THLA_SHARED_MEMORY_DATA_OFFSET + ( index * header->buffer_capacity );
+
+   header->slot[index].sequence = 0;
+   __sync_synchronize();
+
+   memcpy( segment + offset, data, data_size );
+   header->slot[index].size = data_size;
+   __sync_synchronize();
+
+   header->slot[index].sequence = next_sequence;
+   this->sequence               = next_sequence;
+
+   descriptor.offset   = offset;
+   descriptor.sequence = next_sequence;
+   descriptor.size     = data_size;
+
+   return true;
+}
+
+SharedMemoryReadEnum const SharedMemoryChannel::read(
+   void const  *data,
+   size_t const data_size )
+{
+   if ( !is_descriptor( data, data_size ) ) {
+      return SHARED_MEMORY_READ_REMOTE;
+   }
+   SharedMemoryDescriptor desc;
+   memcpy( &desc, data, sizeof( desc ) );
+   desc.segment[THLA_SHARED_MEMORY_SEGMENT_NAME_SIZE - 1] = '\0';
+
+   // The side channel only works between federates on the same host.
+   if ( desc.host_id != get_host_id() ) {
+      return SHARED_MEMORY_READ_REMOTE;
+   }
+
+   // Map the segment of the publisher, which changes if another federate
+   // takes over the publishing of the attribute.
+   if ( ( segment == NULL ) || ( segment_name != desc.segment ) ) {
+      if ( !open( desc.segment ) ) {
+         return SHARED_MEMORY_READ_REMOTE;
+      }
+   }
+
+   SharedMemoryHeader const *header = reinterpret_cast< SharedMemoryHeader const * >( segment );
+   if ( ( header->magic != THLA_SHARED_MEMORY_MAGIC )
+        || ( desc.offset < THLA_SHARED_MEMORY_DATA_OFFSET )
+        || ( desc.size > header->buffer_capacity )
+        || ( ( desc.offset + desc.size ) > segment_size ) ) {
+      return SHARED_MEMORY_READ_REMOTE;
+   }
+
+   unsigned int const index = (unsigned int)( ( desc.offset - THLA_SHARED_MEMORY_DATA_OFFSET )
+                                              / header->buffer_capacity );
+   if ( ( index > 1 ) || ( header->slot[index].sequence != desc.sequence ) ) {
+      return SHARED_MEMORY_READ_STALE;
+   }
+
+   if ( desc.size > read_capacity ) {
+      unsigned char *new_buffer = static_cast< unsigned char * >( realloc( read_buffer, desc.size ) );
+      if ( new_buffer == NULL ) {
+         return SHARED_MEMORY_READ_STALE;
+      }
+      this->read_buffer   = new_buffer;
+      this->read_capacity = desc.size;
+   }
+
+   __sync_synchronize();
+   memcpy( read_buffer, segment + desc.offset, desc.size );
+   __sync_synchronize();
+
+   // The publisher wrote over the buffer while we were copying it.
+   if ( header->slot[index].sequence != desc.sequence ) {
+      return SHARED_MEMORY_READ_STALE;
+   }
+   this->read_size = desc.size;
+
+   return SHARED_MEMORY_READ_OK;
+}
+
+bool const SharedMemoryChannel::open(
+   char const *name )
+{
+   close();
+
+   int fd = shm_open( name, O_RDONLY, 0 );
+   if ( fd < 0 ) {
+      return false;
+   }
+
+   struct stat seg_stat;
+   if ( ( fstat( fd, &seg_stat ) != 0 )
+        || ( seg_stat.st_size < (off_t)THLA_SHARED_MEMORY_DATA_OFFSET ) ) {
+      ::close( fd );
+      return false;
+   }
+
+   void *addr = mmap( NULL, (size_t)seg_stat.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+   ::close( fd );
+   if ( addr == MAP_FAILED ) {
+      return false;
+   }
+
+   this->segment      = static_cast< unsigned char * >( addr );
+   this->segment_size = (size_t)seg_stat.st_size;
+   this->segment_name = name;
+   this->owner        = false;
+
+   return true;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void SharedMemoryChannel::close()
+{
+   if ( segment != NULL ) {
+      munmap( segment, segment_size );
+      this->segment      = NULL;
+      this->segment_size = 0;
+
+      if ( owner ) {
+         shm_unlink( segment_name.c_str() );
+         this->owner = false;
+      }
+   }
+}
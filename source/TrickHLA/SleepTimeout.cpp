@@ -15,6 +15,7 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{MonotonicClock.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
 
 @revs_title
@@ -29,10 +30,8 @@ NASA, Johnson Space Center\n
 #include <limits>
 #include <time.h>
 
-// Trick include files.
-#include "trick/clock_proto.h"
-
 // TrickHLA include files.
+#include "TrickHLA/MonotonicClock.hh"
 #include "TrickHLA/SleepTimeout.hh"
 
 using namespace TrickHLA;
@@ -105,7 +104,7 @@ int const SleepTimeout::sleep() const
 
 int64_t const SleepTimeout::time() const
 {
-   return clock_wall_time();
+   return MonotonicClock::get_time_micros();
 }
 
 bool const SleepTimeout::timeout() const
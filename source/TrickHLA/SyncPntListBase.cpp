@@ -37,8 +37,11 @@ NASA, Johnson Space Center\n
 // System include files.
 #include <cstdint>
 #include <iostream>
+#include <map>
+#include <pthread.h>
 #include <sstream>
 #include <string>
+#include <time.h>
 
 // Trick include files.
 #include "trick/exec_proto.h"
@@ -65,9 +68,15 @@ using namespace TrickHLA;
  * @job_class{initialization}
  */
 SyncPntListBase::SyncPntListBase()
-   : mutex()
+   : mutex(),
+     sync_point_list(),
+     sync_point_map()
 {
-   return;
+   pthread_condattr_t attr;
+   pthread_condattr_init( &attr );
+   pthread_condattr_setclock( &attr, CLOCK_MONOTONIC );
+   pthread_cond_init( &state_change_cond, &attr );
+   pthread_condattr_destroy( &attr );
 }
 
 /*!
@@ -78,6 +87,8 @@ SyncPntListBase::~SyncPntListBase()
 {
    this->reset();
 
+   pthread_cond_destroy( &state_change_cond );
+
    // Make sure we destroy the mutex.
    mutex.destroy();
 }
@@ -90,7 +101,7 @@ void SyncPntListBase::add_sync_point(
    // When auto_unlock_mutex goes out of scope it automatically unlocks the
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
-   sync_point_list.push_back( sp );
+   insert_sync_point( sp );
 }
 
 SyncPnt *SyncPntListBase::get_sync_point(
@@ -100,19 +111,9 @@ SyncPnt *SyncPntListBase::get_sync_point(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
 
-   if ( !sync_point_list.empty() ) {
-
-      // Find the sync-point.
-      vector< SyncPnt * >::const_iterator i;
-      for ( i = sync_point_list.begin(); i != sync_point_list.end(); ++i ) {
-         SyncPnt *sp = ( *i );
-
-         // Check for a match.
-         if ( ( sp != NULL ) && ( sp->get_label().compare( label ) == 0 ) ) {
-            // Return the sync-point.
-            return sp;
-         }
-      }
+   SyncPntLabelMap::const_iterator iter = sync_point_map.find( label );
+   if ( iter != sync_point_map.end() ) {
+      return iter->second;
    }
 
    // Must not have found the sync-point.
@@ -320,15 +321,18 @@ void SyncPntListBase::wait_for_list_synchronization(
                // unlocks the mutex even if there is an exception.
                MutexProtection auto_unlock_mutex( &mutex );
                achieved = sp->is_achieved();
+               if ( !achieved ) {
+                  // Release the mutex and wait for a state change, which
+                  // wakes us up as soon as the FedAmb callback arrives.
+                  wait_for_sync_point_state_change();
+                  achieved = sp->is_achieved();
+               }
             }
 
             if ( !achieved ) {
                // Always check to see is a shutdown was received.
                federate->check_for_shutdown_with_termination();
 
-               // Pause and release the processor for short sleep value.
-               sleep_timer.sleep();
-
                // To be more efficient, we get the time once and share it.
                wallclock_time = sleep_timer.time();
 
@@ -370,7 +374,7 @@ void SyncPntListBase::wait_for_list_synchronization(
 
          // Now that the sync-point is achieved, reset the state to EXISTS.
          if ( ( sp != NULL ) && !sp->is_achieved() ) {
-            sp->set_state( SYNC_PT_STATE_EXISTS );
+            set_sync_point_state( sp, SYNC_PT_STATE_EXISTS );
          }
       }
    }
@@ -525,6 +529,7 @@ bool SyncPntListBase::clear_sync_point(
 
             // Extension class dependent code would go here.
 
+            erase_sync_point_label( sp );
             sync_point_list.erase( i );
             delete sp;
             i = sync_point_list.end();
@@ -542,6 +547,8 @@ void SyncPntListBase::reset()
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
 
+   sync_point_map.clear();
+
    while ( !sync_point_list.empty() ) {
       if ( *sync_point_list.begin() != NULL ) {
          delete ( *sync_point_list.begin() );
@@ -561,16 +568,7 @@ bool SyncPntListBase::contains(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
 
-   if ( !sync_point_list.empty() ) {
-      vector< SyncPnt * >::const_iterator i;
-      for ( i = sync_point_list.begin(); i != sync_point_list.end(); ++i ) {
-         SyncPnt const *sp = ( *i );
-         if ( ( sp != NULL ) && ( sp->get_label().compare( label ) == 0 ) ) {
-            return true;
-         }
-      }
-   }
-   return false;
+   return ( sync_point_map.find( label ) != sync_point_map.end() );
 }
 
 /*!
@@ -585,7 +583,7 @@ bool SyncPntListBase::mark_registered(
 
    SyncPnt *sp = get_sync_point( label );
    if ( sp != NULL ) {
-      sp->set_state( SYNC_PT_STATE_REGISTERED );
+      set_sync_point_state( sp, SYNC_PT_STATE_REGISTERED );
       return true;
    }
    return false;
@@ -603,7 +601,7 @@ bool SyncPntListBase::mark_announced(
 
    SyncPnt *sp = get_sync_point( label );
    if ( sp != NULL ) {
-      sp->set_state( SYNC_PT_STATE_ANNOUNCED );
+      set_sync_point_state( sp, SYNC_PT_STATE_ANNOUNCED );
       return true;
    }
    return false;
@@ -624,7 +622,7 @@ bool SyncPntListBase::mark_synchronized(
 
       // Mark the synchronization point at achieved which indicates the
       // federation is synchronized on the synchronization point.
-      sp->set_state( SYNC_PT_STATE_SYNCHRONIZED );
+      set_sync_point_state( sp, SYNC_PT_STATE_SYNCHRONIZED );
       return true;
    }
    return false;
@@ -711,7 +709,7 @@ void SyncPntListBase::register_sync_point(
       RTI_amb.registerFederationSynchronizationPoint( sp->get_label(),
                                                       RTI1516_USERDATA( 0, 0 ) );
       // Mark the sync-point as registered.
-      sp->set_state( SYNC_PT_STATE_REGISTERED );
+      set_sync_point_state( sp, SYNC_PT_STATE_REGISTERED );
 
    } catch ( RTI1516_EXCEPTION const &e ) {
 
@@ -751,7 +749,7 @@ void SyncPntListBase::register_sync_point(
                                                       RTI1516_USERDATA( 0, 0 ),
                                                       federate_handle_set );
       // Mark the sync-point as registered.
-      sp->set_state( SYNC_PT_STATE_REGISTERED );
+      set_sync_point_state( sp, SYNC_PT_STATE_REGISTERED );
 
    } catch ( RTI1516_EXCEPTION const &e ) {
 
@@ -832,14 +830,18 @@ bool SyncPntListBase::wait_for_sync_point_announcement(
          // Always check to see is a shutdown was received.
          federate->check_for_shutdown_with_termination();
 
-         sleep_timer.sleep();
-
          // Critical code section.
          {
             // When auto_unlock_mutex goes out of scope it automatically unlocks the
             // mutex even if there is an exception.
             MutexProtection auto_unlock_mutex( &mutex );
             announced = sp->is_announced();
+            if ( !announced ) {
+               // Release the mutex and wait for a state change, which wakes
+               // us up as soon as the announcement callback arrives.
+               wait_for_sync_point_state_change();
+               announced = sp->is_announced();
+            }
          }
 
          if ( !announced ) {
@@ -919,7 +921,7 @@ bool SyncPntListBase::achieve_sync_point(
          RTI_amb.synchronizationPointAchieved( sp->get_label() );
 
          // Mark the sync-point as achieved.
-         sp->set_state( SYNC_PT_STATE_ACHIEVED );
+         set_sync_point_state( sp, SYNC_PT_STATE_ACHIEVED );
 
       } catch ( SynchronizationPointLabelNotAnnounced const &e ) {
          throw; // Rethrow the exception.
@@ -974,10 +976,16 @@ bool SyncPntListBase::wait_for_synchronization(
             MutexProtection auto_unlock_mutex( &mutex );
 
             synchronized = sp->is_synchronized();
+            if ( !synchronized ) {
+               // Release the mutex and wait for a state change, which wakes
+               // us up as soon as the synchronized callback arrives.
+               wait_for_sync_point_state_change();
+               synchronized = sp->is_synchronized();
+            }
             if ( synchronized ) {
                // Now that the federation is synchronized on the synchronization point,
                // return to SYNC_PT_STATE_EXISTS state.
-               sp->set_state( SYNC_PT_STATE_EXISTS );
+               set_sync_point_state( sp, SYNC_PT_STATE_EXISTS );
             }
          }
 
@@ -986,8 +994,6 @@ bool SyncPntListBase::wait_for_synchronization(
             // Always check to see is a shutdown was received.
             federate->check_for_shutdown_with_termination();
 
-            sleep_timer.sleep();
-
             // To be more efficient, we get the time once and share it.
             wallclock_time = sleep_timer.time();
 
@@ -1019,3 +1025,60 @@ bool SyncPntListBase::wait_for_synchronization(
    }
    return false;
 }
+
+void SyncPntListBase::insert_sync_point(
+   SyncPnt *sp )
+{
+   sync_point_list.push_back( sp );
+
+   // Keep the first sync-point added for a label, which matches the lookup
+   // order of the sync-point list.
+   if ( sync_point_map.find( sp->get_label() ) == sync_point_map.end() ) {
+      sync_point_map[sp->get_label()] = sp;
+   }
+}
+
+void SyncPntListBase::erase_sync_point_label(
+   SyncPnt const *sp )
+{
+   SyncPntLabelMap::iterator iter = sync_point_map.find( sp->get_label() );
+   if ( ( iter == sync_point_map.end() ) || ( iter->second != sp ) ) {
+      return;
+   }
+   sync_point_map.erase( iter );
+
+   // If another sync-point with the same label is still in the list then
+   // it is now the one found by a lookup.
+   vector< SyncPnt * >::const_iterator i;
+   for ( i = sync_point_list.begin(); i != sync_point_list.end(); ++i ) {
+      if ( ( *i != NULL ) && ( *i != sp ) && ( ( *i )->get_label().compare( sp->get_label() ) == 0 ) ) {
+         sync_point_map[sp->get_label()] = *i;
+         return;
+      }
+   }
+}
+
+void SyncPntListBase::set_sync_point_state(
+   SyncPnt              *sp,
+   SyncPtStateEnum const state )
+{
+   sp->set_state( state );
+
+   // Wake up any threads waiting on a sync-point state change.
+   pthread_cond_broadcast( &state_change_cond );
+}
+
+void SyncPntListBase::wait_for_sync_point_state_change(
+   long const wait_micros )
+{
+   struct timespec abs_time;
+   clock_gettime( CLOCK_MONOTONIC, &abs_time );
+
+   long long nsec   = abs_time.tv_nsec + ( (long long)wait_micros * 1000LL );
+   abs_time.tv_sec += (time_t)( nsec / 1000000000LL );
+   abs_time.tv_nsec = (long)( nsec % 1000000000LL );
+
+   // A timeout is expected since the waiting loops periodically check for
+   // shutdown and federation membership.
+   pthread_cond_timedwait( &state_change_cond, &mutex.mutex, &abs_time );
+}
@@ -82,7 +82,7 @@ void TimedSyncPntList::add_sync_point(
    // When auto_unlock_mutex goes out of scope it automatically unlocks the
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
-   sync_point_list.push_back( sp );
+   insert_sync_point( sp );
 }
 
 bool TimedSyncPntList::achieve_all_sync_points(
@@ -83,7 +83,9 @@ TrickThreadCoordinator::TrickThreadCoordinator() // RETURN: -- None.
      thread_state( NULL ),
      data_cycle_base_time_per_thread( NULL ),
      data_cycle_base_time_per_obj( NULL ),
-     main_thread_data_cycle_base_time( 0LL )
+     main_thread_data_cycle_base_time( 0LL ),
+     child_thread_send( false ),
+     send_thread_id_per_obj( NULL )
 {
    return;
 }
@@ -124,6 +126,13 @@ TrickThreadCoordinator::~TrickThreadCoordinator() // RETURN: -- None.
       }
       this->data_cycle_base_time_per_obj = NULL;
    }
+   if ( this->send_thread_id_per_obj != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( this->send_thread_id_per_obj ) ) ) {
+         send_hs( stderr, "TrickThreadCoordinator::~TrickThreadCoordinator():%d ERROR deleting Trick Memory for 'this->send_thread_id_per_obj'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      this->send_thread_id_per_obj = NULL;
+   }
 
    // Make sure we destroy the mutex.
    this->mutex.destroy();
@@ -311,21 +320,39 @@ void TrickThreadCoordinator::initialize(
       this->data_cycle_base_time_per_thread[thread_id] = 0LL;
    }
 
-   // Allocate memory for the data cycle times per each object instance.
-   if ( this->manager->obj_count > 0 ) {
-      this->data_cycle_base_time_per_obj = static_cast< long long * >( TMM_declare_var_1d( "long long", this->manager->obj_count ) );
+   // Allocate memory for the data cycle times per each object instance, which
+   // includes room for the objects instantiated later from object templates.
+   unsigned int const obj_capacity = this->manager->get_object_capacity();
+   if ( obj_capacity > 0 ) {
+      this->data_cycle_base_time_per_obj = static_cast< long long * >( TMM_declare_var_1d( "long long", obj_capacity ) );
       if ( this->data_cycle_base_time_per_obj == NULL ) {
          ostringstream errmsg;
          errmsg << "TrickThreadCoordinator::initialize():" << __LINE__
                 << " ERROR: Could not allocate memory for 'data_cycle_base_time_per_obj'"
-                << " for requested size " << this->manager->obj_count
+                << " for requested size " << obj_capacity
                 << "'!" << THLA_ENDL;
          DebugHandler::terminate_with_message( errmsg.str() );
          exit( 1 );
       }
-      for ( unsigned int obj_index = 0; obj_index < this->manager->obj_count; ++obj_index ) {
+      for ( unsigned int obj_index = 0; obj_index < obj_capacity; ++obj_index ) {
          this->data_cycle_base_time_per_obj[obj_index] = 0LL;
       }
+
+      // Allocate memory for the ID of the thread that sends the data for each
+      // object instance, which defaults to the Trick main thread.
+      this->send_thread_id_per_obj = static_cast< unsigned int * >( TMM_declare_var_1d( "unsigned int", obj_capacity ) );
+      if ( this->send_thread_id_per_obj == NULL ) {
+         ostringstream errmsg;
+         errmsg << "TrickThreadCoordinator::initialize():" << __LINE__
+                << " ERROR: Could not allocate memory for 'send_thread_id_per_obj'"
+                << " for requested size " << obj_capacity
+                << "'!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+         exit( 1 );
+      }
+      for ( unsigned int obj_index = 0; obj_index < obj_capacity; ++obj_index ) {
+         this->send_thread_id_per_obj[obj_index] = 0;
+      }
    }
 
    if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
@@ -752,6 +779,98 @@ void TrickThreadCoordinator::verify_trick_thread_associations()
          }
       }
    }
+
+   // Now that the associations are verified, determine which Trick child
+   // thread sends the data for each object.
+   if ( this->child_thread_send ) {
+      assign_send_threads();
+   }
+}
+
+/*!
+ * @brief Enable the Trick child threads to pack and send the data for the
+ * objects they own instead of the Trick main thread. This must be called
+ * before the thread associations are verified, such as from the input file.
+ */
+void TrickThreadCoordinator::enable_child_thread_send(
+   bool const enable )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   this->child_thread_send = enable;
+}
+
+/*!
+ * @brief Assign the Trick child thread that sends the data for each object.
+ * An object is sent by a child thread only if that child thread is the one
+ * and only thread associated to the object, otherwise the Trick main thread
+ * sends it so that the data from all the threads is coherent.
+ * Note: This is called from a locked mutex critical section.
+ */
+void TrickThreadCoordinator::assign_send_threads()
+{
+   if ( this->send_thread_id_per_obj == NULL ) {
+      return;
+   }
+
+   ostringstream summary;
+   summary << "TrickThreadCoordinator::assign_send_threads():" << __LINE__
+           << " Objects sent by Trick child threads:" << THLA_ENDL;
+   bool any_obj_assigned = false;
+
+   for ( unsigned int obj_index = 0; obj_index < this->manager->obj_count; ++obj_index ) {
+      Object const &obj = this->manager->objects[obj_index];
+
+      unsigned int send_thread_id = 0;
+      unsigned int assoc_count    = 0;
+      for ( unsigned int thread_id = 0; thread_id < obj.thread_ids_array_count; ++thread_id ) {
+         if ( obj.thread_ids_array[thread_id] ) {
+            send_thread_id = thread_id;
+            ++assoc_count;
+         }
+      }
+
+      // Only an enabled and associated child thread can own the send.
+      if ( ( assoc_count != 1 )
+           || ( send_thread_id == 0 )
+           || ( send_thread_id >= this->thread_cnt )
+           || ( this->thread_state[send_thread_id] == THREAD_STATE_DISABLED )
+           || ( this->thread_state[send_thread_id] == THREAD_STATE_NOT_ASSOCIATED ) ) {
+         send_thread_id = 0;
+      }
+      this->send_thread_id_per_obj[obj_index] = send_thread_id;
+
+      if ( send_thread_id != 0 ) {
+         summary << "  thread-id:" << send_thread_id
+                 << "  obj-instance:'" << obj.get_name() << "'" << THLA_ENDL;
+         any_obj_assigned = true;
+      }
+   }
+
+   if ( !any_obj_assigned ) {
+      summary << "  (None, all object data is sent by the Trick main thread)" << THLA_ENDL;
+   }
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
+      send_hs( stdout, summary.str().c_str() );
+   }
+}
+
+/*!
+ * @brief Get the ID of the Trick thread that packs and sends the data for the
+ * object, which is zero for the Trick main thread. Objects instantiated after
+ * the thread associations were verified are always sent by the main thread.
+ */
+unsigned int TrickThreadCoordinator::get_send_thread_id_for_obj(
+   unsigned int const obj_index ) const
+{
+   return ( this->child_thread_send
+            && this->any_child_thread_associated
+            && ( this->send_thread_id_per_obj != NULL )
+            && ( obj_index < this->manager->obj_count ) )
+             ? this->send_thread_id_per_obj[obj_index]
+             : 0;
 }
 
 /*!
@@ -998,6 +1117,13 @@ void TrickThreadCoordinator::wait_to_send_data_for_child_thread(
       return;
    }
 
+   // The child thread sends the data for the objects it owns itself instead
+   // of waiting for the Trick main thread to send it.
+   if ( this->child_thread_send ) {
+      send_data_for_child_thread( thread_id );
+      return;
+   }
+
    if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
       send_hs( stdout, "TrickThreadCoordinator::wait_to_send_data_for_child_thread():%d Child Thread:%d, waiting...%c",
                __LINE__, thread_id, THLA_NEWLINE );
@@ -1080,6 +1206,107 @@ void TrickThreadCoordinator::wait_to_send_data_for_child_thread(
    }
 }
 
+/*!
+ * @brief The Trick child thread packs and sends the data for the objects it
+ * owns. The child thread waits for the Trick main thread to have the Time
+ * Advance Grant (TAG) for the current frame, which it announces with
+ * announce_data_available(), so the data is sent with the same update time
+ * the main thread would use. The main thread waits for this child thread to
+ * be ready to send in wait_to_send_data_for_main_thread() before it sends its
+ * own data and makes the next Time Advance Request (TAR), which keeps the
+ * child thread sends ahead of the TAR.
+ */
+void TrickThreadCoordinator::send_data_for_child_thread(
+   unsigned int const thread_id )
+{
+   if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
+      send_hs( stdout, "TrickThreadCoordinator::send_data_for_child_thread():%d Child Thread:%d, waiting for grant...%c",
+               __LINE__, thread_id, THLA_NEWLINE );
+   }
+
+   // Do a quick look to determine if the Trick main thread has the grant
+   // and the data for this frame is available.
+   bool granted;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      granted = ( this->thread_state[0] == THREAD_STATE_READY_TO_RECEIVE );
+   }
+
+   // If the quick look did not succeed then do a more involved spin-lock
+   // with a sleep. This will have more wait latency.
+   if ( !granted ) {
+
+      int64_t      wallclock_time;
+      SleepTimeout print_timer( this->federate->wait_status_time );
+      SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+
+      // Wait for the main thread to have the grant.
+      do {
+         // Check for shutdown.
+         this->federate->check_for_shutdown_with_termination();
+
+         sleep_timer.sleep();
+
+         {
+            // When auto_unlock_mutex goes out of scope it automatically
+            // unlocks the mutex even if there is an exception.
+            MutexProtection auto_unlock_mutex( &mutex );
+
+            granted = ( this->thread_state[0] == THREAD_STATE_READY_TO_RECEIVE );
+         }
+
+         if ( !granted ) {
+
+            // To be more efficient, we get the time once and share it.
+            wallclock_time = sleep_timer.time();
+
+            if ( sleep_timer.timeout( wallclock_time ) ) {
+               sleep_timer.reset();
+               if ( !this->federate->is_execution_member() ) {
+                  ostringstream errmsg;
+                  errmsg << "TrickThreadCoordinator::send_data_for_child_thread():" << __LINE__
+                         << " ERROR: Unexpectedly the Federate is no longer an execution"
+                         << " member. This means we are either not connected to the"
+                         << " RTI or we are no longer joined to the federation"
+                         << " execution because someone forced our resignation at"
+                         << " the Central RTI Component (CRC) level!"
+                         << THLA_ENDL;
+                  DebugHandler::terminate_with_message( errmsg.str() );
+               }
+            }
+
+            if ( print_timer.timeout( wallclock_time ) ) {
+               print_timer.reset();
+               send_hs( stdout, "TrickThreadCoordinator::send_data_for_child_thread():%d Child Thread:%d, waiting for grant...%c",
+                        __LINE__, thread_id, THLA_NEWLINE );
+            }
+         }
+      } while ( !granted );
+   }
+
+   // Pack and send the data for the objects this child thread owns. The
+   // mutex is not held so the child threads send concurrently.
+   this->manager->send_cyclic_and_requested_data_for_thread( thread_id );
+
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      // Mark this child thread as ready to send, which releases the main
+      // thread to send its data and make the next TAR.
+      this->thread_state[thread_id] = THREAD_STATE_READY_TO_SEND;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
+      send_hs( stdout, "TrickThreadCoordinator::send_data_for_child_thread():%d Child Thread:%d, Done%c",
+               __LINE__, thread_id, THLA_NEWLINE );
+   }
+}
+
 /*! @brief Wait to receive data when the Trick main thread is ready. */
 void TrickThreadCoordinator::wait_to_receive_data()
 {
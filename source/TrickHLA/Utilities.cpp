@@ -15,6 +15,7 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{Utilities.cpp}
 
@@ -35,6 +36,7 @@ NASA, Johnson Space Center\n
 #include "trick/trick_byteswap.h"
 
 // TrickHLA include files.
+#include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
 #include "TrickHLA/Version.hh"
@@ -47,6 +49,10 @@ fpu_control_t __fpu_control;
 using namespace std;
 using namespace TrickHLA;
 
+// The Manager can initialize the attributes and parameters in parallel, and
+// every Trick memory-manager call they make is serialized by this one mutex.
+MutexLock Utilities::trick_mm_mutex;
+
 bool Utilities::is_transmission_byteswap(
    EncodingEnum const rti_encoding )
 {